@@ -91,6 +91,23 @@ struct Gia_Obj_t_
 // - pointer to the next node in the hash table during structural hashing
 // - pointer to the node copy during duplication 
 
+// structure-of-arrays copy of the AIG (see giaSoa.c)
+// the fanins and the marks of the objects are stored in separate arrays,
+// so that traversals reading only the structure touch fewer cache lines;
+// the copy is a snapshot and is used only while the AIG is not extended;
+// code changing the fanins of existing objects must update the copy
+// (Gia_ManSoaUpdateCo) or free it (Gia_ManSoaStop)
+typedef struct Gia_Soa_t_ Gia_Soa_t;
+struct Gia_Soa_t_
+{
+    int            nObjs;         // the number of objects when the copy was made
+    int            fPlain;        // the AIG has only AND gates (no XORs, MUXes or buffers)
+    int *          pFans0;        // the first fanin literal (-1 for the constant and CIs)
+    int *          pFans1;        // the second fanin literal (-1 for the constant, CIs and COs)
+    word *         pMark0;        // the first user-controlled mark (one bit per object)
+    word *         pMark1;        // the second user-controlled mark (one bit per object)
+};
+
 // new AIG manager
 typedef struct Gia_Man_t_ Gia_Man_t;
 struct Gia_Man_t_
@@ -163,6 +180,7 @@ struct Gia_Man_t_
     unsigned char* pSwitching;    // switching activity for each object
     Gia_Plc_t *    pPlacement;    // placement of the objects
     Gia_Man_t *    pAigExtra;     // combinational logic of holes
+    Gia_Man_t *    pAigMapSrc;    // the AIG the LUT mapping was computed on, with the same LUTs
     Vec_Flt_t *    vInArrs;       // PI arrival times
     Vec_Flt_t *    vOutReqs;      // PO required times
     Vec_Int_t *    vCiArrs;       // CI arrival times
@@ -223,7 +241,9 @@ struct Gia_Man_t_
     Vec_Wrd_t *    vSuppWords;    // support information
     Vec_Int_t      vCopiesTwo;    // intermediate copies
     Vec_Int_t      vSuppVars;     // used variables
-};
+    // structure-of-arrays copy
+    Gia_Soa_t *    pSoa;          // fanins and marks stored as separate arrays
+};
 
 
 typedef struct Gps_Par_t_ Gps_Par_t;
@@ -281,8 +301,12 @@ struct Gia_ParSim_t_
     int            fCheckMiter;   // check if miter outputs are non-zero
     int            fVerbose;      // enables verbose output
     int            iOutFail;      // index of the failed output
+    int            nProcs;        // the number of threads
 };
 
+// concurrent structural hashing (see giaHashPar.c)
+typedef struct Gia_HashPar_t_ Gia_HashPar_t;
+
 typedef struct Gia_ManSim_t_ Gia_ManSim_t;
 struct Gia_ManSim_t_
 {
@@ -346,6 +370,8 @@ struct Jf_Par_t_
     word           WordMapDelay;
     word           WordMapArea;
     word           WordMapDelayTarget;
+    word           nCutsAll;
+    word           nCutMem;
     float          MapDelay;
     float          MapArea;
     float          MapAreaF;
@@ -599,6 +625,27 @@ static inline void         Gia_ObjSetTravIdCurrentId( Gia_Man_t * p, int Id )
 static inline int          Gia_ObjIsTravIdCurrentId( Gia_Man_t * p, int Id )                  { assert( Id < p->nTravIdsAlloc ); return (p->pTravIds[Id] == p->nTravIds);           }
 static inline int          Gia_ObjIsTravIdPreviousId( Gia_Man_t * p, int Id )                 { assert( Id < p->nTravIdsAlloc ); return (p->pTravIds[Id] == p->nTravIds - 1);       }
 
+static inline int          Gia_ManHasSoa( Gia_Man_t * p )                                     { return p->pSoa != NULL && p->pSoa->nObjs == p->nObjs;                          }
+static inline void         Gia_ManSoaUpdateCo( Gia_Man_t * p, Gia_Obj_t * pObj )              { if ( Gia_ManHasSoa(p) ) p->pSoa->pFans0[Gia_ObjId(p, pObj)] = Gia_ObjFaninLit0p(p, pObj); }
+static inline int          Gia_SoaObjIsConst0( Gia_Soa_t * p, int Id )                        { return Id == 0;                                                                      }
+static inline int          Gia_SoaObjIsCi( Gia_Soa_t * p, int Id )                            { return Id > 0 && p->pFans0[Id] < 0;                                                  }
+static inline int          Gia_SoaObjIsCo( Gia_Soa_t * p, int Id )                            { return p->pFans0[Id] >= 0 && p->pFans1[Id] < 0;                                      }
+static inline int          Gia_SoaObjIsAnd( Gia_Soa_t * p, int Id )                           { return p->pFans1[Id] >= 0;                                                           }
+static inline int          Gia_SoaObjFaninLit0( Gia_Soa_t * p, int Id )                       { return p->pFans0[Id];                                                                }
+static inline int          Gia_SoaObjFaninLit1( Gia_Soa_t * p, int Id )                       { return p->pFans1[Id];                                                                }
+static inline int          Gia_SoaObjFaninId0( Gia_Soa_t * p, int Id )                        { return Abc_Lit2Var(p->pFans0[Id]);                                                   }
+static inline int          Gia_SoaObjFaninId1( Gia_Soa_t * p, int Id )                        { return Abc_Lit2Var(p->pFans1[Id]);                                                   }
+static inline int          Gia_SoaObjFaninC0( Gia_Soa_t * p, int Id )                         { return Abc_LitIsCompl(p->pFans0[Id]);                                                }
+static inline int          Gia_SoaObjFaninC1( Gia_Soa_t * p, int Id )                         { return Abc_LitIsCompl(p->pFans1[Id]);                                                }
+static inline int          Gia_SoaObjMark0( Gia_Soa_t * p, int Id )                           { return (int)((p->pMark0[Id >> 6] >> (Id & 63)) & 1);                                 }
+static inline int          Gia_SoaObjMark1( Gia_Soa_t * p, int Id )                           { return (int)((p->pMark1[Id >> 6] >> (Id & 63)) & 1);                                 }
+static inline void         Gia_SoaObjSetMark0( Gia_Soa_t * p, int Id )                        { p->pMark0[Id >> 6] |= ((word)1 << (Id & 63));                                        }
+static inline void         Gia_SoaObjSetMark1( Gia_Soa_t * p, int Id )                        { p->pMark1[Id >> 6] |= ((word)1 << (Id & 63));                                        }
+static inline void         Gia_SoaObjCleanMark0( Gia_Soa_t * p, int Id )                      { p->pMark0[Id >> 6] &= ~((word)1 << (Id & 63));                                       }
+static inline void         Gia_SoaObjCleanMark1( Gia_Soa_t * p, int Id )                      { p->pMark1[Id >> 6] &= ~((word)1 << (Id & 63));                                       }
+static inline void         Gia_SoaCleanMark0( Gia_Soa_t * p )                                 { memset( p->pMark0, 0, sizeof(word) * Abc_Bit6WordNum(p->nObjs) );                    }
+static inline void         Gia_SoaCleanMark1( Gia_Soa_t * p )                                 { memset( p->pMark1, 0, sizeof(word) * Abc_Bit6WordNum(p->nObjs) );                    }
+
 static inline void         Gia_ManTimeClean( Gia_Man_t * p )                                  { int i; assert( p->vTiming != NULL ); Vec_FltFill(p->vTiming, 3*Gia_ManObjNum(p), 0); for ( i = 0; i < Gia_ManObjNum(p); i++ )  Vec_FltWriteEntry( p->vTiming, 3*i+1, (float)(ABC_INFINITY) ); }
 static inline void         Gia_ManTimeStart( Gia_Man_t * p )                                  { assert( p->vTiming == NULL ); p->vTiming = Vec_FltAlloc(0); Gia_ManTimeClean( p );  }
 static inline void         Gia_ManTimeStop( Gia_Man_t * p )                                   { assert( p->vTiming != NULL ); Vec_FltFreeP(&p->vTiming);                            }
@@ -843,6 +890,7 @@ static inline void Gia_ManPatchCoDriver( Gia_Man_t * p, int iCoIndex, int iLit0
     assert( Gia_ObjId(p, pObjCo) > Abc_Lit2Var(iLit0) );
     pObjCo->iDiff0  = Gia_ObjId(p, pObjCo) - Abc_Lit2Var(iLit0);
     pObjCo->fCompl0 = Abc_LitIsCompl(iLit0);
+    Gia_ManSoaUpdateCo( p, pObjCo );
 }
 
 #define GIA_ZER 1
@@ -1180,6 +1228,7 @@ extern int                 Gia_FileSize( char * pFileName );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact );
+extern void                Gia_AigerWriteThreads( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int nThreads );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vAnds, Vec_Int_t * vCos, int nRegs );
@@ -1392,6 +1441,11 @@ extern int                 Gia_ManHashLookupInt( Gia_Man_t * p, int iLit0, int i
 extern int                 Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 );
 extern int                 Gia_ManHashAndMulti( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashAndMulti2( Gia_Man_t * p, Vec_Int_t * vLits );
+/*=== giaHashPar.c ===========================================================*/
+extern Gia_HashPar_t *     Gia_ManHashParStart( Gia_Man_t * p, int nObjsMax );
+extern void                Gia_ManHashParStop( Gia_HashPar_t * pHash );
+extern int                 Gia_ManHashParAnd( Gia_HashPar_t * pHash, int iLit0, int iLit1 );
+extern Gia_Man_t *         Gia_ManRehashPar( Gia_Man_t * p, int nProcs );
 /*=== giaIf.c ===========================================================*/
 extern void                Gia_ManPrintMappingStats( Gia_Man_t * p, char * pDumpFile );
 extern void                Gia_ManPrintPackingStats( Gia_Man_t * p );
@@ -1411,7 +1465,10 @@ extern void                Gia_ManTransferTiming( Gia_Man_t * p, Gia_Man_t * pGi
 extern Gia_Man_t *         Gia_ManPerformMapping( Gia_Man_t * p, void * pIfPars );
 extern Gia_Man_t *         Gia_ManPerformSopBalance( Gia_Man_t * p, int nCutNum, int nRelaxRatio, int fVerbose );
 extern Gia_Man_t *         Gia_ManPerformDsdBalance( Gia_Man_t * p, int nLutSize, int nCutNum, int nRelaxRatio, int fVerbose );
-extern Gia_Man_t *         Gia_ManDupHashMapping( Gia_Man_t * p );
+extern Gia_Man_t *         Gia_ManDupHashMapping( Gia_Man_t * p );
+/*=== giaIncMap.c ===========================================================*/
+extern Gia_Man_t *         Gia_ManPerformMappingIncr( Gia_Man_t * pOld, Gia_Man_t * pNew, Vec_Int_t * vChanged, void * pIfPars );
+extern Gia_Man_t *         Nf_ManPerformMappingIncr( Gia_Man_t * pOld, Gia_Man_t * pNew, Vec_Int_t * vChanged, Jf_Par_t * pPars );
 /*=== giaJf.c ===========================================================*/
 extern void                Jf_ManSetDefaultPars( Jf_Par_t * pPars );
 extern Gia_Man_t *         Jf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars );
@@ -1508,6 +1565,12 @@ extern void                Gia_ManBuiltInSimStart( Gia_Man_t * p, int nWords, in
 extern void                Gia_ManBuiltInSimPerform( Gia_Man_t * p, int iObj );
 extern int                 Gia_ManBuiltInSimCheck( Gia_Man_t * p, int iLit0, int iLit1 );
 extern int                 Gia_ManObjCheckOverlap( Gia_Man_t * p, int iLit0, int iLit1, Vec_Int_t * vObjs );
+/*=== giaSoa.c ============================================================*/
+extern Gia_Soa_t *         Gia_ManSoaStart( Gia_Man_t * p );
+extern void                Gia_ManSoaStop( Gia_Man_t * p );
+extern void                Gia_ManSoaCollectAnds( Gia_Man_t * p, Vec_Int_t * vNodes );
+extern int                 Gia_ManSoaLevelNum( Gia_Man_t * p );
+extern void                Gia_ManSoaBench( Gia_Man_t * p, int nIters, int fVerbose );
 /*=== giaSpeedup.c ============================================================*/
 extern float               Gia_ManDelayTraceLut( Gia_Man_t * p );
 extern float               Gia_ManDelayTraceLutPrint( Gia_Man_t * p, int fVerbose );
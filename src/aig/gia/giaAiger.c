@@ -22,11 +22,34 @@
 #include "gia.h"
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
-
-ABC_NAMESPACE_IMPL_START
+#include "misc/util/utilZip.h"
+#include "misc/util/utilPool.h"
+
+#if defined(LIN) || defined(LIN64)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define GIA_AIGER_USE_MMAP
+#endif
+
+ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
 
+// the minimum number of AND gates encoded by one thread
+#define GIA_AIGER_CHUNK_MIN (1 << 16)
+
+typedef struct Gia_AigerChunk_t_ Gia_AigerChunk_t;
+struct Gia_AigerChunk_t_
+{
+    Gia_Man_t *     p;          // the AIG being written
+    int             iStart;     // the first object of the chunk
+    int             iStop;      // the object following the last one
+    unsigned char * pBuffer;    // the encoded AND gates
+    int             nSize;      // the number of bytes in the buffer
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
@@ -173,7 +196,7 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+Gia_Man_t * Gia_AigerReadFromMemoryInt( char * pContents, int nFileSize, Gia_Man_t * pBuilt, Vec_Int_t * vBuilt, int fGiaSimple, int fSkipStrash, int fCheck )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
@@ -252,21 +275,34 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
             fprintf( stdout, "Warning: The last %d outputs are interpreted as constraints.\n", nConstr );
     }
 
-    // allocate the empty AIG
-    pNew = Gia_ManStart( nTotal + nLatches + nOutputs + 1 );
-    pNew->nConstrs = nConstr;
-    pNew->fGiaSimple = fGiaSimple;
-
-    // prepare the array of nodes
-    vNodes = Vec_IntAlloc( 1 + nTotal );
-    Vec_IntPush( vNodes, 0 );
-
-    // create the PIs
-    for ( i = 0; i < nInputs + nLatches; i++ )
-    {
-        iObj = Gia_ManAppendCi(pNew);    
-        Vec_IntPush( vNodes, iObj );
-    }
+    if ( pBuilt )
+    {
+        // the CIs and the AND gates are already created by the streaming reader
+        assert( Vec_IntSize(vBuilt) == 1 + nTotal );
+        pNew = pBuilt;
+        vNodes = vBuilt;
+        pNew->nConstrs = nConstr;
+    }
+    else
+    {
+        // allocate the empty AIG
+        pNew = Gia_ManStart( nTotal + nLatches + nOutputs + 1 );
+        Vec_IntGrow( pNew->vCis, nInputs + nLatches );
+        Vec_IntGrow( pNew->vCos, nOutputs + nLatches );
+        pNew->nConstrs = nConstr;
+        pNew->fGiaSimple = fGiaSimple;
+
+        // prepare the array of nodes
+        vNodes = Vec_IntAlloc( 1 + nTotal );
+        Vec_IntPush( vNodes, 0 );
+
+        // create the PIs
+        for ( i = 0; i < nInputs + nLatches; i++ )
+        {
+            iObj = Gia_ManAppendCi(pNew);    
+            Vec_IntPush( vNodes, iObj );
+        }
+    }
 
     // remember the beginning of latch/PO literals
     pDrivers = pCur;
@@ -283,9 +319,9 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
 
     // create the AND gates
-    if ( !fGiaSimple && !fSkipStrash )
-        Gia_ManHashAlloc( pNew );
-    for ( i = 0; i < nAnds; i++ )
+    if ( !fGiaSimple && !fSkipStrash && !pBuilt )
+        Gia_ManHashAlloc( pNew );
+    for ( i = 0; i < nAnds && !pBuilt; i++ )
     {
         uLit = ((i + 1 + nInputs + nLatches) << 1);
         uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
@@ -304,9 +340,9 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         else
             Vec_IntPush( vNodes, Gia_ManHashAnd(pNew, iNode0, iNode1) );
     }
-    if ( !fGiaSimple && !fSkipStrash )
-        Gia_ManHashStop( pNew );
-
+    if ( !fGiaSimple && !fSkipStrash && !pBuilt )
+        Gia_ManHashStop( pNew );
+
     // remember the place where symbols begin
     pSymbols = pCur;
 
@@ -859,8 +895,138 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         Abc_Print( 0, "Structural hashing enabled while reading AIGER invalidated the mapping.  Consider using \"&r -s\".\n" );
         Vec_IntFreeP( &pNew->vMapping );
     }
-    return pNew;
-}
+    return pNew;
+}
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryInt( pContents, nFileSize, NULL, NULL, fGiaSimple, fSkipStrash, fCheck );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG from the (possibly compressed) stream.]
+
+  Description [Decodes the AND gates while the file is being decompressed
+  by another thread, without keeping the decompressed AND section in memory.
+  The header, the latch/PO literals and the trailing sections (symbols,
+  comments, extensions) are collected into a buffer, which is then parsed
+  by the in-memory reader with the AND gates already created. Compressed
+  files in the ASCII AIGER format are rejected, like the uncompressed ones
+  are not read by this package.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_AigerReadStream( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    Abc_Zip_t * p;
+    Gia_Man_t * pNew, * pRes = NULL;
+    Vec_Int_t * vNodes;
+    Vec_Str_t * vHead;
+    char Buffer[1000], * pContents = NULL;
+    int nNums[9] = {0}, nFileSize, nInputs, nLatches, nOutputs, nAnds, fError = 0, ch, i;
+    int iNode0, iNode1;
+    unsigned uLit, uLit0, uLit1;
+
+    p = Abc_ZipOpen( pFileName, 1 );
+    if ( p == NULL )
+        return NULL;
+    // read the parameters (M I L O A + B C J F)
+    if ( Abc_ZipReadLine( p, Buffer, 1000 ) > 0 && !strncmp(Buffer, "aag", 3) )
+    {
+        fprintf( stdout, "Gia_AigerReadStream(): The file \"%s\" is in the ASCII AIGER format, which is not supported.\n", pFileName );
+        Abc_ZipClose( p );
+        return NULL;
+    }
+    if ( Buffer[0] == 0 || strncmp(Buffer, "aig", 3) || (Buffer[3] != ' ' && Buffer[3] != '2') ||
+         sscanf( Buffer + 4, "%d %d %d %d %d %d %d %d %d", nNums, nNums+1, nNums+2, nNums+3, nNums+4, nNums+5, nNums+6, nNums+7, nNums+8 ) < 5 )
+    {
+        fprintf( stdout, "The parameter line is in a wrong format.\n" );
+        Abc_ZipClose( p );
+        return NULL;
+    }
+    if ( nNums[0] != nNums[1] + nNums[2] + nNums[4] )
+    {
+        fprintf( stdout, "The number of objects does not match.\n" );
+        Abc_ZipClose( p );
+        return NULL;
+    }
+    nInputs  = nNums[1];
+    nLatches = nNums[2];
+    nOutputs = nNums[3] + nNums[5] + nNums[6] + nNums[7] + nNums[8];
+    nAnds    = nNums[4];
+
+    // copy the header and the latch/PO literals (text lines or binary numbers)
+    vHead = Vec_StrAlloc( 1000 );
+    Vec_StrPrintStr( vHead, Buffer );
+    for ( i = 0; i < nLatches + nOutputs; i++ )
+        while ( (ch = Abc_ZipGetc(p)) != -1 )
+        {
+            Vec_StrPush( vHead, (char)ch );
+            if ( Buffer[3] == ' ' ? ch == '\n' : !(ch & 0x80) )
+                break;
+        }
+
+    // create the CIs
+    pNew = Gia_ManStart( nNums[0] + nLatches + nOutputs + 1 );
+    Vec_IntGrow( pNew->vCis, nInputs + nLatches );
+    Vec_IntGrow( pNew->vCos, nOutputs + nLatches );
+    pNew->fGiaSimple = fGiaSimple;
+    vNodes = Vec_IntAlloc( 1 + nNums[0] );
+    Vec_IntPush( vNodes, 0 );
+    for ( i = 0; i < nInputs + nLatches; i++ )
+        Vec_IntPush( vNodes, Gia_ManAppendCi(pNew) );
+
+    // create the AND gates
+    if ( !fGiaSimple && !fSkipStrash )
+        Gia_ManHashAlloc( pNew );
+    for ( i = 0; i < nAnds; i++ )
+    {
+        uLit = ((i + 1 + nInputs + nLatches) << 1);
+        uLit1 = uLit  - Abc_ZipReadUnsigned( p );
+        uLit0 = uLit1 - Abc_ZipReadUnsigned( p );
+        if ( uLit1 >= uLit || uLit0 >= uLit )
+        {
+            fError = 1;
+            break;
+        }
+        iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
+        iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
+        if ( !fGiaSimple && fSkipStrash )
+        {
+            if ( iNode0 == iNode1 )
+                Vec_IntPush( vNodes, Gia_ManAppendBuf(pNew, iNode0) );
+            else
+                Vec_IntPush( vNodes, Gia_ManAppendAnd(pNew, iNode0, iNode1) );
+        }
+        else
+            Vec_IntPush( vNodes, Gia_ManHashAnd(pNew, iNode0, iNode1) );
+    }
+    if ( !fGiaSimple && !fSkipStrash )
+        Gia_ManHashStop( pNew );
+
+    // collect the remaining sections after the header and the literals
+    if ( !fError )
+    {
+        pContents = Abc_ZipReadRest( p, Vec_StrArray(vHead), Vec_StrSize(vHead), 1, &nFileSize );
+        fError = Abc_ZipIsError( p );
+    }
+    Abc_ZipClose( p );
+    Vec_StrFree( vHead );
+    if ( fError )
+        fprintf( stdout, "Gia_AigerReadStream(): The file \"%s\" is corrupted.\n", pFileName );
+    else
+        pRes = Gia_AigerReadFromMemoryInt( pContents, nFileSize, pNew, vNodes, fGiaSimple, fSkipStrash, fCheck );
+    ABC_FREE( pContents );
+    if ( pRes == NULL )
+    {
+        Vec_IntFree( vNodes );
+        Gia_ManStop( pNew );
+    }
+    return pRes;
+}
 
 /**Function*************************************************************
 
@@ -873,24 +1039,70 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
-{
-    FILE * pFile;
-    Gia_Man_t * pNew;
-    char * pName, * pContents;
+#ifdef GIA_AIGER_USE_MMAP
+static Gia_Man_t * Gia_AigerReadMmap( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int * pfDone )
+{
+    Gia_Man_t * pNew;
+    struct stat Stat;
+    char * pContents;
+    long nPageSize = sysconf( _SC_PAGESIZE );
+    int File = open( pFileName, O_RDONLY );
+    *pfDone = 0;
+    if ( File == -1 )
+        return NULL;
+    // the parser relies on a zero byte after the end of the file, which is provided
+    // by the zero-filled tail of the last page unless the file fills it exactly
+    if ( fstat( File, &Stat ) == -1 || Stat.st_size == 0 || Stat.st_size > 0x7FFFFFFF || 
+         (nPageSize > 0 && Stat.st_size % nPageSize == 0) )
+    {
+        close( File );
+        return NULL;
+    }
+    // the private mapping is copy-on-write because the parser may patch names in place
+    pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, File, 0 );
+    close( File );
+    if ( pContents == (char *)MAP_FAILED )
+        return NULL;
+#ifdef MADV_SEQUENTIAL
+    madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+#endif
+    pNew = Gia_AigerReadFromMemory( pContents, (int)Stat.st_size, fGiaSimple, fSkipStrash, fCheck );
+    munmap( pContents, (size_t)Stat.st_size );
+    *pfDone = 1;
+    return pNew;
+}
+#endif
+Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    FILE * pFile;
+    Gia_Man_t * pNew = NULL;
+    char * pName, * pContents;
     int nFileSize;
-    int RetValue;
-
-    // read the file into the buffer
-    Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
-
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    int RetValue, fDone = 0;
+
+    Gia_FileFixName( pFileName );
+    if ( Abc_ZipIsCompressed( pFileName ) )
+    {
+        pNew = Gia_AigerReadStream( pFileName, fGiaSimple, fSkipStrash, fCheck );
+        fDone = 1;
+    }
+#ifdef GIA_AIGER_USE_MMAP
+    // decode directly from the file mapping instead of copying the file into memory
+    if ( !fDone )
+        pNew = Gia_AigerReadMmap( pFileName, fGiaSimple, fSkipStrash, fCheck, &fDone );
+#endif
+    if ( !fDone )
+    {
+        // read the file into the buffer
+        nFileSize = Gia_FileSize( pFileName );
+        pFile = fopen( pFileName, "rb" );
+        pContents = ABC_ALLOC( char, nFileSize );
+        RetValue = fread( pContents, nFileSize, 1, pFile );
+        fclose( pFile );
+
+        pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+        ABC_FREE( pContents );
+    }
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
@@ -1065,25 +1277,113 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
     return vBuffer;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Encodes the AND gates in the given range of objects.]
+
+  Description [The buffer should have room for 10 bytes per AND gate.
+  Returns the number of bytes written.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_AigerWriteAndsRange( Gia_Man_t * p, int iStart, int iStop, unsigned char * pBuffer )
+{
+    Gia_Obj_t * pObj;
+    unsigned uLit0, uLit1, uLit;
+    int i, Pos = 0;
+    for ( i = iStart; i < iStop; i++ )
+    {
+        pObj = Gia_ManObj( p, i );
+        if ( !Gia_ObjIsAnd(pObj) )
+            continue;
+        uLit  = Abc_Var2Lit( i, 0 );
+        uLit0 = Gia_ObjFaninLit0( pObj, i );
+        uLit1 = Gia_ObjFaninLit1( pObj, i );
+        assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
+        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
+        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
+    }
+    return Pos;
+}
+void Gia_AigerWriteWorkerTask( void * pArg )
+{
+    Gia_AigerChunk_t * pChunk = (Gia_AigerChunk_t *)pArg;
+    pChunk->nSize = Gia_AigerWriteAndsRange( pChunk->p, pChunk->iStart, pChunk->iStop, pChunk->pBuffer );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Encodes the AND gates using several threads.]
+
+  Description [The delta encoding of each AND gate depends only on its
+  own ID, so the objects are split into ranges with the same number of
+  AND gates, which are encoded into separate buffers and written in order.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerWriteAndsParallel( Gia_Man_t * p, FILE * pFile, int nChunks )
+{
+    Gia_AigerChunk_t * pChunks = ABC_CALLOC( Gia_AigerChunk_t, nChunks );
+    Util_Job_t * pJob;
+    int i, k = 0, nAnds = 0, nAndsChunk = Gia_ManAndNum(p) / nChunks + 1;
+    Gia_Obj_t * pObj;
+    // divide the objects into ranges
+    pChunks[0].iStart = 0;
+    Gia_ManForEachAnd( p, pObj, i )
+        if ( ++nAnds == nAndsChunk && k < nChunks - 1 )
+        {
+            pChunks[k].iStop = pChunks[k+1].iStart = i + 1;
+            nAnds = 0;
+            k++;
+        }
+    pChunks[k].iStop = Gia_ManObjNum(p);
+    nChunks = k + 1;
+    for ( k = 0; k < nChunks; k++ )
+    {
+        pChunks[k].p       = p;
+        pChunks[k].pBuffer = ABC_ALLOC( unsigned char, 10 * nAndsChunk + 10 );
+    }
+    // encode the ranges using the shared thread pool
+    pJob = Util_JobStart( Util_PoolGlobal() );
+    for ( k = 0; k < nChunks; k++ )
+        Util_JobSubmit( pJob, Gia_AigerWriteWorkerTask, pChunks + k );
+    Util_JobWaitAll( pJob );
+    Util_JobStop( pJob );
+    // write the buffers in order
+    for ( k = 0; k < nChunks; k++ )
+    {
+        fwrite( pChunks[k].pBuffer, 1, pChunks[k].nSize, pFile );
+        ABC_FREE( pChunks[k].pBuffer );
+    }
+    ABC_FREE( pChunks );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Writes the AIG in the binary AIGER format.]
 
-  Description []
+  Description [If nThreads > 1, the AND gates of large AIGs are encoded
+  by several threads.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact )
+void Gia_AigerWriteThreads( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int nThreads )
 {
     int fVerbose = XAIG_VERBOSE;
     FILE * pFile;
-    Gia_Man_t * p;
+    Gia_Man_t * p;
     Gia_Obj_t * pObj;
-    Vec_Str_t * vStrExt;
-    int i, nBufferSize, Pos;
+    Vec_Str_t * vStrExt;
+    int i, nBufferSize, Pos, nChunks;
     unsigned char * pBuffer;
     unsigned uLit0, uLit1, uLit;
     assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
@@ -1101,6 +1401,8 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         fprintf( stdout, "Gia_AigerWrite(): Cannot open the output file \"%s\".\n", pFileName );
         return;
     }
+    // use large buffer to reduce the number of system calls
+    setvbuf( pFile, NULL, _IOFBF, 1 << 20 );
 
     // create normalized AIG
     if ( !Gia_ManIsNormalized(pInit) )
@@ -1151,31 +1453,37 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     Gia_ManInvertConstraints( p );
 
     // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
-    Gia_ManForEachAnd( p, pObj, i )
+    nChunks = Abc_MinInt( nThreads, Gia_ManAndNum(p) / GIA_AIGER_CHUNK_MIN );
+    if ( nChunks > 1 )
+        Gia_AigerWriteAndsParallel( p, pFile, nChunks );
+    else
     {
-        uLit  = Abc_Var2Lit( i, 0 );
-        uLit0 = Gia_ObjFaninLit0( pObj, i );
-        uLit1 = Gia_ObjFaninLit1( pObj, i );
-        assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
+        Pos = 0;
+        nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
+        pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
+        Gia_ManForEachAnd( p, pObj, i )
         {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-	        fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
+            uLit  = Abc_Var2Lit( i, 0 );
+            uLit0 = Gia_ObjFaninLit0( pObj, i );
+            uLit1 = Gia_ObjFaninLit1( pObj, i );
+            assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
+            Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
+            Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
+            if ( Pos > nBufferSize - 10 )
+            {
+                printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
+                fclose( pFile );
+                if ( p != pInit )
+                    Gia_ManStop( p );
+                return;
+            }
         }
-    }
-    assert( Pos < nBufferSize );
+        assert( Pos < nBufferSize );
 
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
+        // write the buffer
+        fwrite( pBuffer, 1, Pos, pFile );
+        ABC_FREE( pBuffer );
+    }
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -1416,7 +1724,11 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         pInit->vNamesOut = p->vNamesOut; p->vNamesOut = NULL;
         Gia_ManStop( p );
     }
-}
+}
+void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact )
+{
+    Gia_AigerWriteThreads( pInit, pFileName, fWriteSymbols, fCompact, 1 );
+}
 
 /**Function*************************************************************
 
@@ -600,13 +600,8 @@ void Gia_StoRefObj( Gia_Sto_t * p, int iObj )
     else if ( Gia_ObjIsCo(pObj) )
         Vec_IntAddToEntry( p->vRefs, Gia_ObjFaninId0(pObj, iObj), 1 );
 }
-void Gia_StoComputeCuts( Gia_Man_t * pGia )
+void Gia_StoComputeCutsInt( Gia_Man_t * pGia, int nCutSize, int nCutNum, int fCutMin, int fTruthMin, int fVerbose, word * pnCuts, word * pnBytes )
 {
-    int nCutSize  =  6;
-    int nCutNum   = 25;
-    int fCutMin   =  1;
-    int fTruthMin =  1;
-    int fVerbose  =  1;
     Gia_Sto_t * p = Gia_StoAlloc( pGia, nCutSize, nCutNum, fCutMin, fTruthMin, fVerbose );
     Gia_Obj_t * pObj;  int i, iObj;
     assert( nCutSize <= GIA_MAX_CUTSIZE );
@@ -634,8 +629,16 @@ void Gia_StoComputeCuts( Gia_Man_t * pGia )
             p->nCutNum, p->nCutsOver, Gia_ManAndNum(pGia) );
         Abc_PrintTime( 0, "Time", Abc_Clock() - p->clkStart );
     }
+    if ( pnCuts )
+        *pnCuts = (word)p->CutCount[3];
+    if ( pnBytes )
+        *pnBytes = (word)(Vec_WecMemory(p->vCuts) + (p->vTtMem ? Vec_MemMemory(p->vTtMem) : 0));
     Gia_StoFree( p );
 }
+void Gia_StoComputeCuts( Gia_Man_t * pGia )
+{
+    Gia_StoComputeCutsInt( pGia, 6, 25, 1, 1, 1, NULL, NULL );
+}
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
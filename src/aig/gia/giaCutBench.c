@@ -0,0 +1,442 @@
+/**CFile****************************************************************
+
+  FileName    [giaCutBench.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Benchmarking the cut enumeration engines.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaCutBench.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "map/if/if.h"
+
+#if defined(LIN) || defined(LIN64)
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#define GIA_BENCH_USE_PERF
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// Each engine is run on each design of the corpus with the same LUT size
+// and cut limit, and one JSON record is written per run. The record gives
+// the CPU time, the number of cuts stored and the memory used for them,
+// the peak resident memory of the run and, if requested and permitted by
+// the system, the hardware counters of the calling thread.
+
+#define GIA_BENCH_PERF_NUM 4
+
+static char * s_CutBenchEngines[] = { "sto", "if", "mf", "lf", "kf", NULL };
+static char * s_CutBenchCounters[GIA_BENCH_PERF_NUM] = { "cycles", "instructions", "cache_misses", "branch_misses" };
+
+typedef struct Gia_CutBenchRun_t_ Gia_CutBenchRun_t;
+struct Gia_CutBenchRun_t_
+{
+    char *           pEngine;       // the engine name
+    char *           pPhase;        // the phase measured
+    int              fSkipped;      // the engine does not support the parameters
+    abctime          Time;          // CPU time
+    word             nCuts;         // the number of cuts stored
+    word             nCutBytes;     // memory for the cuts (or ~0)
+    word             nBytesPerCut;  // memory for one cut (or ~0)
+    word             nPeakKb;       // peak resident memory (or ~0)
+    word             Counts[GIA_BENCH_PERF_NUM]; // hardware counters
+    int              fCounts[GIA_BENCH_PERF_NUM]; // the counter is available
+};
+
+extern If_Man_t *    Gia_ManToIf( Gia_Man_t * p, If_Par_t * pPars );
+extern void          Gia_StoComputeCutsInt( Gia_Man_t * pGia, int nCutSize, int nCutNum, int fCutMin, int fTruthMin, int fVerbose, word * pnCuts, word * pnBytes );
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the hardware counters.]
+
+  Description [The counters are opened for the calling thread only and
+  are silently skipped if the kernel does not allow them.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_CutBenchPerfStart( int * pFds )
+{
+    int i;
+    for ( i = 0; i < GIA_BENCH_PERF_NUM; i++ )
+        pFds[i] = -1;
+#ifdef GIA_BENCH_USE_PERF
+    {
+        static unsigned long long Configs[GIA_BENCH_PERF_NUM] = {
+            PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES };
+        struct perf_event_attr Attr;
+        for ( i = 0; i < GIA_BENCH_PERF_NUM; i++ )
+        {
+            memset( &Attr, 0, sizeof(Attr) );
+            Attr.type           = PERF_TYPE_HARDWARE;
+            Attr.size           = sizeof(Attr);
+            Attr.config         = Configs[i];
+            Attr.disabled       = 1;
+            Attr.exclude_kernel = 1;
+            Attr.exclude_hv     = 1;
+            pFds[i] = (int)syscall( __NR_perf_event_open, &Attr, 0, -1, -1, 0 );
+            if ( pFds[i] < 0 )
+                continue;
+            ioctl( pFds[i], PERF_EVENT_IOC_RESET, 0 );
+            ioctl( pFds[i], PERF_EVENT_IOC_ENABLE, 0 );
+        }
+    }
+#endif
+}
+static void Gia_CutBenchPerfStop( int * pFds, Gia_CutBenchRun_t * pRun )
+{
+    int i;
+    for ( i = 0; i < GIA_BENCH_PERF_NUM; i++ )
+    {
+        pRun->fCounts[i] = 0;
+#ifdef GIA_BENCH_USE_PERF
+        if ( pFds[i] < 0 )
+            continue;
+        ioctl( pFds[i], PERF_EVENT_IOC_DISABLE, 0 );
+        if ( read( pFds[i], &pRun->Counts[i], sizeof(word) ) == sizeof(word) )
+            pRun->fCounts[i] = 1;
+        close( pFds[i] );
+#endif
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Resets and reads the peak resident memory of the process.]
+
+  Description [Uses /proc, where writing 5 into clear_refs resets the
+  peak. Returns ~0 if the peak cannot be measured.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_CutBenchPeakReset()
+{
+#if defined(LIN) || defined(LIN64)
+    FILE * pFile = fopen( "/proc/self/clear_refs", "wb" );
+    int RetValue;
+    if ( pFile == NULL )
+        return 0;
+    RetValue = fputs( "5", pFile ) >= 0;
+    return fclose( pFile ) == 0 && RetValue;
+#else
+    return 0;
+#endif
+}
+static word Gia_CutBenchPeakRead()
+{
+    word nPeakKb = ~(word)0;
+#if defined(LIN) || defined(LIN64)
+    char Buffer[256];
+    FILE * pFile = fopen( "/proc/self/status", "rb" );
+    if ( pFile == NULL )
+        return nPeakKb;
+    while ( fgets( Buffer, 256, pFile ) )
+        if ( !strncmp( Buffer, "VmHWM:", 6 ) )
+        {
+            nPeakKb = (word)atol( Buffer + 6 );
+            break;
+        }
+    fclose( pFile );
+#endif
+    return nPeakKb;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one engine with the given parameters.]
+
+  Description [Returns 0 if the engine does not support the parameters.
+  The engine runs on a copy of the AIG, which is left unchanged.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_CutBenchRunJf( Gia_Man_t * p, int iEngine, int nLutSize, int nCutNum, Gia_CutBenchRun_t * pRun )
+{
+    extern void Mf_ManSetDefaultPars( Jf_Par_t * pPars );
+    extern void Lf_ManSetDefaultPars( Jf_Par_t * pPars );
+    extern void Kf_ManSetDefaultPars( Jf_Par_t * pPars );
+    extern Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars );
+    extern Gia_Man_t * Lf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars );
+    extern Gia_Man_t * Kf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars );
+    Jf_Par_t Pars, * pPars = &Pars;
+    Gia_Man_t * pNew;
+    memset( pPars, 0, sizeof(Jf_Par_t) );
+    if ( iEngine == 2 )
+        Mf_ManSetDefaultPars( pPars );
+    else if ( iEngine == 3 )
+        Lf_ManSetDefaultPars( pPars );
+    else
+        Kf_ManSetDefaultPars( pPars );
+    if ( nLutSize > pPars->nLutSizeMax || nCutNum > pPars->nCutNumMax )
+        return 0;
+    pPars->nLutSize = nLutSize;
+    pPars->nCutNum  = nCutNum;
+    if ( iEngine == 2 )
+        pNew = Mf_ManPerformMapping( p, pPars );
+    else if ( iEngine == 3 )
+        pNew = Lf_ManPerformMapping( p, pPars );
+    else
+        pNew = Kf_ManPerformMapping( p, pPars );
+    if ( pNew == NULL )
+        return 0;
+    if ( pNew != p )
+        Gia_ManStop( pNew );
+    pRun->nCuts     = pPars->nCutsAll;
+    pRun->nCutBytes = pPars->nCutMem;
+    return 1;
+}
+static int Gia_CutBenchRunIf( Gia_Man_t * p, int nLutSize, int nCutNum, Gia_CutBenchRun_t * pRun )
+{
+    If_Par_t Pars, * pPars = &Pars;
+    If_Man_t * pIfMan;
+    if ( nLutSize > IF_MAX_LUTSIZE || nCutNum >= (1 << 12) )
+        return 0;
+    Gia_ManSetIfParsDefault( pPars );
+    pPars->nLutSize = nLutSize;
+    pPars->nCutsMax = nCutNum;
+    pIfMan = Gia_ManToIf( p, pPars );
+    if ( pIfMan == NULL )
+        return 0;
+    If_ManPerformMapping( pIfMan );
+    // the cutsets are recycled, so the cuts are counted as computed
+    pRun->nCuts        = (word)pIfMan->nCutsTotal;
+    pRun->nBytesPerCut = (word)pIfMan->nCutBytes;
+    If_ManStop( pIfMan );
+    return 1;
+}
+static int Gia_CutBenchRun( Gia_Man_t * pGia, int iEngine, int nLutSize, int nCutNum, int fPerf, Gia_CutBenchRun_t * pRun )
+{
+    // the mappers may attach the mapping to the AIG, so each run gets a copy
+    Gia_Man_t * p = Gia_ManDup( pGia );
+    int pFds[GIA_BENCH_PERF_NUM], RetValue, fPeak;
+    abctime clk;
+    memset( pRun, 0, sizeof(Gia_CutBenchRun_t) );
+    pRun->pEngine      = s_CutBenchEngines[iEngine];
+    pRun->pPhase       = iEngine == 0 ? "cuts" : "map";
+    pRun->nCutBytes    = ~(word)0;
+    pRun->nBytesPerCut = ~(word)0;
+    fPeak = Gia_CutBenchPeakReset();
+    if ( fPerf )
+        Gia_CutBenchPerfStart( pFds );
+    clk = Abc_Clock();
+    if ( iEngine == 0 )
+    {
+        RetValue = nLutSize <= 8 && nCutNum < 51;
+        if ( RetValue )
+            Gia_StoComputeCutsInt( p, nLutSize, nCutNum, 0, 0, 0, &pRun->nCuts, &pRun->nCutBytes );
+    }
+    else if ( iEngine == 1 )
+        RetValue = Gia_CutBenchRunIf( p, nLutSize, nCutNum, pRun );
+    else
+        RetValue = Gia_CutBenchRunJf( p, iEngine, nLutSize, nCutNum, pRun );
+    pRun->Time = Abc_Clock() - clk;
+    if ( fPerf )
+        Gia_CutBenchPerfStop( pFds, pRun );
+    pRun->nPeakKb  = fPeak ? Gia_CutBenchPeakRead() : ~(word)0;
+    pRun->fSkipped = !RetValue;
+    Gia_ManStop( p );
+    if ( RetValue && pRun->nCuts && pRun->nCutBytes != ~(word)0 )
+        pRun->nBytesPerCut = pRun->nCutBytes / pRun->nCuts;
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes one run as a JSON object.]
+
+  Description [The strings are escaped, as the names of the designs and
+  the files may contain quotes, backslashes, and control characters.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_CutBenchWriteValue( FILE * pFile, char * pName, word Value )
+{
+    if ( Value == ~(word)0 )
+        fprintf( pFile, ", \"%s\": null", pName );
+    else
+        fprintf( pFile, ", \"%s\": %.0f", pName, (double)Value );
+}
+static void Gia_CutBenchWriteString( FILE * pFile, char * pName, char * pStr )
+{
+    fprintf( pFile, "\"%s\": \"", pName );
+    for ( ; pStr && *pStr; pStr++ )
+    {
+        if ( *pStr == '\"' || *pStr == '\\' )
+            fprintf( pFile, "\\%c", *pStr );
+        else if ( (unsigned char)*pStr < 0x20 )
+            fprintf( pFile, "\\u%04x", (unsigned char)*pStr );
+        else
+            fputc( *pStr, pFile );
+    }
+    fputc( '\"', pFile );
+}
+static void Gia_CutBenchWriteRun( FILE * pFile, Gia_Man_t * p, char * pFileName, Gia_CutBenchRun_t * pRun, int fPerf, int fFirst )
+{
+    double Time = 1.0 * ((double)pRun->Time) / ((double)CLOCKS_PER_SEC);
+    int i;
+    fprintf( pFile, "%s\n    { ", fFirst ? "" : "," );
+    Gia_CutBenchWriteString( pFile, "design", Gia_ManName(p) );
+    fprintf( pFile, ", " );
+    Gia_CutBenchWriteString( pFile, "file", pFileName );
+    fprintf( pFile, ", \"ands\": %d, \"levels\": %d", Gia_ManAndNum(p), Gia_ManLevelNum(p) );
+    fprintf( pFile, ", \"engine\": \"%s\", \"phase\": \"%s\"", pRun->pEngine, pRun->pPhase );
+    if ( pRun->fSkipped )
+    {
+        fprintf( pFile, ", \"skipped\": true }" );
+        return;
+    }
+    fprintf( pFile, ", \"time\": %.6f", Time );
+    Gia_CutBenchWriteValue( pFile, "cuts", pRun->nCuts );
+    if ( Time > 0 )
+        fprintf( pFile, ", \"cuts_per_sec\": %.0f", (double)pRun->nCuts / Time );
+    else
+        fprintf( pFile, ", \"cuts_per_sec\": null" );
+    Gia_CutBenchWriteValue( pFile, "cut_bytes", pRun->nCutBytes );
+    Gia_CutBenchWriteValue( pFile, "bytes_per_cut", pRun->nBytesPerCut );
+    Gia_CutBenchWriteValue( pFile, "peak_kb", pRun->nPeakKb );
+    for ( i = 0; fPerf && i < GIA_BENCH_PERF_NUM; i++ )
+        Gia_CutBenchWriteValue( pFile, s_CutBenchCounters[i], pRun->fCounts[i] ? pRun->Counts[i] : ~(word)0 );
+    fprintf( pFile, " }" );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Benchmarks the cut engines on the corpus.]
+
+  Description [The corpus is the list of AIGER files or, if the list is
+  empty, the given AIG. The engines are given as a comma-separated list
+  of the names "sto", "if", "mf", "lf", and "kf" (NULL means all).
+  The JSON report is written into the file or printed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManCutBench( Gia_Man_t * pGia, Vec_Ptr_t * vFileNames, char * pEngines, int nLutSize, int nCutNum, int fPerf, char * pFileName, int fVerbose )
+{
+    Gia_CutBenchRun_t Run, * pRun = &Run;
+    Vec_Int_t * vEngines = Vec_IntAlloc( 8 );
+    Gia_Man_t * p;
+    FILE * pFile;
+    char * pName, * pTemp, * pCopy;
+    int i, k, iEngine, nDesigns, fFirst = 1;
+    // parse the engines
+    if ( pEngines == NULL )
+    {
+        for ( k = 0; s_CutBenchEngines[k]; k++ )
+            Vec_IntPush( vEngines, k );
+    }
+    else
+    {
+        pCopy = Abc_UtilStrsav( pEngines );
+        for ( pTemp = strtok( pCopy, ", " ); pTemp; pTemp = strtok( NULL, ", " ) )
+        {
+            for ( k = 0; s_CutBenchEngines[k]; k++ )
+                if ( !strcmp( pTemp, s_CutBenchEngines[k] ) )
+                    break;
+            if ( s_CutBenchEngines[k] == NULL )
+            {
+                printf( "Unknown cut engine \"%s\".\n", pTemp );
+                ABC_FREE( pCopy );
+                Vec_IntFree( vEngines );
+                return 0;
+            }
+            Vec_IntPushUnique( vEngines, k );
+        }
+        ABC_FREE( pCopy );
+    }
+    nDesigns = vFileNames && Vec_PtrSize(vFileNames) ? Vec_PtrSize(vFileNames) : 1;
+    if ( (vFileNames == NULL || Vec_PtrSize(vFileNames) == 0) && pGia == NULL )
+    {
+        printf( "There is no design to benchmark.\n" );
+        Vec_IntFree( vEngines );
+        return 0;
+    }
+    pFile = pFileName ? fopen( pFileName, "wb" ) : stdout;
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing.\n", pFileName );
+        Vec_IntFree( vEngines );
+        return 0;
+    }
+    fprintf( pFile, "{\n  \"params\": { \"K\": %d, \"C\": %d, \"perf\": %s },\n", nLutSize, nCutNum, fPerf ? "true" : "false" );
+    fprintf( pFile, "  \"results\": [" );
+    for ( i = 0; i < nDesigns; i++ )
+    {
+        pName = vFileNames && Vec_PtrSize(vFileNames) ? (char *)Vec_PtrEntry(vFileNames, i) : NULL;
+        p = pName ? Gia_AigerRead( pName, 0, 0, 0 ) : pGia;
+        if ( p == NULL )
+        {
+            printf( "Cannot read AIG from file \"%s\".\n", pName );
+            continue;
+        }
+        Vec_IntForEachEntry( vEngines, iEngine, k )
+        {
+            Gia_CutBenchRun( p, iEngine, nLutSize, nCutNum, fPerf, pRun );
+            Gia_CutBenchWriteRun( pFile, p, pName, pRun, fPerf, fFirst );
+            fFirst = 0;
+            fflush( pFile );
+            if ( fVerbose && pFile != stdout )
+            {
+                printf( "%-16s  %-4s : ", Gia_ManName(p) ? Gia_ManName(p) : "", pRun->pEngine );
+                if ( pRun->fSkipped )
+                    printf( "skipped\n" );
+                else
+                {
+                    printf( "Cuts = %10.0f  ", (double)pRun->nCuts );
+                    Abc_PrintTime( 1, "Time", pRun->Time );
+                }
+            }
+        }
+        if ( p != pGia )
+            Gia_ManStop( p );
+    }
+    fprintf( pFile, "\n  ]\n}\n" );
+    if ( pFile != stdout )
+        fclose( pFile );
+    Vec_IntFree( vEngines );
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -748,10 +748,14 @@ Gia_Man_t * Gia_ManDupWithAttributes( Gia_Man_t * p )
     Gia_Man_t * pNew = Gia_ManDup(p);
     Gia_ManTransferMapping( pNew, p );
     Gia_ManTransferPacking( pNew, p );
+    if ( p->vCellMapping )
+        pNew->vCellMapping = Vec_IntDup( p->vCellMapping );
     if ( p->pManTime )
         pNew->pManTime = Tim_ManDup( (Tim_Man_t *)p->pManTime, 0 );
     if ( p->pAigExtra )
         pNew->pAigExtra = Gia_ManDup( p->pAigExtra );
+    if ( p->pAigMapSrc )
+        pNew->pAigMapSrc = Gia_ManDupWithAttributes( p->pAigMapSrc );
     if ( p->nAnd2Delay )
         pNew->nAnd2Delay = p->nAnd2Delay;
     if ( p->vRegClasses )
@@ -0,0 +1,329 @@
+/**CFile****************************************************************
+
+  FileName    [giaHashPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Structural hashing that can be used by several threads.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaHashPar.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/util/utilPool.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define GIA_HASH_PAR_PROC_MAX   64        // the max number of threads
+#define GIA_HASH_PAR_TASKS       8        // the number of tasks per thread
+
+// the concurrent hash table
+//
+// the table uses open addressing with linear probing; a slot holds the key
+// (two fanin literals) and the ID of the node; the thread that claims an empty
+// slot by compare-and-swap on the key allocates the node and publishes its ID;
+// the other threads looking for the same key wait until the ID is published;
+// the objects are allocated by incrementing the object counter, so that the
+// fanins of a node always have smaller IDs than the node itself
+struct Gia_HashPar_t_
+{
+    Gia_Man_t *      p;             // the AIG under construction
+    int              nObjsMax;      // the number of reserved objects
+    int              nTableMask;    // the table size minus one
+    word *           pKeys;         // the fanin literals of the node
+    int *            pIds;          // the node IDs (0 if not published yet)
+};
+
+// parallel rehashing task
+typedef struct Gia_RehashTask_t_ Gia_RehashTask_t;
+struct Gia_RehashTask_t_
+{
+    Gia_Man_t *      p;             // the old AIG
+    Gia_HashPar_t *  pHash;         // the concurrent table of the new AIG
+    int              iStart;        // the first object
+    int              iStop;         // the object after the last one
+};
+
+#if defined(__GNUC__)
+static inline int      Gia_AtomicLoadInt( int * p )                         { return __atomic_load_n( p, __ATOMIC_ACQUIRE );                                  }
+static inline void     Gia_AtomicStoreInt( int * p, int Value )             { __atomic_store_n( p, Value, __ATOMIC_RELEASE );                                 }
+static inline int      Gia_AtomicAddInt( int * p, int Value )               { return __atomic_fetch_add( p, Value, __ATOMIC_ACQ_REL );                        }
+static inline unsigned Gia_AtomicLoadUns( unsigned * p )                    { return __atomic_load_n( p, __ATOMIC_ACQUIRE );                                  }
+static inline void     Gia_AtomicStoreUns( unsigned * p, unsigned Value )   { __atomic_store_n( p, Value, __ATOMIC_RELEASE );                                 }
+static inline word     Gia_AtomicLoadWord( word * p )                       { return __atomic_load_n( p, __ATOMIC_ACQUIRE );                                  }
+static inline int      Gia_AtomicCasWord( word * p, word * pOld, word New ) { return __atomic_compare_exchange_n( p, pOld, New, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ); }
+#if defined(__x86_64__) || defined(__i386__)
+static inline void     Gia_AtomicPause()                                    { __builtin_ia32_pause();                                                         }
+#elif defined(__aarch64__) || defined(__arm__)
+static inline void     Gia_AtomicPause()                                    { __asm__ __volatile__( "yield" );                                                }
+#else
+static inline void     Gia_AtomicPause()                                    {                                                                                 }
+#endif
+#else
+// without atomic operations the table can be used by one thread only
+static inline int      Gia_AtomicLoadInt( int * p )                         { return *p;                                                                      }
+static inline void     Gia_AtomicStoreInt( int * p, int Value )             { *p = Value;                                                                     }
+static inline int      Gia_AtomicAddInt( int * p, int Value )               { int Old = *p; *p += Value; return Old;                                          }
+static inline unsigned Gia_AtomicLoadUns( unsigned * p )                    { return *p;                                                                      }
+static inline void     Gia_AtomicStoreUns( unsigned * p, unsigned Value )   { *p = Value;                                                                     }
+static inline word     Gia_AtomicLoadWord( word * p )                       { return *p;                                                                      }
+static inline int      Gia_AtomicCasWord( word * p, word * pOld, word New ) { if ( *p != *pOld ) { *pOld = *p; return 0; } *p = New; return 1;                }
+static inline void     Gia_AtomicPause()                                    {                                                                                 }
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the concurrent hash table.]
+
+  Description [Reserves the storage for nObjsMax objects, so that the
+  object array is not reallocated while the threads add nodes. The AIG
+  should be a plain AIG without MUXes, fanouts or other node-based data.
+  Its existing AND nodes are not added to the table.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_HashPar_t * Gia_ManHashParStart( Gia_Man_t * p, int nObjsMax )
+{
+    Gia_HashPar_t * pHash;
+    int nTableSize = 1 << Abc_Base2Log( 2 * nObjsMax + 1 );
+    assert( p->pMuxes == NULL && p->pFanData == NULL && !p->fSweeper && !p->fBuiltInSim && p->vSuppWords == NULL );
+    assert( Vec_IntSize(&p->vHTable) == 0 );
+    if ( nObjsMax > (1 << 29) )
+        printf( "Hard limit on the number of nodes (2^29) is reached. Quitting...\n" ), exit(1);
+    if ( p->nObjsAlloc < nObjsMax )
+    {
+        p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjsMax );
+        memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjsMax - p->nObjsAlloc) );
+        p->nObjsAlloc = nObjsMax;
+    }
+    pHash = ABC_CALLOC( Gia_HashPar_t, 1 );
+    pHash->p          = p;
+    pHash->nObjsMax   = nObjsMax;
+    pHash->nTableMask = nTableSize - 1;
+    pHash->pKeys      = ABC_CALLOC( word, nTableSize );
+    pHash->pIds       = ABC_CALLOC( int, nTableSize );
+    return pHash;
+}
+void Gia_ManHashParStop( Gia_HashPar_t * pHash )
+{
+    ABC_FREE( pHash->pKeys );
+    ABC_FREE( pHash->pIds );
+    ABC_FREE( pHash );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the AND node or returns the existing one.]
+
+  Description [Can be called by several threads at the same time. The
+  fanin literals should point to the nodes returned by this procedure
+  or to the objects created before the threads were started.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Gia_ManHashParKey( word Key )
+{
+    Key ^= Key >> 29;
+    Key *= ABC_CONST(0x9E3779B97F4A7C15);
+    return (unsigned)(Key >> 32);
+}
+int Gia_ManHashParAnd( Gia_HashPar_t * pHash, int iLit0, int iLit1 )
+{
+    Gia_Man_t * p = pHash->p;
+    Gia_Obj_t * pObj;
+    word Key, Old;
+    int i, Id;
+    if ( iLit0 < 2 )
+        return iLit0 ? iLit1 : 0;
+    if ( iLit1 < 2 )
+        return iLit1 ? iLit0 : 0;
+    if ( iLit0 == iLit1 )
+        return iLit1;
+    if ( iLit0 == Abc_LitNot(iLit1) )
+        return 0;
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    Key = ((word)iLit0 << 32) | (word)iLit1;
+    for ( i = Gia_ManHashParKey(Key) & pHash->nTableMask; ; i = (i + 1) & pHash->nTableMask )
+    {
+        Old = Gia_AtomicLoadWord( pHash->pKeys + i );
+        if ( Old == 0 )
+        {
+            if ( !Gia_AtomicCasWord(pHash->pKeys + i, &Old, Key) && Old != Key )
+                continue; // another key was placed into this slot
+            if ( Old == 0 ) // this thread has claimed the slot
+            {
+                Id = Gia_AtomicAddInt( &p->nObjs, 1 );
+                if ( Id >= pHash->nObjsMax )
+                    printf( "Gia_ManHashParAnd(): The reserved object storage (%d) is exceeded. Quitting...\n", pHash->nObjsMax ), exit(1);
+                pObj = Gia_ManObj( p, Id );
+                pObj->iDiff0  = Id - Abc_Lit2Var(iLit0);
+                pObj->fCompl0 = Abc_LitIsCompl(iLit0);
+                pObj->iDiff1  = Id - Abc_Lit2Var(iLit1);
+                pObj->fCompl1 = Abc_LitIsCompl(iLit1);
+                Gia_AtomicStoreInt( pHash->pIds + i, Id );
+                return Abc_Var2Lit( Id, 0 );
+            }
+        }
+        if ( Old != Key )
+            continue;
+        // the node is being created by another thread
+        while ( (Id = Gia_AtomicLoadInt(pHash->pIds + i)) == 0 )
+            Gia_AtomicPause();
+        return Abc_Var2Lit( Id, 0 );
+    }
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rehashes the AIG using several threads.]
+
+  Description [The copies of the AND nodes are computed by the threads,
+  each starting from its own range of objects. The nodes shared by the
+  ranges are found in the concurrent table. After that, the nodes are
+  renumbered in the order, in which Gia_ManRehash() would create them,
+  so the result does not depend on the number of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+// computes the copy of the node and its TFI; uses an explicit stack
+// because the pool threads may have small stacks
+static void Gia_ManRehashPar_iter( Gia_HashPar_t * pHash, Gia_Man_t * p, int iRoot, Vec_Int_t * vStack )
+{
+    Gia_Obj_t * pObj;
+    unsigned Value0, Value1;
+    int iObj;
+    Vec_IntFill( vStack, 1, iRoot );
+    while ( Vec_IntSize(vStack) > 0 )
+    {
+        iObj = Vec_IntEntryLast( vStack );
+        pObj = Gia_ManObj( p, iObj );
+        if ( ~Gia_AtomicLoadUns(&pObj->Value) )
+        {
+            Vec_IntPop( vStack );
+            continue;
+        }
+        assert( Gia_ObjIsAnd(pObj) );
+        Value0 = Gia_AtomicLoadUns( &Gia_ObjFanin0(pObj)->Value );
+        Value1 = Gia_AtomicLoadUns( &Gia_ObjFanin1(pObj)->Value );
+        if ( !~Value0 )
+            Vec_IntPush( vStack, Gia_ObjFaninId0(pObj, iObj) );
+        if ( !~Value1 )
+            Vec_IntPush( vStack, Gia_ObjFaninId1(pObj, iObj) );
+        if ( !~Value0 || !~Value1 )
+            continue;
+        Vec_IntPop( vStack );
+        Gia_AtomicStoreUns( &pObj->Value, (unsigned)Gia_ManHashParAnd(pHash, Abc_LitNotCond((int)Value0, Gia_ObjFaninC0(pObj)), Abc_LitNotCond((int)Value1, Gia_ObjFaninC1(pObj))) );
+    }
+}
+static void Gia_ManRehashWorkerTask( void * pArg )
+{
+    Gia_RehashTask_t * pTask = (Gia_RehashTask_t *)pArg;
+    Vec_Int_t * vStack = Vec_IntAlloc( 1000 );
+    int i;
+    for ( i = pTask->iStart; i < pTask->iStop; i++ )
+        if ( Gia_ObjIsAnd(Gia_ManObj(pTask->p, i)) )
+            Gia_ManRehashPar_iter( pTask->pHash, pTask->p, i, vStack );
+    Vec_IntFree( vStack );
+}
+Gia_Man_t * Gia_ManRehashPar( Gia_Man_t * p, int nProcs )
+{
+    Gia_RehashTask_t Tasks[GIA_HASH_PAR_PROC_MAX * GIA_HASH_PAR_TASKS];
+    Gia_Man_t * pNew, * pTemp;
+    Gia_HashPar_t * pHash;
+    Gia_Obj_t * pObj, * pObjNew;
+    Util_Job_t * pJob;
+    int i, iObj, nTasks, * pMap;
+    nProcs = Abc_MinInt( nProcs, GIA_HASH_PAR_PROC_MAX );
+#if !defined(__GNUC__)
+    nProcs = 1;
+#endif
+    if ( nProcs <= 1 || p->pMuxes )
+        return Gia_ManRehash( p, 0 );
+    // compute the copies of all nodes in the temporary AIG
+    pTemp = Gia_ManStart( Gia_ManObjNum(p) );
+    Gia_ManFillValue( p );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pTemp );
+    pHash = Gia_ManHashParStart( pTemp, Gia_ManCiNum(p) + Gia_ManAndNum(p) + 1 );
+    nTasks = nProcs * GIA_HASH_PAR_TASKS;
+    pJob = Util_JobStart( Util_PoolGlobal() );
+    for ( i = 0; i < nTasks; i++ )
+    {
+        Tasks[i].p      = p;
+        Tasks[i].pHash  = pHash;
+        Tasks[i].iStart = (int)((word)Gia_ManObjNum(p) * i / nTasks);
+        Tasks[i].iStop  = (int)((word)Gia_ManObjNum(p) * (i + 1) / nTasks);
+        Util_JobSubmit( pJob, Gia_ManRehashWorkerTask, Tasks + i );
+    }
+    Util_JobWaitAll( pJob );
+    Util_JobStop( pJob );
+    Gia_ManHashParStop( pHash );
+    // create the nodes in the order of the first old node mapped into them
+    pMap = ABC_FALLOC( int, Gia_ManObjNum(pTemp) );
+    pMap[0] = 0;
+    pNew = Gia_ManStart( Gia_ManObjNum(pTemp) + Gia_ManCoNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Gia_ManForEachObj1( p, pObj, i )
+    {
+        if ( Gia_ObjIsCo(pObj) )
+        {
+            pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+            continue;
+        }
+        iObj = Abc_Lit2Var( pObj->Value );
+        if ( pMap[iObj] == -1 )
+        {
+            pObjNew = Gia_ManObj( pTemp, iObj );
+            if ( Gia_ObjIsCi(pObjNew) )
+                pMap[iObj] = Abc_Lit2Var( Gia_ManAppendCi(pNew) );
+            else
+                pMap[iObj] = Abc_Lit2Var( Gia_ManAppendAnd(pNew, Abc_Lit2LitV(pMap, Gia_ObjFaninLit0(pObjNew, iObj)), Abc_Lit2LitV(pMap, Gia_ObjFaninLit1(pObjNew, iObj))) );
+        }
+        pObj->Value = Abc_Lit2LitV( pMap, pObj->Value );
+    }
+    ABC_FREE( pMap );
+    Gia_ManStop( pTemp );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    pNew = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
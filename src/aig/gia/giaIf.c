@@ -67,6 +67,7 @@ void Gia_ManSetIfParsDefault( void * pp )
     p->nCutsMax    =  8;
     p->nFlowIters  =  1;
     p->nAreaIters  =  2;
+    p->nProcs      =  1;
     p->DelayTarget = -1;
     p->Epsilon     =  (float)0.005;
     p->fPreprocess =  1;
@@ -1972,6 +1973,48 @@ Gia_Man_t * Gia_ManFromIfLogic( If_Man_t * pIfMan )
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Expresses the LUT mapping in terms of the subject AIG.]
+
+  Description [Returns a copy of the AIG given to the mapper, annotated
+  with the selected LUTs. The IF objects have the same IDs as the AIG 
+  objects. If requested (fKeepSubject), the result is kept with the mapped
+  AIG, so that the mapping can be reused by incremental mapping of the 
+  subject AIG after edits.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManMappingSource( Gia_Man_t * p, If_Man_t * pIfMan )
+{
+    Gia_Man_t * pNew;
+    If_Obj_t * pIfObj, * pIfLeaf;
+    If_Cut_t * pCutBest;
+    Gia_Obj_t * pObj;
+    int i, k;
+    assert( If_ManObjNum(pIfMan) == Gia_ManObjNum(p) );
+    pNew = Gia_ManDup( p );
+    pNew->vMapping = Vec_IntStart( 2 * Gia_ManObjNum(pNew) );
+    Vec_IntShrink( pNew->vMapping, Gia_ManObjNum(pNew) );
+    Gia_ManForEachAnd( pNew, pObj, i )
+    {
+        pIfObj = If_ManObj( pIfMan, i );
+        if ( pIfObj->nRefs == 0 )
+            continue;
+        pCutBest = If_ObjCutBest( pIfObj );
+        Vec_IntWriteEntry( pNew->vMapping, i, Vec_IntSize(pNew->vMapping) );
+        Vec_IntPush( pNew->vMapping, If_CutLeaveNum(pCutBest) );
+        If_CutForEachLeaf( pIfMan, pCutBest, pIfLeaf, k )
+            Vec_IntPush( pNew->vMapping, If_ObjId(pIfLeaf) );
+        Vec_IntPush( pNew->vMapping, i );
+    }
+    Gia_ManMappingVerify( pNew );
+    return pNew;
+}
+
 
 /**Function*************************************************************
 
@@ -2298,6 +2341,9 @@ Gia_Man_t * Gia_ManPerformMappingInt( Gia_Man_t * p, If_Par_t * pPars )
         pNew = Gia_ManFromIfAig( pIfMan );
     else
         pNew = Gia_ManFromIfLogic( pIfMan );
+    // remember the mapping of the subject AIG, unless the LUTs may not cover the structure
+    if ( pPars->fKeepSubject && pNew && Gia_ManHasMapping(pNew) && !pPars->fCutMin && !Gia_ManHasChoices(p) && !p->pMuxes && !p->pManTime )
+        pNew->pAigMapSrc = Gia_ManMappingSource( p, pIfMan );
     if ( p->vCiArrs || p->vCoReqs )
     {
         If_Obj_t * pIfObj = NULL;
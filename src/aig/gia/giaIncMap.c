@@ -0,0 +1,1159 @@
+/**CFile****************************************************************
+
+  FileName    [giaIncMap.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Incremental LUT and standard-cell mapping after local edits.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaIncMap.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/vec/vecHash.h"
+#include "misc/st/st.h"
+#include "map/if/if.h"
+#include "map/mio/mio.h"
+#include "map/scl/sclCon.h"
+#include "base/main/main.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The old AIG carries a mapping (LUTs in vMapping or cells in vCellMapping).
+// The new AIG is derived from it by local edits. Each node of the new AIG
+// is paired with the old node playing the same role: bottom-up, the nodes
+// with the same structure are paired exactly; top-down, the nodes whose
+// structure above the edit is the same are paired even if their functions
+// changed. A LUT (cell) of the old mapping is reused for a new node if its
+// cone, traversed in lockstep with the old cone, has the same structure
+// down to the old leaves. The new nodes whose LUTs (cells) cannot be reused
+// form a window, which is remapped from scratch using the old arrival times
+// of its inputs and the old required times of its outputs.
+
+#define GIA_INC_ITER_MAX  4      // the max number of window mappings
+
+typedef struct Gia_Inc_t_ Gia_Inc_t;
+struct Gia_Inc_t_
+{
+    Gia_Man_t *     pOld;         // old AIG with the mapping (or NULL)
+    Gia_Man_t *     pNew;         // new AIG to be mapped
+    int             fCells;       // standard-cell mapping (otherwise, LUT mapping)
+    int             nLutSize;     // the largest LUT size
+    int             fVerbose;     // verbose output
+    Mio_Cell2_t *   pCells;       // library cells
+    int             nCells;       // library cell count
+    int             InvDelay;     // inverter delay
+    Vec_Int_t *     vNew2Old;     // old node paired with each new node
+    Vec_Int_t *     vOld2New;     // new node paired exactly with each old node
+    Vec_Str_t *     vForced;      // new nodes to be remapped unconditionally
+    Vec_Int_t *     vKeep;        // reused LUT/cell of each new node/literal (0 = unknown; -1 = none)
+    Vec_Int_t *     vStore;       // storage for the reused LUTs/cells
+    Vec_Int_t *     vLock;        // old node matched with each new node in the cone
+    Vec_Int_t *     vLeaf;        // new node matched with each old leaf of the cone
+    Vec_Wrd_t *     vTruth;       // truth tables of the new nodes in the cone
+    Vec_Int_t *     vArrs;        // old arrival times of nodes/literals
+    Vec_Int_t *     vReqs;        // old required times of nodes/literals
+    Vec_Int_t *     vMapping;     // resulting mapping
+    Vec_Str_t *     vVisit;       // needed new nodes/literals
+    Vec_Str_t *     vWinMark;     // window membership (1 = input; 2 = node)
+    Vec_Int_t *     vStack;       // needed new nodes/literals to be processed
+    Vec_Int_t *     vWinIns;      // window inputs
+    Vec_Int_t *     vWinNodes;    // window nodes
+    Vec_Int_t *     vWinOuts;     // window outputs (nodes or literals)
+    Vec_Int_t *     vWinRefs;     // literals of window inputs used by the window mapping
+    Vec_Int_t *     vWin2New;     // new node of each window object
+    Vec_Int_t *     vWinDone;     // literals of window inputs implemented after the window mapping
+    int             fRetimed;     // the timing is computed for the new AIG
+    // statistics
+    int             DelayOld;     // delay of the old mapping
+    int             nExact;       // new nodes paired exactly
+    int             nPaired;      // new nodes paired top-down
+    int             nReused;      // reused LUTs/cells
+    int             nRemapped;    // LUTs/cells derived for the window
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_Inc_t * Gia_IncStart( Gia_Man_t * pOld, Gia_Man_t * pNew, int fCells )
+{
+    Gia_Inc_t * p = ABC_CALLOC( Gia_Inc_t, 1 );
+    int nItems = fCells ? 2 * Gia_ManObjNum(pNew) : Gia_ManObjNum(pNew);
+    p->pOld      = pOld;
+    p->pNew      = pNew;
+    p->fCells    = fCells;
+    p->vNew2Old  = Vec_IntStartFull( Gia_ManObjNum(pNew) );
+    p->vOld2New  = Vec_IntStartFull( pOld ? Gia_ManObjNum(pOld) : 0 );
+    p->vForced   = Vec_StrStart( Gia_ManObjNum(pNew) );
+    p->vKeep     = Vec_IntStart( nItems );
+    p->vStore    = Vec_IntAlloc( 1000 );
+    p->vLock     = Vec_IntStartFull( Gia_ManObjNum(pNew) );
+    p->vLeaf     = Vec_IntStartFull( pOld ? Gia_ManObjNum(pOld) : 0 );
+    p->vTruth    = Vec_WrdStart( fCells ? Gia_ManObjNum(pNew) : 0 );
+    p->vMapping  = Vec_IntStart( nItems );
+    p->vVisit    = Vec_StrStart( nItems );
+    p->vWinMark  = Vec_StrStart( Gia_ManObjNum(pNew) );
+    p->vStack    = Vec_IntAlloc( 1000 );
+    p->vWinIns   = Vec_IntAlloc( 1000 );
+    p->vWinNodes = Vec_IntAlloc( 1000 );
+    p->vWinOuts  = Vec_IntAlloc( 1000 );
+    p->vWinRefs  = Vec_IntAlloc( 1000 );
+    p->vWin2New  = Vec_IntAlloc( 1000 );
+    p->vWinDone  = Vec_IntAlloc( 1000 );
+    return p;
+}
+static void Gia_IncStop( Gia_Inc_t * p )
+{
+    Vec_IntFree( p->vNew2Old );
+    Vec_IntFree( p->vOld2New );
+    Vec_StrFree( p->vForced );
+    Vec_IntFree( p->vKeep );
+    Vec_IntFree( p->vStore );
+    Vec_IntFree( p->vLock );
+    Vec_IntFree( p->vLeaf );
+    Vec_WrdFree( p->vTruth );
+    Vec_IntFreeP( &p->vArrs );
+    Vec_IntFreeP( &p->vReqs );
+    Vec_IntFreeP( &p->vMapping );
+    Vec_StrFree( p->vVisit );
+    Vec_StrFree( p->vWinMark );
+    Vec_IntFree( p->vStack );
+    Vec_IntFree( p->vWinIns );
+    Vec_IntFree( p->vWinNodes );
+    Vec_IntFree( p->vWinOuts );
+    Vec_IntFree( p->vWinRefs );
+    Vec_IntFree( p->vWin2New );
+    Vec_IntFree( p->vWinDone );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decides how the fanins of the paired nodes correspond.]
+
+  Description [Returns 0 if fanin 0 (1) of the new node corresponds to
+  fanin 0 (1) of the old node, 1 if the fanins are swapped, and -1 if
+  the complemented attributes do not agree.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_IncFaninOrder( Gia_Inc_t * p, int iNew, int iOld )
+{
+    Gia_Obj_t * pNew = Gia_ManObj( p->pNew, iNew );
+    Gia_Obj_t * pOld = Gia_ManObj( p->pOld, iOld );
+    int fStraight = Gia_ObjFaninC0(pNew) == Gia_ObjFaninC0(pOld) && Gia_ObjFaninC1(pNew) == Gia_ObjFaninC1(pOld);
+    int fSwapped  = Gia_ObjFaninC0(pNew) == Gia_ObjFaninC1(pOld) && Gia_ObjFaninC1(pNew) == Gia_ObjFaninC0(pOld);
+    if ( fStraight && fSwapped )
+    {
+        int iNew0 = Gia_ObjFaninId0(pNew, iNew), iNew1 = Gia_ObjFaninId1(pNew, iNew);
+        int iOld0 = Gia_ObjFaninId0(pOld, iOld), iOld1 = Gia_ObjFaninId1(pOld, iOld);
+        if ( Vec_IntEntry(p->vNew2Old, iNew0) == iOld0 || Vec_IntEntry(p->vNew2Old, iNew1) == iOld1 )
+            return 0;
+        if ( Vec_IntEntry(p->vNew2Old, iNew0) == iOld1 || Vec_IntEntry(p->vNew2Old, iNew1) == iOld0 )
+            return 1;
+        return 0;
+    }
+    return fStraight ? 0 : (fSwapped ? 1 : -1);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Pairs the nodes of the new AIG with the nodes of the old AIG.]
+
+  Description [The CIs are paired by index. The AND nodes are paired
+  exactly, bottom-up, using structural hashing of the old AIG. The AND
+  nodes left unpaired are paired top-down, starting from the COs, as long
+  as the complemented attributes of the fanins agree.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_IncPair( Gia_Inc_t * p, int iNew, int iOld )
+{
+    if ( Vec_IntEntry(p->vNew2Old, iNew) >= 0 )
+        return;
+    if ( !Gia_ObjIsAnd(Gia_ManObj(p->pNew, iNew)) || !Gia_ObjIsAnd(Gia_ManObj(p->pOld, iOld)) )
+        return;
+    Vec_IntWriteEntry( p->vNew2Old, iNew, iOld );
+    p->nPaired++;
+}
+static void Gia_IncPairNodes( Gia_Inc_t * p )
+{
+    Hash_IntMan_t * pHash;
+    Gia_Obj_t * pObj;
+    int i, iOld, iLit0, iLit1, fSwap, * pPlace;
+    Vec_IntWriteEntry( p->vNew2Old, 0, 0 );
+    if ( p->pOld == NULL )
+        return;
+    Vec_IntWriteEntry( p->vOld2New, 0, 0 );
+    Gia_ManForEachCi( p->pNew, pObj, i )
+    {
+        Vec_IntWriteEntry( p->vNew2Old, Gia_ObjId(p->pNew, pObj), Gia_ObjId(p->pOld, Gia_ManCi(p->pOld, i)) );
+        Vec_IntWriteEntry( p->vOld2New, Gia_ObjId(p->pOld, Gia_ManCi(p->pOld, i)), Gia_ObjId(p->pNew, pObj) );
+    }
+    // pair the nodes bottom-up
+    pHash = Hash_IntManStart( Gia_ManAndNum(p->pOld) );
+    Gia_ManForEachAnd( p->pOld, pObj, i )
+    {
+        iLit0 = Gia_ObjFaninLit0( pObj, i );
+        iLit1 = Gia_ObjFaninLit1( pObj, i );
+        Hash_Int2ManInsert( pHash, Abc_MinInt(iLit0, iLit1), Abc_MaxInt(iLit0, iLit1), i );
+    }
+    Gia_ManForEachAnd( p->pNew, pObj, i )
+    {
+        int iOld0 = Vec_IntEntry( p->vNew2Old, Gia_ObjFaninId0(pObj, i) );
+        int iOld1 = Vec_IntEntry( p->vNew2Old, Gia_ObjFaninId1(pObj, i) );
+        if ( iOld0 == -1 || iOld1 == -1 || Vec_StrEntry(p->vForced, Gia_ObjFaninId0(pObj, i)) || Vec_StrEntry(p->vForced, Gia_ObjFaninId1(pObj, i)) )
+            continue;
+        iLit0 = Abc_Var2Lit( iOld0, Gia_ObjFaninC0(pObj) );
+        iLit1 = Abc_Var2Lit( iOld1, Gia_ObjFaninC1(pObj) );
+        pPlace = Hash_Int2ManLookup( pHash, Abc_MinInt(iLit0, iLit1), Abc_MaxInt(iLit0, iLit1) );
+        if ( *pPlace == 0 )
+            continue;
+        Vec_IntWriteEntry( p->vNew2Old, i, Hash_IntObjData2(pHash, *pPlace) );
+        Vec_IntWriteEntry( p->vOld2New, Hash_IntObjData2(pHash, *pPlace), i );
+        p->nExact++;
+    }
+    Hash_IntManStop( pHash );
+    // pair the remaining nodes top-down
+    Gia_ManForEachCo( p->pNew, pObj, i )
+        if ( Gia_ObjFaninC0(pObj) == Gia_ObjFaninC0(Gia_ManCo(p->pOld, i)) )
+            Gia_IncPair( p, Gia_ObjFaninId0p(p->pNew, pObj), Gia_ObjFaninId0p(p->pOld, Gia_ManCo(p->pOld, i)) );
+    Gia_ManForEachAndReverse( p->pNew, pObj, i )
+    {
+        Gia_Obj_t * pObjOld;
+        if ( (iOld = Vec_IntEntry(p->vNew2Old, i)) == -1 )
+            continue;
+        pObjOld = Gia_ManObj( p->pOld, iOld );
+        if ( (fSwap = Gia_IncFaninOrder(p, i, iOld)) == -1 )
+            continue;
+        Gia_IncPair( p, Gia_ObjFaninId0(pObj, i), fSwap ? Gia_ObjFaninId1(pObjOld, iOld) : Gia_ObjFaninId0(pObjOld, iOld) );
+        Gia_IncPair( p, Gia_ObjFaninId1(pObj, i), fSwap ? Gia_ObjFaninId0(pObjOld, iOld) : Gia_ObjFaninId1(pObjOld, iOld) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Matches the cone of the new node with the cone of the old node.]
+
+  Description [The leaves of the old cone are labeled with the current
+  traversal ID of the old AIG. Records the new node matched with each old
+  leaf. Fails if the structure differs, if a forced node is encountered,
+  or if an old leaf is matched with two different new nodes. If the new
+  node is paired exactly, its fanin cone is the same as in the old AIG and
+  the leaves are translated directly. This also covers the LUTs (cells)
+  whose leaves were reduced to the functional support by the mapper.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_IncIsExact( Gia_Inc_t * p, int iNew, int iOld )
+{
+    return Vec_IntEntry(p->vOld2New, iOld) == iNew && !Vec_StrEntry(p->vForced, iNew);
+}
+static int Gia_IncMatchCone_rec( Gia_Inc_t * p, int iNew, int iOld )
+{
+    int fSwap;
+    if ( Gia_ObjIsTravIdCurrentId(p->pOld, iOld) )
+    {
+        if ( iNew == 0 )
+            return 0;
+        if ( Vec_IntEntry(p->vLeaf, iOld) == -1 )
+            Vec_IntWriteEntry( p->vLeaf, iOld, iNew );
+        return Vec_IntEntry(p->vLeaf, iOld) == iNew;
+    }
+    if ( Gia_ObjIsTravIdCurrentId(p->pNew, iNew) )
+        return Vec_IntEntry(p->vLock, iNew) == iOld;
+    Gia_ObjSetTravIdCurrentId( p->pNew, iNew );
+    Vec_IntWriteEntry( p->vLock, iNew, iOld );
+    if ( !Gia_ObjIsAnd(Gia_ManObj(p->pNew, iNew)) || !Gia_ObjIsAnd(Gia_ManObj(p->pOld, iOld)) || Vec_StrEntry(p->vForced, iNew) )
+        return 0;
+    if ( (fSwap = Gia_IncFaninOrder(p, iNew, iOld)) == -1 )
+        return 0;
+    if ( !Gia_IncMatchCone_rec(p, Gia_ObjFaninId0(Gia_ManObj(p->pNew, iNew), iNew), fSwap ? Gia_ObjFaninId1(Gia_ManObj(p->pOld, iOld), iOld) : Gia_ObjFaninId0(Gia_ManObj(p->pOld, iOld), iOld)) )
+        return 0;
+    return Gia_IncMatchCone_rec( p, Gia_ObjFaninId1(Gia_ManObj(p->pNew, iNew), iNew), fSwap ? Gia_ObjFaninId0(Gia_ManObj(p->pOld, iOld), iOld) : Gia_ObjFaninId1(Gia_ManObj(p->pOld, iOld), iOld) );
+}
+static int Gia_IncMatchCone( Gia_Inc_t * p, int iNew, int iOld, int * pLeaves, int nLeaves, int fLits )
+{
+    int k, iOld2, RetValue;
+    if ( Gia_IncIsExact(p, iNew, iOld) )
+    {
+        for ( k = 0; k < nLeaves; k++ )
+        {
+            iOld2 = fLits ? Abc_Lit2Var(pLeaves[k]) : pLeaves[k];
+            if ( Vec_IntEntry(p->vOld2New, iOld2) == -1 )
+                return 0;
+            Vec_IntWriteEntry( p->vLeaf, iOld2, Vec_IntEntry(p->vOld2New, iOld2) );
+        }
+        return 1;
+    }
+    Gia_ManIncrementTravId( p->pOld );
+    Gia_ManIncrementTravId( p->pNew );
+    for ( k = 0; k < nLeaves; k++ )
+        Gia_ObjSetTravIdCurrentId( p->pOld, fLits ? Abc_Lit2Var(pLeaves[k]) : pLeaves[k] );
+    RetValue = Gia_IncMatchCone_rec( p, iNew, iOld );
+    // cell pins cannot be dropped
+    for ( k = 0; RetValue && fLits && k < nLeaves; k++ )
+        if ( Vec_IntEntry(p->vLeaf, Abc_Lit2Var(pLeaves[k])) == -1 )
+            RetValue = 0;
+    return RetValue;
+}
+static void Gia_IncMatchConeClean( Gia_Inc_t * p, int * pLeaves, int nLeaves, int fLits )
+{
+    int k;
+    for ( k = 0; k < nLeaves; k++ )
+        Vec_IntWriteEntry( p->vLeaf, fLits ? Abc_Lit2Var(pLeaves[k]) : pLeaves[k], -1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the function of the matched new cone.]
+
+  Description [The new leaves are taken from the last matching. The
+  truth table is expressed in terms of the cell pins, so that it can
+  be compared with the cell function. This check is needed because
+  the old cell may implement its node only in the context of the old
+  AIG, while the functions of the leaves of the matched cone may have
+  changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Gia_IncConeTruth_rec( Gia_Inc_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pNew, iObj );
+    word uTruth0, uTruth1;
+    if ( Gia_ObjIsTravIdCurrentId(p->pNew, iObj) )
+        return Vec_WrdEntry( p->vTruth, iObj );
+    Gia_ObjSetTravIdCurrentId( p->pNew, iObj );
+    assert( Gia_ObjIsAnd(pObj) );
+    uTruth0 = Gia_IncConeTruth_rec( p, Gia_ObjFaninId0(pObj, iObj) );
+    uTruth1 = Gia_IncConeTruth_rec( p, Gia_ObjFaninId1(pObj, iObj) );
+    uTruth0 = Gia_ObjFaninC0(pObj) ? ~uTruth0 : uTruth0;
+    uTruth1 = Gia_ObjFaninC1(pObj) ? ~uTruth1 : uTruth1;
+    Vec_WrdWriteEntry( p->vTruth, iObj, uTruth0 & uTruth1 );
+    return uTruth0 & uTruth1;
+}
+static word Gia_IncConeTruth( Gia_Inc_t * p, int iLit, int * pLeaves, int nLeaves )
+{
+    int k, iLeaf;
+    word uTruth;
+    Gia_ManIncrementTravId( p->pNew );
+    for ( k = 0; k < nLeaves; k++ )
+    {
+        iLeaf = Vec_IntEntry( p->vLeaf, Abc_Lit2Var(pLeaves[k]) );
+        Gia_ObjSetTravIdCurrentId( p->pNew, iLeaf );
+        Vec_WrdWriteEntry( p->vTruth, iLeaf, Abc_LitIsCompl(pLeaves[k]) ? ~s_Truths6[k] : s_Truths6[k] );
+    }
+    uTruth = Gia_IncConeTruth_rec( p, Abc_Lit2Var(iLit) );
+    return Abc_LitIsCompl(iLit) ? ~uTruth : uTruth;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks whether the old LUT (cell) can be reused.]
+
+  Description [The result is computed on demand and cached. The reused
+  LUT (cell) is translated to the new AIG and saved in the storage.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_IncKeepLut( Gia_Inc_t * p, int iNew )
+{
+    int k, iOld, nLeaves, * pLeaves, RetValue;
+    if ( Vec_IntEntry(p->vKeep, iNew) )
+        return Vec_IntEntry(p->vKeep, iNew) > 0;
+    Vec_IntWriteEntry( p->vKeep, iNew, -1 );
+    iOld = Vec_IntEntry( p->vNew2Old, iNew );
+    if ( iOld <= 0 || !Gia_ObjIsAnd(Gia_ManObj(p->pOld, iOld)) || !Gia_ObjIsLut(p->pOld, iOld) )
+        return 0;
+    nLeaves = Gia_ObjLutSize( p->pOld, iOld );
+    pLeaves = Gia_ObjLutFanins( p->pOld, iOld );
+    if ( nLeaves > p->nLutSize )
+        return 0;
+    RetValue = Gia_IncMatchCone( p, iNew, iOld, pLeaves, nLeaves, 0 );
+    if ( RetValue )
+    {
+        int iStart = Vec_IntSize( p->vStore );
+        Vec_IntWriteEntry( p->vKeep, iNew, 1 + iStart );
+        Vec_IntPush( p->vStore, 0 );
+        for ( k = 0; k < nLeaves; k++ )
+            if ( Vec_IntEntry(p->vLeaf, pLeaves[k]) >= 0 )
+                Vec_IntPush( p->vStore, Vec_IntEntry(p->vLeaf, pLeaves[k]) );
+        Vec_IntWriteEntry( p->vStore, iStart, Vec_IntSize(p->vStore) - iStart - 1 );
+    }
+    Gia_IncMatchConeClean( p, pLeaves, nLeaves, 0 );
+    return RetValue;
+}
+static int Gia_IncKeepCell( Gia_Inc_t * p, int iLit )
+{
+    int k, iOld, iOldLit, nLeaves, * pLeaves, RetValue;
+    if ( Vec_IntEntry(p->vKeep, iLit) )
+        return Vec_IntEntry(p->vKeep, iLit) > 0;
+    Vec_IntWriteEntry( p->vKeep, iLit, -1 );
+    iOld = Vec_IntEntry( p->vNew2Old, Abc_Lit2Var(iLit) );
+    if ( iOld <= 0 || !Gia_ObjIsAnd(Gia_ManObj(p->pOld, iOld)) )
+        return 0;
+    iOldLit = Abc_Var2Lit( iOld, Abc_LitIsCompl(iLit) );
+    if ( Vec_IntEntry(p->pOld->vCellMapping, iOldLit) <= 0 || Gia_ObjCellId(p->pOld, iOldLit) >= p->nCells )
+        return 0;
+    nLeaves = Gia_ObjCellSize( p->pOld, iOldLit );
+    pLeaves = Gia_ObjCellFanins( p->pOld, iOldLit );
+    RetValue = Gia_IncMatchCone( p, Abc_Lit2Var(iLit), iOld, pLeaves, nLeaves, 1 );
+    if ( RetValue && !Gia_IncIsExact(p, Abc_Lit2Var(iLit), iOld) )
+        RetValue = Gia_IncConeTruth(p, iLit, pLeaves, nLeaves) == p->pCells[Gia_ObjCellId(p->pOld, iOldLit)].uTruth;
+    if ( RetValue )
+    {
+        Vec_IntWriteEntry( p->vKeep, iLit, 1 + Vec_IntSize(p->vStore) );
+        Vec_IntPush( p->vStore, nLeaves );
+        for ( k = 0; k < nLeaves; k++ )
+            Vec_IntPush( p->vStore, Abc_Var2Lit(Vec_IntEntry(p->vLeaf, Abc_Lit2Var(pLeaves[k])), Abc_LitIsCompl(pLeaves[k])) );
+        Vec_IntPush( p->vStore, Gia_ObjCellId(p->pOld, iOldLit) );
+    }
+    Gia_IncMatchConeClean( p, pLeaves, nLeaves, 1 );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes arrival and required times of the mapping.]
+
+  Description [Uses the unit-delay model for the LUTs and the pin-to-pin
+  delays of the library cells. The arrival times are computed for all
+  mapped nodes (literals). If vReqs is given, the required times are
+  computed for the given delay.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_IncCiArrival( Gia_Inc_t * p, int iCi )
+{
+    if ( p->fCells )
+        return p->pNew->vInArrs ? Scl_Flt2Int(Vec_FltEntry(p->pNew->vInArrs, iCi)) : 0;
+    return p->pNew->vCiArrs ? Vec_IntEntry(p->pNew->vCiArrs, iCi) : 0;
+}
+static int Gia_IncComputeArrivals( Gia_Inc_t * p, Gia_Man_t * pGia, Vec_Int_t * vArrs )
+{
+    Gia_Obj_t * pObj;
+    int i, k, c, iLit, iFan, Arr, Delay = 0;
+    if ( !p->fCells )
+    {
+        Vec_IntFill( vArrs, Gia_ManObjNum(pGia), 0 );
+        Gia_ManForEachCi( pGia, pObj, i )
+            Vec_IntWriteEntry( vArrs, Gia_ObjId(pGia, pObj), Gia_IncCiArrival(p, i) );
+        Gia_ManForEachLut( pGia, i )
+        {
+            Arr = 0;
+            Gia_LutForEachFanin( pGia, i, iFan, k )
+                Arr = Abc_MaxInt( Arr, Vec_IntEntry(vArrs, iFan) );
+            Vec_IntWriteEntry( vArrs, i, Arr + 1 );
+        }
+        Gia_ManForEachCo( pGia, pObj, i )
+            Delay = Abc_MaxInt( Delay, Vec_IntEntry(vArrs, Gia_ObjFaninId0p(pGia, pObj)) );
+        return Delay;
+    }
+    Vec_IntFill( vArrs, 2 * Gia_ManObjNum(pGia), 0 );
+    Gia_ManForEachCi( pGia, pObj, i )
+    {
+        Vec_IntWriteEntry( vArrs, Abc_Var2Lit(Gia_ObjId(pGia, pObj), 0), Gia_IncCiArrival(p, i) );
+        Vec_IntWriteEntry( vArrs, Abc_Var2Lit(Gia_ObjId(pGia, pObj), 1), Gia_IncCiArrival(p, i) + p->InvDelay );
+    }
+    Gia_ManForEachAndId( pGia, i )
+    {
+        for ( c = 0; c < 2; c++ )
+        {
+            if ( Vec_IntEntry(pGia->vCellMapping, (iLit = Abc_Var2Lit(i, c))) <= 0 )
+                continue;
+            Arr = 0;
+            Gia_CellForEachFanin( pGia, iLit, iFan, k )
+                Arr = Abc_MaxInt( Arr, Vec_IntEntry(vArrs, iFan) + p->pCells[Gia_ObjCellId(pGia, iLit)].iDelays[k] );
+            Vec_IntWriteEntry( vArrs, iLit, Arr );
+        }
+        for ( c = 0; c < 2; c++ )
+            if ( Gia_ObjIsCellInv(pGia, (iLit = Abc_Var2Lit(i, c))) )
+                Vec_IntWriteEntry( vArrs, iLit, Vec_IntEntry(vArrs, Abc_LitNot(iLit)) + p->InvDelay );
+    }
+    Gia_ManForEachCo( pGia, pObj, i )
+        if ( Gia_ObjFaninId0p(pGia, pObj) > 0 )
+            Delay = Abc_MaxInt( Delay, Vec_IntEntry(vArrs, Gia_ObjFaninLit0p(pGia, pObj)) );
+    return Delay;
+}
+static void Gia_IncComputeRequireds( Gia_Inc_t * p, Gia_Man_t * pGia, int Delay, Vec_Int_t * vReqs )
+{
+    Gia_Obj_t * pObj;
+    int i, k, c, iLit, iFan, Req;
+    if ( !p->fCells )
+    {
+        Vec_IntFill( vReqs, Gia_ManObjNum(pGia), ABC_INFINITY );
+        Gia_ManForEachCo( pGia, pObj, i )
+            Vec_IntWriteEntry( vReqs, Gia_ObjFaninId0p(pGia, pObj), Delay );
+        Gia_ManForEachLutReverse( pGia, i )
+            if ( (Req = Vec_IntEntry(vReqs, i)) < ABC_INFINITY )
+                Gia_LutForEachFanin( pGia, i, iFan, k )
+                    Vec_IntWriteEntry( vReqs, iFan, Abc_MinInt(Vec_IntEntry(vReqs, iFan), Req - 1) );
+        return;
+    }
+    Vec_IntFill( vReqs, 2 * Gia_ManObjNum(pGia), ABC_INFINITY );
+    Gia_ManForEachCo( pGia, pObj, i )
+        Vec_IntWriteEntry( vReqs, Gia_ObjFaninLit0p(pGia, pObj), Delay );
+    Gia_ManForEachAndReverseId( pGia, i )
+    {
+        for ( c = 0; c < 2; c++ )
+            if ( Gia_ObjIsCellInv(pGia, (iLit = Abc_Var2Lit(i, c))) && (Req = Vec_IntEntry(vReqs, iLit)) < ABC_INFINITY )
+                Vec_IntWriteEntry( vReqs, Abc_LitNot(iLit), Abc_MinInt(Vec_IntEntry(vReqs, Abc_LitNot(iLit)), Req - p->InvDelay) );
+        for ( c = 0; c < 2; c++ )
+        {
+            if ( Vec_IntEntry(pGia->vCellMapping, (iLit = Abc_Var2Lit(i, c))) <= 0 || (Req = Vec_IntEntry(vReqs, iLit)) == ABC_INFINITY )
+                continue;
+            Gia_CellForEachFanin( pGia, iLit, iFan, k )
+                Vec_IntWriteEntry( vReqs, iFan, Abc_MinInt(Vec_IntEntry(vReqs, iFan), Req - p->pCells[Gia_ObjCellId(pGia, iLit)].iDelays[k]) );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the reused LUTs and the window for LUT mapping.]
+
+  Description [Traverses the needed nodes starting from the CO drivers.
+  A needed node with a reused LUT is mapped with it and its leaves become
+  needed. A needed node without a reused LUT becomes a window output and
+  the window is extended into its TFI until the nodes with reused LUTs
+  and the CIs are reached. These become window inputs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_IncNeedNode( Gia_Inc_t * p, int iObj )
+{
+    if ( iObj == 0 || Gia_ObjIsCi(Gia_ManObj(p->pNew, iObj)) || Vec_StrEntry(p->vVisit, iObj) )
+        return;
+    Vec_StrWriteEntry( p->vVisit, iObj, 1 );
+    Vec_IntPush( p->vStack, iObj );
+}
+static void Gia_IncAddWindowLut( Gia_Inc_t * p, int iObj )
+{
+    Gia_Obj_t * pObj;
+    int i, k, iFan;
+    if ( Vec_StrEntry(p->vWinMark, iObj) )
+        return;
+    Vec_StrWriteEntry( p->vWinMark, iObj, 2 );
+    for ( i = Vec_IntSize(p->vWinNodes), Vec_IntPush(p->vWinNodes, iObj); i < Vec_IntSize(p->vWinNodes); i++ )
+    {
+        iObj = Vec_IntEntry( p->vWinNodes, i );
+        pObj = Gia_ManObj( p->pNew, iObj );
+        for ( k = 0; k < 2; k++ )
+        {
+            iFan = k ? Gia_ObjFaninId1(pObj, iObj) : Gia_ObjFaninId0(pObj, iObj);
+            if ( iFan == 0 || Vec_StrEntry(p->vWinMark, iFan) )
+                continue;
+            if ( Gia_ObjIsCi(Gia_ManObj(p->pNew, iFan)) || Gia_IncKeepLut(p, iFan) )
+            {
+                Vec_StrWriteEntry( p->vWinMark, iFan, 1 );
+                Vec_IntPush( p->vWinIns, iFan );
+                Gia_IncNeedNode( p, iFan );
+                continue;
+            }
+            Vec_StrWriteEntry( p->vWinMark, iFan, 2 );
+            Vec_IntPush( p->vWinNodes, iFan );
+        }
+    }
+}
+static void Gia_IncCollectLut( Gia_Inc_t * p )
+{
+    Gia_Obj_t * pObj;
+    int i, k, iObj, * pLut;
+    Gia_ManForEachCo( p->pNew, pObj, i )
+        Gia_IncNeedNode( p, Gia_ObjFaninId0p(p->pNew, pObj) );
+    while ( Vec_IntSize(p->vStack) > 0 )
+    {
+        iObj = Vec_IntPop( p->vStack );
+        if ( !Gia_IncKeepLut(p, iObj) )
+        {
+            Vec_IntPush( p->vWinOuts, iObj );
+            Gia_IncAddWindowLut( p, iObj );
+            continue;
+        }
+        pLut = Vec_IntEntryP( p->vStore, Vec_IntEntry(p->vKeep, iObj) - 1 );
+        Vec_IntWriteEntry( p->vMapping, iObj, Vec_IntSize(p->vMapping) );
+        Vec_IntPush( p->vMapping, pLut[0] );
+        for ( k = 1; k <= pLut[0]; k++ )
+        {
+            Vec_IntPush( p->vMapping, pLut[k] );
+            Gia_IncNeedNode( p, pLut[k] );
+        }
+        Vec_IntPush( p->vMapping, iObj );
+        p->nReused++;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the reused cells and the window for cell mapping.]
+
+  Description [Works similarly to the LUT case but traverses literals.
+  A needed literal is implemented by a reused cell, or by an inverter
+  if the opposite literal has a reused cell, or becomes a window output.
+  The window inputs are the nodes with a reused cell in either phase and
+  the CIs. One phase of each window input is needed right away; the other
+  phase, if used by the window mapping, is added later as an inverter.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_IncNeedLit( Gia_Inc_t * p, int iLit )
+{
+    if ( Abc_Lit2Var(iLit) == 0 || Vec_StrEntry(p->vVisit, iLit) )
+        return;
+    Vec_StrWriteEntry( p->vVisit, iLit, 1 );
+    if ( Gia_ObjIsCi(Gia_ManObj(p->pNew, Abc_Lit2Var(iLit))) )
+    {
+        if ( Abc_LitIsCompl(iLit) )
+            Vec_IntWriteEntry( p->vMapping, iLit, -1 );
+        return;
+    }
+    Vec_IntPush( p->vStack, iLit );
+}
+static void Gia_IncAddWindowCell( Gia_Inc_t * p, int iObj )
+{
+    Gia_Obj_t * pObj;
+    int i, k, iFan;
+    if ( Vec_StrEntry(p->vWinMark, iObj) )
+        return;
+    Vec_StrWriteEntry( p->vWinMark, iObj, 2 );
+    for ( i = Vec_IntSize(p->vWinNodes), Vec_IntPush(p->vWinNodes, iObj); i < Vec_IntSize(p->vWinNodes); i++ )
+    {
+        iObj = Vec_IntEntry( p->vWinNodes, i );
+        pObj = Gia_ManObj( p->pNew, iObj );
+        for ( k = 0; k < 2; k++ )
+        {
+            iFan = k ? Gia_ObjFaninId1(pObj, iObj) : Gia_ObjFaninId0(pObj, iObj);
+            if ( iFan == 0 || Vec_StrEntry(p->vWinMark, iFan) )
+                continue;
+            if ( Gia_ObjIsCi(Gia_ManObj(p->pNew, iFan)) || Gia_IncKeepCell(p, Abc_Var2Lit(iFan, 0)) || Gia_IncKeepCell(p, Abc_Var2Lit(iFan, 1)) )
+            {
+                Vec_StrWriteEntry( p->vWinMark, iFan, 1 );
+                Vec_IntPush( p->vWinIns, iFan );
+                Gia_IncNeedLit( p, Abc_Var2Lit(iFan, !Gia_ObjIsCi(Gia_ManObj(p->pNew, iFan)) && !Gia_IncKeepCell(p, Abc_Var2Lit(iFan, 0))) );
+                continue;
+            }
+            Vec_StrWriteEntry( p->vWinMark, iFan, 2 );
+            Vec_IntPush( p->vWinNodes, iFan );
+        }
+    }
+}
+static void Gia_IncCollectCell( Gia_Inc_t * p )
+{
+    Gia_Obj_t * pObj;
+    int i, k, iLit, * pCell;
+    Gia_ManForEachCo( p->pNew, pObj, i )
+        Gia_IncNeedLit( p, Gia_ObjFaninLit0p(p->pNew, pObj) );
+    while ( Vec_IntSize(p->vStack) > 0 )
+    {
+        iLit = Vec_IntPop( p->vStack );
+        if ( Gia_IncKeepCell(p, iLit) )
+        {
+            pCell = Vec_IntEntryP( p->vStore, Vec_IntEntry(p->vKeep, iLit) - 1 );
+            Vec_IntWriteEntry( p->vMapping, iLit, Vec_IntSize(p->vMapping) );
+            Vec_IntPush( p->vMapping, pCell[0] );
+            for ( k = 1; k <= pCell[0]; k++ )
+            {
+                Vec_IntPush( p->vMapping, pCell[k] );
+                Gia_IncNeedLit( p, pCell[k] );
+            }
+            Vec_IntPush( p->vMapping, pCell[k] );
+            p->nReused++;
+        }
+        else if ( Gia_IncKeepCell(p, Abc_LitNot(iLit)) )
+        {
+            Vec_IntWriteEntry( p->vMapping, iLit, -1 );
+            Gia_IncNeedLit( p, Abc_LitNot(iLit) );
+        }
+        else
+        {
+            Vec_IntPush( p->vWinOuts, iLit );
+            Gia_IncAddWindowCell( p, Abc_Lit2Var(iLit) );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the window AIG with the timing constraints.]
+
+  Description [The window nodes are added in the topological order of
+  the new AIG, so that each object of the window corresponds to one
+  object of the new AIG, recorded in vWin2New. The window inputs get
+  the old arrival times of their paired nodes; the window outputs get
+  the old required times of their paired nodes, or the old delay.
+  After retiming, the arrival and required times of the current
+  mapping of the new AIG are used instead.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_IncArrival( Gia_Inc_t * p, int iObj )
+{
+    int iOld = p->fRetimed ? iObj : Vec_IntEntry( p->vNew2Old, iObj );
+    Vec_Int_t * vCellMapping = p->fRetimed ? p->vMapping : p->pOld ? p->pOld->vCellMapping : NULL;
+    Gia_Obj_t * pObj = Gia_ManObj( p->pNew, iObj );
+    if ( Gia_ObjIsCi(pObj) )
+        return Gia_IncCiArrival( p, Gia_ObjCioId(pObj) );
+    if ( !p->fCells )
+        return Vec_IntEntry( p->vArrs, iOld );
+    return Vec_IntEntry( vCellMapping, Abc_Var2Lit(iOld, 0) ) ? Vec_IntEntry( p->vArrs, Abc_Var2Lit(iOld, 0) ) : Vec_IntEntry( p->vArrs, Abc_Var2Lit(iOld, 1) );
+}
+static int Gia_IncRequired( Gia_Inc_t * p, int iOut )
+{
+    int iOld = p->fCells ? Abc_Lit2Var(iOut) : iOut, Req;
+    if ( !p->fRetimed )
+        iOld = Vec_IntEntry( p->vNew2Old, iOld );
+    if ( p->pOld == NULL || iOld == -1 )
+        return p->DelayOld;
+    if ( !p->fCells )
+        Req = Vec_IntEntry( p->vReqs, iOld );
+    else if ( (Req = Vec_IntEntry(p->vReqs, Abc_Var2Lit(iOld, Abc_LitIsCompl(iOut)))) == ABC_INFINITY )
+        Req = Vec_IntEntry( p->vReqs, Abc_Var2Lit(iOld, !Abc_LitIsCompl(iOut)) );
+    return Req == ABC_INFINITY ? p->DelayOld : Req;
+}
+static Gia_Man_t * Gia_IncDeriveWindow( Gia_Inc_t * p )
+{
+    Gia_Man_t * pWin;
+    Gia_Obj_t * pObj;
+    int i, iObj, iOut;
+    Vec_IntSort( p->vWinNodes, 0 );
+    pWin = Gia_ManStart( 1 + Vec_IntSize(p->vWinIns) + Vec_IntSize(p->vWinNodes) + Vec_IntSize(p->vWinOuts) );
+    pWin->pName = Abc_UtilStrsav( "window" );
+    Vec_IntClear( p->vWin2New );
+    Vec_IntPush( p->vWin2New, 0 );
+    Gia_ManConst0(p->pNew)->Value = 0;
+    Vec_IntForEachEntry( p->vWinIns, iObj, i )
+    {
+        Gia_ManObj(p->pNew, iObj)->Value = Gia_ManAppendCi( pWin );
+        Vec_IntPush( p->vWin2New, iObj );
+    }
+    Gia_ManForEachObjVec( p->vWinNodes, p->pNew, pObj, i )
+    {
+        pObj->Value = Gia_ManAppendAnd( pWin, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        Vec_IntPush( p->vWin2New, Gia_ObjId(p->pNew, pObj) );
+    }
+    Vec_IntForEachEntry( p->vWinOuts, iOut, i )
+    {
+        if ( p->fCells )
+            Gia_ManAppendCo( pWin, Abc_LitNotCond(Gia_ManObj(p->pNew, Abc_Lit2Var(iOut))->Value, Abc_LitIsCompl(iOut)) );
+        else
+            Gia_ManAppendCo( pWin, Gia_ManObj(p->pNew, iOut)->Value );
+    }
+    // set the timing constraints
+    if ( p->fCells )
+    {
+        pWin->vInArrs  = Vec_FltAlloc( Vec_IntSize(p->vWinIns) );
+        pWin->vOutReqs = Vec_FltAlloc( Vec_IntSize(p->vWinOuts) );
+        Vec_IntForEachEntry( p->vWinIns, iObj, i )
+            Vec_FltPush( pWin->vInArrs, Scl_Int2Flt(Gia_IncArrival(p, iObj)) );
+        Vec_IntForEachEntry( p->vWinOuts, iOut, i )
+            Vec_FltPush( pWin->vOutReqs, Scl_Int2Flt(Gia_IncRequired(p, iOut)) );
+    }
+    else
+    {
+        pWin->vCiArrs = Vec_IntAlloc( Vec_IntSize(p->vWinIns) );
+        pWin->vCoReqs = Vec_IntAlloc( Vec_IntSize(p->vWinOuts) );
+        Vec_IntForEachEntry( p->vWinIns, iObj, i )
+            Vec_IntPush( pWin->vCiArrs, Gia_IncArrival(p, iObj) );
+        Vec_IntForEachEntry( p->vWinOuts, iOut, i )
+            Vec_IntPush( pWin->vCoReqs, Gia_IncRequired(p, iOut) );
+    }
+    return pWin;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the window and transfers the mapping to the new AIG.]
+
+  Description [The LUT mapping is read from the best cuts of the mapper,
+  whose objects have the same IDs as the objects of the window AIG. The
+  cell mapping is computed by the Nf engine on the window AIG itself.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_IncMapWindowLut( Gia_Inc_t * p, Gia_Man_t * pWin, If_Par_t * pPars )
+{
+    extern If_Man_t * Gia_ManToIf( Gia_Man_t * p, If_Par_t * pPars );
+    If_Par_t Pars = *pPars;
+    If_Man_t * pIfMan;
+    If_Cut_t * pCut;
+    Gia_Obj_t * pObj;
+    int i, k, iObj, Entry;
+    Pars.fCutMin  = 0;
+    Pars.fVerbose = 0;
+    Pars.pTimesArr = ABC_CALLOC( float, Gia_ManCiNum(pWin) );
+    Vec_IntForEachEntry( pWin->vCiArrs, Entry, i )
+        Pars.pTimesArr[i] = (float)Entry;
+    // without the old mapping, the window is the whole design
+    if ( p->pOld )
+    {
+        Pars.pTimesReq = ABC_CALLOC( float, Gia_ManCoNum(pWin) );
+        Vec_IntForEachEntry( pWin->vCoReqs, Entry, i )
+            Pars.pTimesReq[i] = (float)Entry;
+    }
+    pIfMan = Gia_ManToIf( pWin, &Pars );
+    if ( pIfMan == NULL )
+        return 0;
+    // the required times of the window may be unachievable
+    pIfMan->fReqTimeWarn = 1;
+    if ( !If_ManPerformMapping( pIfMan ) )
+    {
+        If_ManStop( pIfMan );
+        return 0;
+    }
+    Vec_IntClear( p->vStack );
+    Gia_ManForEachCo( pWin, pObj, i )
+        Vec_IntPush( p->vStack, Gia_ObjFaninId0p(pWin, pObj) );
+    Gia_ManIncrementTravId( pWin );
+    while ( Vec_IntSize(p->vStack) > 0 )
+    {
+        iObj = Vec_IntPop( p->vStack );
+        if ( !Gia_ObjIsAnd(Gia_ManObj(pWin, iObj)) || Gia_ObjIsTravIdCurrentId(pWin, iObj) )
+            continue;
+        Gia_ObjSetTravIdCurrentId( pWin, iObj );
+        pCut = If_ObjCutBest( If_ManObj(pIfMan, iObj) );
+        Vec_IntWriteEntry( p->vMapping, Vec_IntEntry(p->vWin2New, iObj), Vec_IntSize(p->vMapping) );
+        Vec_IntPush( p->vMapping, If_CutLeaveNum(pCut) );
+        for ( k = 0; k < If_CutLeaveNum(pCut); k++ )
+        {
+            Vec_IntPush( p->vMapping, Vec_IntEntry(p->vWin2New, pCut->pLeaves[k]) );
+            Vec_IntPush( p->vStack, pCut->pLeaves[k] );
+        }
+        Vec_IntPush( p->vMapping, Vec_IntEntry(p->vWin2New, iObj) );
+        p->nRemapped++;
+    }
+    If_ManStop( pIfMan );
+    return 1;
+}
+static int Gia_IncMapWindowCell( Gia_Inc_t * p, Gia_Man_t * pWin, Jf_Par_t * pPars )
+{
+    extern Gia_Man_t * Nf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars );
+    Jf_Par_t Pars = *pPars;
+    int i, c, k, iLit, iFan, iLitNew;
+    Pars.fCoarsen     = 0;
+    Pars.fAreaOnly    = 0;
+    Pars.fVerbose     = 0;
+    Pars.fVeryVerbose = 0;
+    if ( Nf_ManPerformMapping(pWin, &Pars) == NULL )
+        return 0;
+    Vec_IntClear( p->vWinRefs );
+    Gia_ManForEachAndId( pWin, i )
+    for ( c = 0; c < 2; c++ )
+    {
+        if ( !Gia_ObjIsCell(pWin, (iLit = Abc_Var2Lit(i, c))) )
+            continue;
+        iLitNew = Abc_Var2Lit( Vec_IntEntry(p->vWin2New, i), c );
+        if ( Gia_ObjIsCellInv(pWin, iLit) )
+        {
+            Vec_IntWriteEntry( p->vMapping, iLitNew, -1 );
+            continue;
+        }
+        Vec_IntWriteEntry( p->vMapping, iLitNew, Vec_IntSize(p->vMapping) );
+        Vec_IntPush( p->vMapping, Gia_ObjCellSize(pWin, iLit) );
+        Gia_CellForEachFanin( pWin, iLit, iFan, k )
+        {
+            int iFanNew = Abc_Var2Lit( Vec_IntEntry(p->vWin2New, Abc_Lit2Var(iFan)), Abc_LitIsCompl(iFan) );
+            if ( Gia_ObjIsCi(Gia_ManObj(pWin, Abc_Lit2Var(iFan))) )
+                Vec_IntPush( p->vWinRefs, iFanNew );
+            Vec_IntPush( p->vMapping, iFanNew );
+        }
+        Vec_IntPush( p->vMapping, Gia_ObjCellId(pWin, iLit) );
+        p->nRemapped++;
+    }
+    // implement the phases of the window inputs used by the window mapping
+    Vec_IntForEachEntry( p->vWinRefs, iLit, i )
+    {
+        if ( Vec_StrEntry(p->vVisit, iLit) )
+            continue;
+        Vec_IntPush( p->vWinDone, iLit );
+        if ( Gia_ObjIsCi(Gia_ManObj(p->pNew, Abc_Lit2Var(iLit))) )
+        {
+            Gia_IncNeedLit( p, iLit );
+            continue;
+        }
+        assert( Vec_StrEntry(p->vVisit, Abc_LitNot(iLit)) );
+        Vec_StrWriteEntry( p->vVisit, iLit, 1 );
+        Vec_IntWriteEntry( p->vMapping, iLit, -1 );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Recomputes the timing for the current mapping of the new AIG.]
+
+  Description [Returns the delay. The required times are computed for
+  the old delay, so that the next window mapping is constrained by the
+  actual arrival times of its inputs and the actual slack of its outputs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_IncRetime( Gia_Inc_t * p )
+{
+    Vec_Int_t ** pvMapping = p->fCells ? &p->pNew->vCellMapping : &p->pNew->vMapping;
+    Vec_Int_t * vSave = *pvMapping;
+    int Delay;
+    *pvMapping = p->vMapping;
+    Delay = Gia_IncComputeArrivals( p, p->pNew, p->vArrs );
+    Gia_IncComputeRequireds( p, p->pNew, p->DelayOld, p->vReqs );
+    *pvMapping = vSave;
+    p->fRetimed = 1;
+    return Delay;
+}
+static void Gia_IncUnmapWindow( Gia_Inc_t * p, int nMapSize )
+{
+    int i, iObj, iLit;
+    Vec_IntForEachEntry( p->vWinNodes, iObj, i )
+    {
+        if ( p->fCells )
+        {
+            Vec_IntWriteEntry( p->vMapping, Abc_Var2Lit(iObj, 0), 0 );
+            Vec_IntWriteEntry( p->vMapping, Abc_Var2Lit(iObj, 1), 0 );
+        }
+        else
+            Vec_IntWriteEntry( p->vMapping, iObj, 0 );
+    }
+    Vec_IntForEachEntry( p->vWinDone, iLit, i )
+    {
+        Vec_StrWriteEntry( p->vVisit, iLit, 0 );
+        Vec_IntWriteEntry( p->vMapping, iLit, 0 );
+    }
+    Vec_IntClear( p->vWinDone );
+    Vec_IntShrink( p->vMapping, nMapSize );
+    p->nRemapped = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs incremental mapping.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_Man_t * Gia_IncPerform( Gia_Man_t * pOld, Gia_Man_t * pNew, Vec_Int_t * vChanged, int fCells, If_Par_t * pIfPars, Jf_Par_t * pNfPars )
+{
+    Gia_Inc_t * p;
+    Gia_Man_t * pWin;
+    Vec_Int_t * vArrs, * vBest = NULL;
+    int i, iObj, Iter, nMapSize, RetValue = 1, DelayNew, DelayBest = ABC_INFINITY, nBestRemapped = 0;
+    abctime clk = Abc_Clock();
+    if ( pNew->pMuxes || Gia_ManBufNum(pNew) || Gia_ManHasChoices(pNew) )
+    {
+        printf( "Incremental mapping is only supported for AIGs without XORs, MUXes, buffers, and choices.\n" );
+        return NULL;
+    }
+    if ( pOld && (pOld->pMuxes || Gia_ManBufNum(pOld) || Gia_ManCiNum(pOld) != Gia_ManCiNum(pNew) || Gia_ManCoNum(pOld) != Gia_ManCoNum(pNew) ||
+        (fCells ? !Gia_ManHasCellMapping(pOld) : !Gia_ManHasMapping(pOld))) )
+    {
+        printf( "The old AIG is not compatible with the new AIG or does not have a mapping. Mapping from scratch.\n" );
+        pOld = NULL;
+    }
+    p = Gia_IncStart( pOld, pNew, fCells );
+    p->fVerbose = fCells ? pNfPars->fVerbose : pIfPars->fVerbose;
+    p->nLutSize = fCells ? pNfPars->nLutSize : pIfPars->nLutSize;
+    if ( fCells )
+    {
+        Vec_Mem_t * vTtMem; Vec_Wec_t * vTt2Match;
+        Mio_LibraryMatchesFetch( (Mio_Library_t *)Abc_FrameReadLibGen(), &vTtMem, &vTt2Match, &p->pCells, &p->nCells, pNfPars->fPinFilter, pNfPars->fPinPerm, pNfPars->fPinQuick );
+        p->InvDelay = p->pCells[3].iDelays[0];
+    }
+    if ( vChanged )
+        Vec_IntForEachEntry( vChanged, iObj, i )
+            if ( iObj > 0 && iObj < Gia_ManObjNum(pNew) )
+                Vec_StrWriteEntry( p->vForced, iObj, 1 );
+    // pair the nodes and compute the old timing
+    Gia_IncPairNodes( p );
+    if ( pOld )
+    {
+        p->vArrs = Vec_IntAlloc( 0 );
+        p->vReqs = Vec_IntAlloc( 0 );
+        p->DelayOld = Gia_IncComputeArrivals( p, pOld, p->vArrs );
+        Gia_IncComputeRequireds( p, pOld, p->DelayOld, p->vReqs );
+    }
+    // collect the reused LUTs/cells and the window
+    if ( fCells )
+        Gia_IncCollectCell( p );
+    else
+        Gia_IncCollectLut( p );
+    // remap the window; if the delay increased, retime and remap again
+    nMapSize = Vec_IntSize( p->vMapping );
+    for ( Iter = 0; Vec_IntSize(p->vWinOuts) > 0; Iter++ )
+    {
+        pWin = Gia_IncDeriveWindow( p );
+        RetValue = fCells ? Gia_IncMapWindowCell( p, pWin, pNfPars ) : Gia_IncMapWindowLut( p, pWin, pIfPars );
+        Gia_ManStop( pWin );
+        if ( !RetValue || pOld == NULL )
+            break;
+        DelayNew = Gia_IncRetime( p );
+        if ( DelayNew < DelayBest )
+        {
+            DelayBest = DelayNew;
+            Vec_IntFreeP( &vBest );
+            vBest = Vec_IntDup( p->vMapping );
+            nBestRemapped = p->nRemapped;
+        }
+        if ( DelayNew <= p->DelayOld || Iter == GIA_INC_ITER_MAX - 1 )
+            break;
+        Gia_IncUnmapWindow( p, nMapSize );
+    }
+    if ( !RetValue )
+    {
+        Vec_IntFreeP( &vBest );
+        Gia_IncStop( p );
+        return NULL;
+    }
+    if ( vBest )
+    {
+        Vec_IntFree( p->vMapping );
+        p->vMapping = vBest;
+        p->nRemapped = nBestRemapped;
+    }
+    // attach the mapping
+    if ( fCells )
+    {
+        Vec_IntFreeP( &pNew->vCellMapping );
+        pNew->vCellMapping = p->vMapping;
+    }
+    else
+    {
+        Vec_IntFreeP( &pNew->vMapping );
+        pNew->vMapping = p->vMapping;
+    }
+    p->vMapping = NULL;
+    if ( p->fVerbose )
+    {
+        vArrs = Vec_IntAlloc( 0 );
+        DelayNew = Gia_IncComputeArrivals( p, pNew, vArrs );
+        Vec_IntFree( vArrs );
+        printf( "Nodes = %d.  Paired exactly = %d.  Paired top-down = %d.  Forced = %d.\n",
+            Gia_ManAndNum(pNew), p->nExact, p->nPaired, vChanged ? Vec_IntSize(vChanged) : 0 );
+        printf( "Window: Inputs = %d.  Nodes = %d.  Outputs = %d.  Iterations = %d.\n",
+            Vec_IntSize(p->vWinIns), Vec_IntSize(p->vWinNodes), Vec_IntSize(p->vWinOuts), Vec_IntSize(p->vWinOuts) ? Iter + 1 : 0 );
+        printf( "%s: Reused = %d.  Remapped = %d.  ", fCells ? "Cells" : "LUTs", p->nReused, p->nRemapped );
+        if ( fCells )
+            printf( "Delay: Old = %.2f.  New = %.2f.  ", Scl_Int2Flt(p->DelayOld), Scl_Int2Flt(DelayNew) );
+        else
+            printf( "Delay: Old = %d.  New = %d.  ", p->DelayOld, DelayNew );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Gia_IncStop( p );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Incremental LUT mapping.]
+
+  Description [Maps the new AIG into LUTs, reusing the LUT mapping of the
+  old AIG (which can be NULL) wherever the structure of the new AIG did
+  not change. If the old AIG was produced by the mapper, its structure
+  is derived from the LUT functions, so the AIG given to the mapper,
+  annotated with the same LUTs, is used instead, if the mapper kept it. The optional array 
+  vChanged lists the new nodes that should be remapped unconditionally. 
+  The mapping is added to the new AIG, which is returned; its structure 
+  is not changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManPerformMappingIncr( Gia_Man_t * pOld, Gia_Man_t * pNew, Vec_Int_t * vChanged, void * pPars )
+{
+    assert( ((If_Par_t *)pPars)->nLutSize <= IF_MAX_LUTSIZE );
+    if ( pOld && pOld->pAigMapSrc )
+        pOld = pOld->pAigMapSrc;
+    return Gia_IncPerform( pOld, pNew, vChanged, 0, (If_Par_t *)pPars, NULL );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Incremental standard-cell mapping.]
+
+  Description [Similar to the above, but works with the cell mapping
+  computed by the Nf engine for the current library.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Nf_ManPerformMappingIncr( Gia_Man_t * pOld, Gia_Man_t * pNew, Vec_Int_t * vChanged, Jf_Par_t * pPars )
+{
+    if ( Abc_FrameReadLibGen() == NULL )
+    {
+        printf( "Current library is not available.\n" );
+        return NULL;
+    }
+    return Gia_IncPerform( pOld, pNew, vChanged, 1, NULL, pPars );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
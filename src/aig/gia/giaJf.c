@@ -21,13 +21,25 @@
 #include "gia.h"
 #include "misc/vec/vecSet.h"
 #include "misc/vec/vecMem.h"
+#include "misc/vec/vecMemC.h"
 #include "misc/extra/extra.h"
 #include "bool/kit/kit.h"
 #include "misc/util/utilTruth.h"
 #include "opt/dau/dau.h"
 #include "sat/cnf/cnf.h"
-
-ABC_NAMESPACE_IMPL_START
+#include "misc/util/utilPool.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
@@ -37,6 +49,8 @@ ABC_NAMESPACE_IMPL_START
 #define JF_WORD_MAX  ((JF_LEAF_MAX > 6) ? 1 << (JF_LEAF_MAX-6) : 1)
 #define JF_CUT_MAX   16
 #define JF_EPSILON 0.005
+#define JF_PAR_PROC_MAX   64    // the max number of threads
+#define JF_PAR_NODE_MIN   64    // the min number of nodes in one task
 
 typedef struct Jf_Cut_t_ Jf_Cut_t; 
 struct Jf_Cut_t_
@@ -56,7 +70,7 @@ struct Jf_Man_t_
     Jf_Par_t *       pPars;       // users parameter
     Sdm_Man_t *      pDsd;        // extern DSD manager
     Vec_Int_t *      vCnfs;       // costs of elementary CNFs
-    Vec_Mem_t *      vTtMem;      // truth table memory and hash table
+    Vec_MemC_t *     vTtMem;      // truth table memory and hash table
     Vec_Int_t        vCuts;       // cuts for each node
     Vec_Int_t        vArr;        // arrival time
     Vec_Int_t        vDep;        // departure time
@@ -68,6 +82,23 @@ struct Jf_Man_t_
     abctime          clkStart;    // starting time
     word             CutCount[4]; // statistics
     int              nCoarse;     // coarse nodes
+    // parallel cut computation
+    Jf_Man_t *       pOwner;      // the manager owning the shared data (in thread-local copies)
+    Vec_Int_t *      vStage;      // the cutsets computed by the thread-local copy
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;       // protects the truth tables and the DSD manager
+#endif
+};
+
+// the task computing cuts of a range of nodes of one level
+typedef struct Jf_ParTask_t_ Jf_ParTask_t; 
+struct Jf_ParTask_t_
+{
+    Jf_Man_t *       pCopy;       // the thread-local manager
+    Vec_Int_t *      vLevel;      // the nodes of the level
+    int              iStart;      // the first node
+    int              iStop;       // the node after the last one
+    int              fEdge;       // edge optimization
 };
 
 static inline int    Jf_ObjIsUnit( Gia_Obj_t * p )          { return !p->fMark0;                                       }
@@ -112,8 +143,34 @@ static inline int    Jf_ObjFunc1( Gia_Obj_t * p, int * c )  { return Abc_LitNotC
 extern int Kit_TruthToGia( Gia_Man_t * pMan, unsigned * pTruth, int nVars, Vec_Int_t * vMemory, Vec_Int_t * vLeaves, int fHash );
 
 ////////////////////////////////////////////////////////////////////////
-///                     FUNCTION DEFINITIONS                         ///
-////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Locks the data shared by the threads.]
+
+  Description [Does nothing unless called for a thread-local copy.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Jf_ManLock( Jf_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->pOwner )
+        pthread_mutex_lock( &p->pOwner->Mutex );
+#endif
+}
+static inline void Jf_ManUnlock( Jf_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->pOwner )
+        pthread_mutex_unlock( &p->pOwner->Mutex );
+#endif
+}
 
 /**Function*************************************************************
 
@@ -372,7 +429,7 @@ Jf_Man_t * Jf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     p->pGia      = pGia;
     p->pPars     = pPars;
     if ( pPars->fCutMin && !pPars->fFuncDsd )
-        p->vTtMem = Vec_MemAllocForTT( pPars->nLutSize, 0 );
+        p->vTtMem = Vec_MemCAllocForTT( pPars->nLutSize, 0 );
     else if ( pPars->fCutMin && pPars->fFuncDsd )
     {
         p->pDsd = Sdm_ManRead();
@@ -391,6 +448,9 @@ Jf_Man_t * Jf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     Vec_SetAlloc_( &p->pMem, 20 );
     p->vTemp     = Vec_IntAlloc( 1000 );
     p->clkStart  = Abc_Clock();
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+#endif
     return p;
 }
 void Jf_ManFree( Jf_Man_t * p )
@@ -399,7 +459,7 @@ void Jf_ManFree( Jf_Man_t * p )
         Sdm_ManPrintDsdStats( p->pDsd, 0 );
     if ( p->pPars->fVerbose && p->vTtMem )
     {
-        printf( "Unique truth tables = %d. Memory = %.2f MB   ", Vec_MemEntryNum(p->vTtMem), Vec_MemMemory(p->vTtMem) / (1<<20) ); 
+        printf( "Unique truth tables = %d. Memory = %.2f MB   ", Vec_MemCEntryNum(p->vTtMem), Vec_MemCMemory(p->vTtMem) / (1<<20) ); 
         Abc_PrintTime( 1, "Time", Abc_Clock() - p->clkStart );
     }
     if ( p->pPars->fVeryVerbose && p->pPars->fCutMin && p->pPars->fFuncDsd )
@@ -413,13 +473,13 @@ void Jf_ManFree( Jf_Man_t * p )
     ABC_FREE( p->vFlow.pArray );
     ABC_FREE( p->vRefs.pArray );
     if ( p->pPars->fCutMin && !p->pPars->fFuncDsd )
-    {
-        Vec_MemHashFree( p->vTtMem );
-        Vec_MemFree( p->vTtMem );
-    }
+        Vec_MemCFree( p->vTtMem );
     Vec_IntFreeP( &p->vCnfs );
     Vec_SetFree_( &p->pMem );
     Vec_IntFreeP( &p->vTemp );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
     ABC_FREE( p );
 }
 
@@ -1073,17 +1133,15 @@ int Jf_TtComputeForCut( Jf_Man_t * p, int iFuncLit0, int iFuncLit1, int * pCut0,
     int fCompl, truthId;
     int LutSize    = p->pPars->nLutSize;
     int nWords     = Abc_Truth6WordNum(p->pPars->nLutSize);
-    word * pTruth0 = Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(iFuncLit0));
-    word * pTruth1 = Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(iFuncLit1));
-    Abc_TtCopy( uTruth0, pTruth0, nWords, Abc_LitIsCompl(iFuncLit0) );
-    Abc_TtCopy( uTruth1, pTruth1, nWords, Abc_LitIsCompl(iFuncLit1) );
+    Abc_TtCopy( uTruth0, Vec_MemCReadEntry(p->vTtMem, Abc_Lit2Var(iFuncLit0)), nWords, Abc_LitIsCompl(iFuncLit0) );
+    Abc_TtCopy( uTruth1, Vec_MemCReadEntry(p->vTtMem, Abc_Lit2Var(iFuncLit1)), nWords, Abc_LitIsCompl(iFuncLit1) );
     Abc_TtExpand( uTruth0, LutSize, pCut0 + 1, Jf_CutSize(pCut0), pCutOut + 1, Jf_CutSize(pCutOut) );
     Abc_TtExpand( uTruth1, LutSize, pCut1 + 1, Jf_CutSize(pCut1), pCutOut + 1, Jf_CutSize(pCutOut) );
     fCompl         = (int)(uTruth0[0] & uTruth1[0] & 1);
     Abc_TtAnd( uTruth, uTruth0, uTruth1, nWords, fCompl );
     pCutOut[0]     = Abc_TtMinBase( uTruth, pCutOut + 1, pCutOut[0], LutSize );
     assert( (uTruth[0] & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Vec_MemCHashInsert(p->vTtMem, uTruth);
     return Abc_Var2Lit( truthId, fCompl );
 }
 
@@ -1166,7 +1224,9 @@ void Jf_ObjComputeCuts( Jf_Man_t * p, Gia_Obj_t * pObj, int fEdge )
                 continue;
             pSto[c]->Sign = Sign0[i] | Sign1[k];
             nOldSupp = pSto[c]->pCut[0];
+            Jf_ManLock( p );
             pSto[c]->iFunc = Sdm_ManComputeFunc( p->pDsd, Jf_ObjFunc0(pObj, pCut0), Jf_ObjFunc1(pObj, pCut1), pSto[c]->pCut, Config, 0 );
+            Jf_ManUnlock( p );
             if ( pSto[c]->iFunc == -1 )
                 continue;
             if ( p->pPars->fGenCnf && Jf_CutCnfSizeF(p, Abc_Lit2Var(pSto[c]->iFunc)) >= 12 ) // no more than 15
@@ -1234,9 +1294,130 @@ void Jf_ObjComputeCuts( Jf_Man_t * p, Gia_Obj_t * pObj, int fEdge )
         for ( k = 1; k <= pSto[i]->pCut[0]; k++ )
             Vec_IntPush( p->vTemp, pSto[i]->pCut[k] );
     }
-    Vec_IntWriteEntry( &p->vCuts, iObj, Vec_SetAppend(&p->pMem, Vec_IntArray(p->vTemp), Vec_IntSize(p->vTemp)) );
+    if ( p->vStage ) // thread-local copy saves the cutset to be added later
+    {
+        Vec_IntPush( p->vStage, iObj );
+        Vec_IntPush( p->vStage, Vec_IntSize(p->vTemp) );
+        Vec_IntAppend( p->vStage, p->vTemp );
+    }
+    else
+        Vec_IntWriteEntry( &p->vCuts, iObj, Vec_SetAppend(&p->pMem, Vec_IntArray(p->vTemp), Vec_IntSize(p->vTemp)) );
     p->CutCount[3] += c;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cuts using several threads.]
+
+  Description [The nodes of one level are divided into contiguous ranges,
+  which are processed concurrently by thread-local copies of the manager.
+  Each copy collects the cutsets in its own array, and the cutsets are 
+  added to the cut storage after the level is processed, in the order of 
+  the ranges, so that the storage is not changed while the threads read 
+  it. The truth tables and the DSD manager are shared and protected by a 
+  mutex. The result does not depend on the number of threads and is the
+  same as the result of the sequential computation.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Wec_t * Jf_ManLevelizeAnds( Jf_Man_t * p )
+{
+    Vec_Int_t * vLevels = Vec_IntStart( Gia_ManObjNum(p->pGia) );
+    Vec_Wec_t * vNodes;
+    Gia_Obj_t * pObj;
+    int i, Level, LevelMax = 0;
+    Gia_ManForEachAnd( p->pGia, pObj, i )
+    {
+        Level = 1 + Abc_MaxInt( Vec_IntEntry(vLevels, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(vLevels, Gia_ObjFaninId1(pObj, i)) );
+        Vec_IntWriteEntry( vLevels, i, Level );
+        LevelMax = Abc_MaxInt( LevelMax, Level );
+    }
+    vNodes = Vec_WecStart( LevelMax + 1 );
+    Gia_ManForEachAndId( p->pGia, i )
+        Vec_WecPush( vNodes, Vec_IntEntry(vLevels, i), i );
+    Vec_IntFree( vLevels );
+    return vNodes;
+}
+static Jf_Man_t * Jf_ManCopyStart( Jf_Man_t * p )
+{
+    Jf_Man_t * pCopy = ABC_ALLOC( Jf_Man_t, 1 );
+    *pCopy = *p;
+    pCopy->pOwner = p;
+    pCopy->vTemp  = Vec_IntAlloc( 1000 );
+    pCopy->vStage = Vec_IntAlloc( 1000 );
+    memset( pCopy->CutCount, 0, sizeof(pCopy->CutCount) );
+    return pCopy;
+}
+static void Jf_ManCopyStop( Jf_Man_t * p, Jf_Man_t * pCopy )
+{
+    int i;
+    for ( i = 0; i < 4; i++ )
+        p->CutCount[i] += pCopy->CutCount[i];
+    Vec_IntFree( pCopy->vTemp );
+    Vec_IntFree( pCopy->vStage );
+    ABC_FREE( pCopy );
+}
+static void Jf_ManComputeCutsTask( void * pArg )
+{
+    Jf_ParTask_t * pTask = (Jf_ParTask_t *)pArg;
+    int i;
+    for ( i = pTask->iStart; i < pTask->iStop; i++ )
+        Jf_ObjComputeCuts( pTask->pCopy, Gia_ManObj(pTask->pCopy->pGia, Vec_IntEntry(pTask->vLevel, i)), pTask->fEdge );
+}
+void Jf_ManComputeCutsPar( Jf_Man_t * p, int fEdge )
+{
+    Jf_Man_t * pCopies[JF_PAR_PROC_MAX];
+    Jf_ParTask_t pTasks[JF_PAR_PROC_MAX];
+    Vec_Wec_t * vLevels = Jf_ManLevelizeAnds( p );
+    int nProcs = Abc_MinInt( p->pPars->nProcNum, JF_PAR_PROC_MAX );
+    Vec_Int_t * vLevel, * vStage;
+    Util_Job_t * pJob;
+    Gia_Obj_t * pObj;
+    int i, k, n, nTasks, iObj, nSize;
+    assert( !Gia_ManBufNum(p->pGia) );
+    Gia_ManForEachCi( p->pGia, pObj, i )
+        Jf_ObjAssignCut( p, pObj );
+    for ( k = 0; k < nProcs; k++ )
+        pCopies[k] = Jf_ManCopyStart( p );
+    pJob = Util_JobStart( Util_PoolGlobal() );
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    {
+        nTasks = Abc_MinInt( nProcs, 1 + Vec_IntSize(vLevel) / JF_PAR_NODE_MIN );
+        for ( k = 0; k < nTasks; k++ )
+        {
+            pCopies[k]->pMem = p->pMem; // the page array may have been reallocated
+            Vec_IntClear( pCopies[k]->vStage );
+            pTasks[k].pCopy  = pCopies[k];
+            pTasks[k].vLevel = vLevel;
+            pTasks[k].iStart = (int)((word)Vec_IntSize(vLevel) * k / nTasks);
+            pTasks[k].iStop  = (int)((word)Vec_IntSize(vLevel) * (k+1) / nTasks);
+            pTasks[k].fEdge  = fEdge;
+            if ( nTasks == 1 )
+                Jf_ManComputeCutsTask( pTasks + k );
+            else
+                Util_JobSubmit( pJob, Jf_ManComputeCutsTask, pTasks + k );
+        }
+        Util_JobWaitAll( pJob );
+        // add the cutsets to the storage
+        for ( k = 0; k < nTasks; k++ )
+        {
+            vStage = pCopies[k]->vStage;
+            for ( n = 0; n < Vec_IntSize(vStage); n += nSize + 2 )
+            {
+                iObj  = Vec_IntEntry( vStage, n );
+                nSize = Vec_IntEntry( vStage, n + 1 );
+                Vec_IntWriteEntry( &p->vCuts, iObj, Vec_SetAppend(&p->pMem, Vec_IntEntryP(vStage, n + 2), nSize) );
+            }
+        }
+    }
+    Util_JobStop( pJob );
+    for ( k = 0; k < nProcs; k++ )
+        Jf_ManCopyStop( p, pCopies[k] );
+    Vec_WecFree( vLevels );
+}
 void Jf_ManComputeCuts( Jf_Man_t * p, int fEdge )
 {
     Gia_Obj_t * pObj; int i;
@@ -1247,14 +1428,19 @@ void Jf_ManComputeCuts( Jf_Man_t * p, int fEdge )
         printf( "Computing cuts...\r" );
         fflush( stdout );
     }
-    Gia_ManForEachObj( p->pGia, pObj, i )
+    if ( p->pPars->nProcNum > 1 && !Gia_ManBufNum(p->pGia) ) // buffers are propagated in the sequential loop
+        Jf_ManComputeCutsPar( p, fEdge );
+    else
     {
-        if ( Gia_ObjIsCi(pObj) || Gia_ObjIsBuf(pObj) )
-            Jf_ObjAssignCut( p, pObj );
-        if ( Gia_ObjIsBuf(pObj) )
-            Jf_ObjPropagateBuf( p, pObj, 0 );
-        else if ( Gia_ObjIsAnd(pObj) )
-            Jf_ObjComputeCuts( p, pObj, fEdge );
+        Gia_ManForEachObj( p->pGia, pObj, i )
+        {
+            if ( Gia_ObjIsCi(pObj) || Gia_ObjIsBuf(pObj) )
+                Jf_ObjAssignCut( p, pObj );
+            if ( Gia_ObjIsBuf(pObj) )
+                Jf_ObjPropagateBuf( p, pObj, 0 );
+            else if ( Gia_ObjIsAnd(pObj) )
+                Jf_ObjComputeCuts( p, pObj, fEdge );
+        }
     }
     if ( p->pPars->fVerbose )
     {
@@ -1481,7 +1667,7 @@ Gia_Man_t * Jf_ManDeriveMappingGia( Jf_Man_t * p )
         if ( p->pPars->fFuncDsd )
             uTruth = Sdm_ManReadDsdTruth(p->pDsd, Class);
         else
-            pTruth = Vec_MemReadEntry(p->vTtMem, Class);
+            pTruth = Vec_MemCReadEntry(p->vTtMem, Class);
         assert( p->pDsd == NULL || Sdm_ManReadDsdVarNum(p->pDsd, Class) == Jf_CutSize(pCut) );
         // collect leaves
         Vec_IntClear( vLeaves );
@@ -1627,7 +1813,7 @@ Gia_Man_t * Jf_ManDeriveGia( Jf_Man_t * p )
             if ( p->pPars->fFuncDsd )
                 uTruth = Sdm_ManReadDsdTruth(p->pDsd, Class);
             else
-                Abc_TtCopy( (pTruth = Truth), Vec_MemReadEntry(p->vTtMem, Class), nWords, 0 );
+                Abc_TtCopy( (pTruth = Truth), Vec_MemCReadEntry(p->vTtMem, Class), nWords, 0 );
             assert( p->pDsd == NULL || Sdm_ManReadDsdVarNum(p->pDsd, Class) == Jf_CutSize(pCut) );
         }
         else
@@ -1736,7 +1922,7 @@ Gia_Man_t * Jf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
         Jf_ManPropagateEla( p, 1 );                 Jf_ManPrintStats( p, "Edge " );
     }
     if ( p->pPars->fVeryVerbose && p->pPars->fCutMin && !p->pPars->fFuncDsd )
-        Vec_MemDumpTruthTables( p->vTtMem, Gia_ManName(p->pGia), p->pPars->nLutSize );
+        Vec_MemCDumpTruthTables( p->vTtMem, Gia_ManName(p->pGia), p->pPars->nLutSize );
     if ( p->pPars->fPureAig )
         pNew = Jf_ManDeriveGia(p);
     else if ( p->pPars->fCutMin )
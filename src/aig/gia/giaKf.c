@@ -20,6 +20,7 @@
 
 #include "gia.h"
 #include "misc/vec/vecSet.h"
+#include "misc/util/utilPool.h"
 
 #ifdef ABC_USE_PTHREADS
 
@@ -951,41 +952,22 @@ int Kf_ManComputeRefs( Kf_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-#define PAR_THR_MAX 100
 typedef struct Kf_ThData_t_
 {
     Kf_Set_t *  pSett;
     int         Id;
-    int         Status;
     abctime     clkUsed;
 } Kf_ThData_t;
-void * Kf_WorkerThread( void * pArg )
+void Kf_WorkerTask( void * pArg )
 {
     Kf_ThData_t * pThData = (Kf_ThData_t *)pArg;
     Kf_Man_t * pMan = pThData->pSett->pMan;
     int fAreaOnly = pThData->pSett->pMan->pPars->fAreaOnly;
     int fCutMin = pThData->pSett->pMan->pPars->fCutMin;
-    volatile int * pPlace = &pThData->Status;
-    abctime clk;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->Status == 1 );
-        if ( pThData->Id == -1 )
-        {
-	        pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        assert( pThData->Id >= 0 );
-        clk = Abc_Clock();
-        Kf_SetMergeOrder( pThData->pSett, Kf_ObjCuts0(pMan, pThData->Id), Kf_ObjCuts1(pMan, pThData->Id), fAreaOnly, fCutMin );
-        pThData->clkUsed += Abc_Clock() - clk;
-        pThData->Status = 0;
-//        printf( "Finished object %d\n", pThData->Id );
-    }
-	assert( 0 );
-	return NULL;
+    abctime clk = Abc_Clock();
+    assert( pThData->Id >= 0 );
+    Kf_SetMergeOrder( pThData->pSett, Kf_ObjCuts0(pMan, pThData->Id), Kf_ObjCuts1(pMan, pThData->Id), fAreaOnly, fCutMin );
+    pThData->clkUsed += Abc_Clock() - clk;
 }
 Vec_Int_t * Kf_ManCreateFaninCounts( Gia_Man_t * p )  
 {
@@ -1004,14 +986,14 @@ Vec_Int_t * Kf_ManCreateFaninCounts( Gia_Man_t * p )
 }
 void Kf_ManComputeCuts( Kf_Man_t * p )
 {
-	pthread_t WorkerThread[PAR_THR_MAX];
-    Kf_ThData_t ThData[PAR_THR_MAX];
+    Kf_ThData_t ThData[KF_PROC_MAX], * pThData;
+    Util_Job_t * pJob;
     Vec_Int_t * vStack, * vFanins;
     Gia_Obj_t * pObj;
     int nProcs = p->pPars->nProcNum;
-    int i, k, iFan, status, nCountFanins, fRunning;
+    int i, k, iFan;
     abctime clk, clkUsed = 0;
-    assert( nProcs <= PAR_THR_MAX );
+    assert( nProcs <= KF_PROC_MAX );
     // start fanins
     vFanins = Kf_ManCreateFaninCounts( p->pGia );
     Gia_ManStaticFanoutStart( p->pGia );
@@ -1020,65 +1002,55 @@ void Kf_ManComputeCuts( Kf_Man_t * p )
     Gia_ManForEachObjReverse( p->pGia, pObj, k )
         if ( Gia_ObjIsAnd(pObj) && Vec_IntEntry(vFanins, k) == 0 )
             Vec_IntPush( vStack, k );
-    // start the threads
+    // the slots (and their cut sets) are executed by the shared thread pool
+    pJob = Util_JobStart( Util_PoolGlobal() );
     for ( i = 0; i < nProcs; i++ )
     {
         ThData[i].pSett = p->pSett + i;
         ThData[i].Id = -1;
-        ThData[i].Status = 0;
         ThData[i].clkUsed = 0;
-        status = pthread_create( WorkerThread + i, NULL, Kf_WorkerThread, (void *)(ThData + i) );  assert( status == 0 );
     }
-    nCountFanins = Vec_IntSum(vFanins);
-    fRunning = 1;
-    while ( nCountFanins > 0 || Vec_IntSize(vStack) > 0 || fRunning )
+    pThData = NULL;
+    do
     {
-        for ( i = 0; i < nProcs; i++ )
+        if ( pThData != NULL )
         {
-            if ( ThData[i].Status )
-                continue;
-            assert( ThData[i].Status == 0 );
-            if ( ThData[i].Id >= 0 )
-            {
-                int iObj = ThData[i].Id;
-                Kf_Set_t * pSett = p->pSett + i;
-                //printf( "Closing obj %d with Thread %d:\n", iObj, i );
-                clk = Abc_Clock();
-                // finalize the results
-                Kf_ManSaveResults( pSett->ppCuts, pSett->nCuts, pSett->pCutBest, p->vTemp );
-                Vec_IntWriteEntry( &p->vTime, iObj, pSett->pCutBest->Delay + 1 );
-                Vec_FltWriteEntry( &p->vArea, iObj, (pSett->pCutBest->Area + 1)/Kf_ObjRefs(p, iObj) );
-                if ( pSett->pCutBest->nLeaves > 1 )
-                    Kf_ManStoreAddUnit( p->vTemp, iObj, Kf_ObjTime(p, iObj), Kf_ObjArea(p, iObj) );
-                Kf_ObjSetCuts( p, iObj, p->vTemp );
-                //Gia_CutSetPrint( Kf_ObjCuts(p, iObj) );
-                clkUsed += Abc_Clock() - clk;
-                // schedule other nodes
-                Gia_ObjForEachFanoutStaticId( p->pGia, iObj, iFan, k )
-                {
-                    if ( !Gia_ObjIsAnd(Gia_ManObj(p->pGia, iFan)) )
-                        continue;
-                    assert( Vec_IntEntry(vFanins, iFan) > 0 );
-                    if ( Vec_IntAddToEntry(vFanins, iFan, -1) == 0 )
-                        Vec_IntPush( vStack, iFan );
-                    assert( nCountFanins > 0 );
-                    nCountFanins--;
-                }
-                ThData[i].Id = -1;
-            }
-            if ( Vec_IntSize(vStack) > 0 )
+            int iObj = pThData->Id;
+            Kf_Set_t * pSett = pThData->pSett;
+            //printf( "Closing obj %d with Thread %d:\n", iObj, (int)(pThData - ThData) );
+            clk = Abc_Clock();
+            // finalize the results
+            Kf_ManSaveResults( pSett->ppCuts, pSett->nCuts, pSett->pCutBest, p->vTemp );
+            Vec_IntWriteEntry( &p->vTime, iObj, pSett->pCutBest->Delay + 1 );
+            Vec_FltWriteEntry( &p->vArea, iObj, (pSett->pCutBest->Area + 1)/Kf_ObjRefs(p, iObj) );
+            if ( pSett->pCutBest->nLeaves > 1 )
+                Kf_ManStoreAddUnit( p->vTemp, iObj, Kf_ObjTime(p, iObj), Kf_ObjArea(p, iObj) );
+            Kf_ObjSetCuts( p, iObj, p->vTemp );
+            //Gia_CutSetPrint( Kf_ObjCuts(p, iObj) );
+            clkUsed += Abc_Clock() - clk;
+            // schedule other nodes
+            Gia_ObjForEachFanoutStaticId( p->pGia, iObj, iFan, k )
             {
-                ThData[i].Id = Vec_IntPop( vStack );
-                ThData[i].Status = 1;
-                //printf( "Scheduling %d for Thread %d\n", ThData[i].Id, i );
+                if ( !Gia_ObjIsAnd(Gia_ManObj(p->pGia, iFan)) )
+                    continue;
+                assert( Vec_IntEntry(vFanins, iFan) > 0 );
+                if ( Vec_IntAddToEntry(vFanins, iFan, -1) == 0 )
+                    Vec_IntPush( vStack, iFan );
             }
+            pThData->Id = -1;
+        }
+        // give the ready nodes to the idle slots
+        for ( i = 0; i < nProcs && Vec_IntSize(vStack) > 0; i++ )
+        {
+            if ( ThData[i].Id >= 0 )
+                continue;
+            ThData[i].Id = Vec_IntPop( vStack );
+            Util_JobSubmit( pJob, Kf_WorkerTask, ThData + i );
+            //printf( "Scheduling %d for Thread %d\n", ThData[i].Id, i );
         }
-        fRunning = 0;
-        for ( i = 0; i < nProcs; i++ )
-            if ( ThData[i].Status == 1 || (ThData[i].Status == 0 && ThData[i].Id >= 0) )
-                fRunning = 1;
-//        printf( "fRunning %d\n", fRunning );
     }
+    while ( (pThData = (Kf_ThData_t *)Util_JobWaitNext(pJob)) );
+    Util_JobStop( pJob );
     Vec_IntForEachEntry( vFanins, iFan, k )
         if ( iFan != 0 )
         {
@@ -1086,13 +1058,8 @@ void Kf_ManComputeCuts( Kf_Man_t * p )
             Gia_ObjPrint( p->pGia, Gia_ManObj(p->pGia, k) );
         }
     assert( Vec_IntSum(vFanins) == 0 );
-    // stop the threads
     for ( i = 0; i < nProcs; i++ )
-    {
-        assert( ThData[i].Status == 0 );
-        ThData[i].Id = -1;
-        ThData[i].Status = 1;
-    }
+        assert( ThData[i].Id == -1 );
     Gia_ManStaticFanoutStop( p->pGia );
     Vec_IntFree( vStack );
     Vec_IntFree( vFanins );
@@ -1324,9 +1291,14 @@ Gia_Man_t * Kf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
 {
     Kf_Man_t * p;
     Gia_Man_t * pNew;
+    int i;
     p = Kf_ManAlloc( pGia, pPars );
     Kf_ManComputeMapping( p );
     pNew = Kf_ManDerive( p );
+    pPars->nCutsAll = 0;
+    for ( i = 0; i < Abc_MaxInt(1, pPars->nProcNum); i++ )
+        pPars->nCutsAll += p->pSett[i].CutCount[3];
+    pPars->nCutMem = (word)Vec_ReportMemory(&p->pMem);
     Kf_ManFree( p );
     return pNew;
 }
@@ -2187,6 +2187,9 @@ Gia_Man_t * Lf_ManPerformMappingInt( Gia_Man_t * pGia, Jf_Par_t * pPars )
         pNew = Lf_ManDeriveMapping( p );
     Gia_ManMappingVerify( pNew );
     Lf_ManPrintQuit( p, pNew );
+    pPars->nCutsAll = (word)p->CutCount[3];
+    pPars->nCutMem  = (word)(p->vStoreOld.MaskPage + 1) * (Vec_PtrSize(&p->vFreePages) + Vec_PtrSize(&p->vStoreOld.vPages)) + (word)sizeof(Lf_Bst_t) * Gia_ManAndNotBufNum(p->pGia);
+    pPars->nCutMem += (word)sizeof(word) * p->nSetWords * (1<<LF_LOG_PAGE) * Vec_PtrSize(&p->vMemSets);
     Lf_ManFree( p );
     if ( pCls != pGia )
     {
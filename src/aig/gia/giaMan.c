@@ -81,6 +81,7 @@ void Gia_ManStop( Gia_Man_t * p )
     if ( p->vSeqModelVec )
         Vec_PtrFreeFree( p->vSeqModelVec );
     Gia_ManStaticFanoutStop( p );
+    Gia_ManSoaStop( p );
     Tim_ManStopP( (Tim_Man_t **)&p->pManTime );
     assert( p->pManTime == NULL );
     Vec_PtrFreeFree( p->vNamesIn );
@@ -139,6 +140,7 @@ void Gia_ManStop( Gia_Man_t * p )
     Vec_IntFreeP( &p->vCoArrs );
     Vec_IntFreeP( &p->vCoAttrs );
     Gia_ManStopP( &p->pAigExtra );
+    Gia_ManStopP( &p->pAigMapSrc );
     Vec_IntFree( p->vCis );
     Vec_IntFree( p->vCos );
     Vec_IntErase( &p->vHash );
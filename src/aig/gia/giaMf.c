@@ -20,12 +20,24 @@
 
 #include "gia.h"
 #include "misc/vec/vecMem.h"
+#include "misc/vec/vecMemC.h"
 #include "misc/util/utilTruth.h"
 #include "misc/extra/extra.h"
 #include "sat/cnf/cnf.h"
 #include "opt/dau/dau.h"
+#include "misc/util/utilPool.h"
 
-ABC_NAMESPACE_IMPL_START
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
@@ -38,6 +50,8 @@ ABC_NAMESPACE_IMPL_START
 #define MF_TT_WORDS  ((MF_LEAF_MAX > 6) ? 1 << (MF_LEAF_MAX-6) : 1)
 #define MF_NO_FUNC    134217727     // (1<<27)-1
 #define MF_EPSILON 0.005
+#define MF_PAR_PROC_MAX   64    // the max number of threads
+#define MF_PAR_NODE_MIN   64    // the min number of nodes in one task
 
 typedef struct Mf_Cut_t_ Mf_Cut_t; 
 struct Mf_Cut_t_
@@ -68,7 +82,7 @@ struct Mf_Man_t_
     // cut data
     Mf_Obj_t *      pLfObjs;        // best cuts
     Vec_Ptr_t       vPages;         // cut memory
-    Vec_Mem_t *     vTtMem;         // truth tables
+    Vec_MemC_t *    vTtMem;         // truth tables
     Vec_Int_t       vCnfSizes;      // handles to CNF
     Vec_Int_t       vCnfMem;        // memory for CNF
     Vec_Int_t       vTemp;          // temporary array
@@ -79,6 +93,21 @@ struct Mf_Man_t_
     abctime         clkStart;       // starting time
     double          CutCount[4];    // cut counts
     int             nCutCounts[MF_LEAF_MAX+1];
+    // parallel cut computation
+    Mf_Man_t *      pOwner;         // the manager owning the shared data (in thread-local copies)
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;          // protects the truth tables and the page array
+#endif
+};
+
+// the task computing cuts of a range of nodes of one level
+typedef struct Mf_ParTask_t_ Mf_ParTask_t; 
+struct Mf_ParTask_t_
+{
+    Mf_Man_t *      pCopy;          // the thread-local manager
+    Vec_Int_t *     vLevel;         // the nodes of the level
+    int             iStart;         // the first node
+    int             iStop;          // the node after the last one
 };
 
 static inline Mf_Obj_t * Mf_ManObj( Mf_Man_t * p, int i )            { return p->pLfObjs + i;                                          }
@@ -94,6 +123,7 @@ static inline int        Mf_CutSize( int * pCut )                    { return pC
 static inline int        Mf_CutFunc( int * pCut )                    { return ((unsigned)pCut[0] >> 5);                                }
 static inline int        Mf_CutSetBoth( int n, int f )               { return n | (f << 5);                                            }
 static inline int        Mf_CutIsTriv( int * pCut, int i )           { return Mf_CutSize(pCut) == 1 && pCut[1] == i;                   } 
+static inline Vec_Int_t * Mf_ManCnfSizes( Mf_Man_t * p )             { return p->pOwner ? &p->pOwner->vCnfSizes : &p->vCnfSizes;       }
 
 #define Mf_SetForEachCut( pList, pCut, i )      for ( i = 0, pCut = pList + 1; i < pList[0]; i++, pCut += Mf_CutSize(pCut) + 1 )
 #define Mf_ObjForEachCut( pCuts, i, nCuts )     for ( i = 0, i < nCuts; i++ )
@@ -104,6 +134,63 @@ extern int Kit_TruthToGia( Gia_Man_t * pMan, unsigned * pTruth, int nVars, Vec_I
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Locks the data shared by the threads.]
+
+  Description [Does nothing unless called for a thread-local copy.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Mf_ManLock( Mf_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->pOwner )
+        pthread_mutex_lock( &p->pOwner->Mutex );
+#endif
+}
+static inline void Mf_ManUnlock( Mf_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->pOwner )
+        pthread_mutex_unlock( &p->pOwner->Mutex );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the CNF sizes of the truth tables.]
+
+  Description [The truth table IDs may be assigned by several threads
+  in any order, so the CNF size of a new truth table is written by the
+  thread that finds it missing. The entries not yet written are -1.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Mf_ManHasCnfSize( Mf_Man_t * p, int truthId )
+{
+    Vec_Int_t * vCnfSizes = Mf_ManCnfSizes(p);
+    int RetValue;
+    Mf_ManLock( p );
+    RetValue = truthId < Vec_IntSize(vCnfSizes) && Vec_IntEntry(vCnfSizes, truthId) >= 0;
+    Mf_ManUnlock( p );
+    return RetValue;
+}
+static inline void Mf_ManSetCnfSize( Mf_Man_t * p, int truthId, int nCnfSize )
+{
+    Vec_Int_t * vCnfSizes = Mf_ManCnfSizes(p);
+    Mf_ManLock( p );
+    Vec_IntFillExtra( vCnfSizes, truthId + 1, -1 );
+    Vec_IntWriteEntry( vCnfSizes, truthId, nCnfSize );
+    Mf_ManUnlock( p );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computing truth tables of useful DSD classes of 6-functions.]
@@ -233,7 +320,7 @@ void Mf_ManProfileTruths( Mf_Man_t * p )
         printf( "%6d : ", i );
         printf( "Occur = %4d  ", Entry ); 
         printf( "CNF size = %2d  ", Vec_IntEntry(&p->vCnfSizes, i) );
-        Dau_DsdPrintFromTruth( Vec_MemReadEntry(p->vTtMem, i), p->pPars->nLutSize );
+        Dau_DsdPrintFromTruth( Vec_MemCReadEntry(p->vTtMem, i), p->pPars->nLutSize );
     }
     Vec_IntFree( vCounts );
 }
@@ -278,9 +365,9 @@ Vec_Int_t * Mf_ManDeriveCnfs( Mf_Man_t * p, int * pnVars, int * pnClas, int * pn
     for ( iFunc = 0; iFunc < 2; iFunc++ )
     {
         if ( p->pPars->nLutSize <= 6 )
-            nCubes = Abc_Tt6Cnf( *Vec_MemReadEntry(p->vTtMem, iFunc), iFunc, pCnf );
+            nCubes = Abc_Tt6Cnf( *Vec_MemCReadEntry(p->vTtMem, iFunc), iFunc, pCnf );
         else
-            nCubes = Abc_Tt8Cnf( Vec_MemReadEntry(p->vTtMem, iFunc), iFunc, pCnf );
+            nCubes = Abc_Tt8Cnf( Vec_MemCReadEntry(p->vTtMem, iFunc), iFunc, pCnf );
         nLits = Mf_ManCountLits( pCnf, nCubes, iFunc );
         Vec_IntWriteEntry( vLits, iFunc, nLits );
         Vec_IntWriteEntry( vCnfs, iFunc, Vec_IntSize(vCnfs) );
@@ -302,9 +389,9 @@ Vec_Int_t * Mf_ManDeriveCnfs( Mf_Man_t * p, int * pnVars, int * pnClas, int * pn
         if ( Vec_IntEntry(vCnfs, iFunc) == -1 )
         {
             if ( p->pPars->nLutSize <= 6 )
-                nCubes = Abc_Tt6Cnf( *Vec_MemReadEntry(p->vTtMem, iFunc), Mf_CutSize(pCut), pCnf );
+                nCubes = Abc_Tt6Cnf( *Vec_MemCReadEntry(p->vTtMem, iFunc), Mf_CutSize(pCut), pCnf );
             else
-                nCubes = Abc_Tt8Cnf( Vec_MemReadEntry(p->vTtMem, iFunc), Mf_CutSize(pCut), pCnf );
+                nCubes = Abc_Tt8Cnf( Vec_MemCReadEntry(p->vTtMem, iFunc), Mf_CutSize(pCut), pCnf );
             assert( nCubes == Vec_IntEntry(&p->vCnfSizes, iFunc) );
             nLits = Mf_ManCountLits( pCnf, nCubes, Mf_CutSize(pCut) );
             // save CNF
@@ -420,7 +507,7 @@ Cnf_Dat_t * Mf_ManDeriveCnf( Mf_Man_t * p, int fCnfObjIds, int fAddOrCla )
             continue;
         pCut = Mf_ObjCutBest( p, Id );
         iFunc = Abc_Lit2Var( Mf_CutFunc(pCut) );
-        //Dau_DsdPrintFromTruth( Vec_MemReadEntry(p->vTtMem, iFunc), 3 );
+        //Dau_DsdPrintFromTruth( Vec_MemCReadEntry(p->vTtMem, iFunc), 3 );
         fComplLast = Abc_LitIsCompl( Mf_CutFunc(pCut) );
         for ( k = 0; k < Mf_CutSize(pCut); k++ )
             pFanins[k] = pCnfIds[pCut[k+1]];
@@ -441,7 +528,7 @@ Cnf_Dat_t * Mf_ManDeriveCnf( Mf_Man_t * p, int fCnfObjIds, int fAddOrCla )
         // generate mapping
         if ( pCnf->vMapping )
         {
-            word pTruth[4], * pTruthP = Vec_MemReadEntry(p->vTtMem, iFunc);
+            word pTruth[4], * pTruthP = Vec_MemCReadEntry(p->vTtMem, iFunc);
             assert( p->pPars->nLutSize <= 8 );
             Abc_TtCopy( pTruth, pTruthP, Abc_Truth6WordNum(p->pPars->nLutSize), Abc_LitIsCompl(iFunc) );
             assert( pCnfIds[Id] >= 0 && pCnfIds[Id] < nVars );
@@ -537,9 +624,9 @@ Cnf_Dat_t * Mf_ManDeriveCnf( Mf_Man_t * p, int fCnfObjIds, int fAddOrCla )
 static inline int Mf_CutComputeTruth6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t * pCut1, int fCompl0, int fCompl1, Mf_Cut_t * pCutR, int fIsXor )
 {
 //    extern int Mf_ManTruthCanonicize( word * t, int nVars );
-    int nOldSupp = pCutR->nLeaves, truthId, fCompl; word t;
-    word t0 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc));
-    word t1 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc));
+    int nOldSupp = pCutR->nLeaves, truthId, fCompl; word t, t0, t1;
+    t0 = *Vec_MemCReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc));
+    t1 = *Vec_MemCReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc));
     if ( Abc_LitIsCompl(pCut0->iFunc) ^ fCompl0 ) t0 = ~t0;
     if ( Abc_LitIsCompl(pCut1->iFunc) ^ fCompl1 ) t1 = ~t1;
     t0 = Abc_Tt6Expand( t0, pCut0->pLeaves, pCut0->nLeaves, pCutR->pLeaves, pCutR->nLeaves );
@@ -549,10 +636,10 @@ static inline int Mf_CutComputeTruth6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t
     if ( !p->pPars->fCnfObjIds )
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Vec_MemCHashInsert(p->vTtMem, &t);
+    if ( p->pPars->fGenCnf && !Mf_ManHasCnfSize(p, truthId) )
+        Mf_ManSetCnfSize( p, truthId, Abc_Tt6CnfSize(t, pCutR->nLeaves) );
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
-    if ( p->pPars->fGenCnf && truthId == Vec_IntSize(&p->vCnfSizes) )
-        Vec_IntPush( &p->vCnfSizes, Abc_Tt6CnfSize(t, pCutR->nLeaves) );
 //    p->nCutMux += Mf_ManTtIsMux( t );
     assert( (int)pCutR->nLeaves <= nOldSupp );
 //    Mf_ManTruthCanonicize( &t, pCutR->nLeaves );
@@ -567,10 +654,8 @@ static inline int Mf_CutComputeTruth( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t *
     int nOldSupp   = pCutR->nLeaves, truthId;
     int LutSize    = p->pPars->nLutSize, fCompl;
     int nWords     = Abc_Truth6WordNum(LutSize);
-    word * pTruth0 = Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc));
-    word * pTruth1 = Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc));
-    Abc_TtCopy( uTruth0, pTruth0, nWords, Abc_LitIsCompl(pCut0->iFunc) ^ fCompl0 );
-    Abc_TtCopy( uTruth1, pTruth1, nWords, Abc_LitIsCompl(pCut1->iFunc) ^ fCompl1 );
+    Abc_TtCopy( uTruth0, Vec_MemCReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc)), nWords, Abc_LitIsCompl(pCut0->iFunc) ^ fCompl0 );
+    Abc_TtCopy( uTruth1, Vec_MemCReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc)), nWords, Abc_LitIsCompl(pCut1->iFunc) ^ fCompl1 );
     Abc_TtExpand( uTruth0, LutSize, pCut0->pLeaves, pCut0->nLeaves, pCutR->pLeaves, pCutR->nLeaves );
     Abc_TtExpand( uTruth1, LutSize, pCut1->pLeaves, pCut1->nLeaves, pCutR->pLeaves, pCutR->nLeaves );
     if ( fIsXor )
@@ -580,20 +665,20 @@ static inline int Mf_CutComputeTruth( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t *
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
 //Kit_DsdPrintFromTruth( uTruth, pCutR->nLeaves ), printf("\n" ), printf("\n" );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Vec_MemCHashInsert(p->vTtMem, uTruth);
+    if ( p->pPars->fGenCnf && LutSize <= 8 && !Mf_ManHasCnfSize(p, truthId) )
+        Mf_ManSetCnfSize( p, truthId, Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) );
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
-    if ( p->pPars->fGenCnf && truthId == Vec_IntSize(&p->vCnfSizes) && LutSize <= 8 )
-        Vec_IntPush( &p->vCnfSizes, Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
     }
 }
 static inline int Mf_CutComputeTruthMux6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t * pCut1, Mf_Cut_t * pCutC, int fCompl0, int fCompl1, int fComplC, Mf_Cut_t * pCutR )
 {
-    int nOldSupp = pCutR->nLeaves, truthId, fCompl; word t;
-    word t0 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc));
-    word t1 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc));
-    word tC = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCutC->iFunc));
+    int nOldSupp = pCutR->nLeaves, truthId, fCompl; word t, t0, t1, tC;
+    t0 = *Vec_MemCReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc));
+    t1 = *Vec_MemCReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc));
+    tC = *Vec_MemCReadEntry(p->vTtMem, Abc_Lit2Var(pCutC->iFunc));
     if ( Abc_LitIsCompl(pCut0->iFunc) ^ fCompl0 ) t0 = ~t0;
     if ( Abc_LitIsCompl(pCut1->iFunc) ^ fCompl1 ) t1 = ~t1;
     if ( Abc_LitIsCompl(pCutC->iFunc) ^ fComplC ) tC = ~tC;
@@ -604,10 +689,10 @@ static inline int Mf_CutComputeTruthMux6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Vec_MemCHashInsert(p->vTtMem, &t);
+    if ( p->pPars->fGenCnf && !Mf_ManHasCnfSize(p, truthId) )
+        Mf_ManSetCnfSize( p, truthId, Abc_Tt6CnfSize(t, pCutR->nLeaves) );
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
-    if ( p->pPars->fGenCnf && truthId == Vec_IntSize(&p->vCnfSizes) )
-        Vec_IntPush( &p->vCnfSizes, Abc_Tt6CnfSize(t, pCutR->nLeaves) );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
 }
@@ -620,12 +705,9 @@ static inline int Mf_CutComputeTruthMux( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_
     int nOldSupp   = pCutR->nLeaves, truthId;
     int LutSize    = p->pPars->nLutSize, fCompl;
     int nWords     = Abc_Truth6WordNum(LutSize);
-    word * pTruth0 = Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc));
-    word * pTruth1 = Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc));
-    word * pTruthC = Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCutC->iFunc));
-    Abc_TtCopy( uTruth0, pTruth0, nWords, Abc_LitIsCompl(pCut0->iFunc) ^ fCompl0 );
-    Abc_TtCopy( uTruth1, pTruth1, nWords, Abc_LitIsCompl(pCut1->iFunc) ^ fCompl1 );
-    Abc_TtCopy( uTruthC, pTruthC, nWords, Abc_LitIsCompl(pCutC->iFunc) ^ fComplC );
+    Abc_TtCopy( uTruth0, Vec_MemCReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc)), nWords, Abc_LitIsCompl(pCut0->iFunc) ^ fCompl0 );
+    Abc_TtCopy( uTruth1, Vec_MemCReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc)), nWords, Abc_LitIsCompl(pCut1->iFunc) ^ fCompl1 );
+    Abc_TtCopy( uTruthC, Vec_MemCReadEntry(p->vTtMem, Abc_Lit2Var(pCutC->iFunc)), nWords, Abc_LitIsCompl(pCutC->iFunc) ^ fComplC );
     Abc_TtExpand( uTruth0, LutSize, pCut0->pLeaves, pCut0->nLeaves, pCutR->pLeaves, pCutR->nLeaves );
     Abc_TtExpand( uTruth1, LutSize, pCut1->pLeaves, pCut1->nLeaves, pCutR->pLeaves, pCutR->nLeaves );
     Abc_TtExpand( uTruthC, LutSize, pCutC->pLeaves, pCutC->nLeaves, pCutR->pLeaves, pCutR->nLeaves );
@@ -634,10 +716,10 @@ static inline int Mf_CutComputeTruthMux( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_
     if ( fCompl ) Abc_TtNot( uTruth, nWords );
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Vec_MemCHashInsert(p->vTtMem, uTruth);
+    if ( p->pPars->fGenCnf && LutSize <= 8 && !Mf_ManHasCnfSize(p, truthId) )
+        Mf_ManSetCnfSize( p, truthId, Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) );
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
-    if ( p->pPars->fGenCnf && truthId == Vec_IntSize(&p->vCnfSizes) && LutSize <= 8 )
-        Vec_IntPush( &p->vCnfSizes, Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
     }
@@ -693,7 +775,7 @@ static inline void Mf_CutPrint( Mf_Man_t * p, Mf_Cut_t * pCut )
     {
         if ( p->pPars->fGenCnf )
             printf( "CNF = %2d  ", Vec_IntEntry(&p->vCnfSizes, Abc_Lit2Var(pCut->iFunc)) );
-        Dau_DsdPrintFromTruth( Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut->iFunc)), pCut->nLeaves );
+        Dau_DsdPrintFromTruth( Vec_MemCReadEntry(p->vTtMem, Abc_Lit2Var(pCut->iFunc)), pCut->nLeaves );
     }
     else
         printf( "\n" );
@@ -720,15 +802,41 @@ static inline int Mf_ManPrepareCuts( Mf_Cut_t * pCuts, Mf_Man_t * p, int iObj, i
     }
     return Mf_CutCreateUnit( pCuts, iObj );
 }
+static inline int Mf_ManFetchPage( Mf_Man_t * p )
+{
+    Vec_Ptr_t * vPages = &p->pOwner->vPages;
+    int iPage;
+    Mf_ManLock( p );
+    // the page array cannot be reallocated while the other threads read it,
+    // but it is allocated for all handles representable by a positive int
+    if ( Vec_PtrSize(vPages) == Vec_PtrCap(vPages) )
+        printf( "Hard limit on the cut memory (2^31 integers) is reached. Quitting...\n" ), exit(1);
+    iPage = Vec_PtrSize(vPages);
+    Vec_PtrPush( vPages, ABC_ALLOC(int, (1<<16)) );
+    Mf_ManUnlock( p );
+    return iPage << 16;
+}
 static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
 {
     int i, * pPlace, iCur, nInts = 1;
     for ( i = 0; i < nCuts; i++ )
         nInts += pCuts[i]->nLeaves + 1;
-    if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
-        p->iCur = ((p->iCur >> 16) + 1) << 16;
-    if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
-        Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
+    if ( p->pOwner ) // thread-local copy writes into its own pages
+    {
+        if ( p->iCur == 0 || (p->iCur & 0xFFFF) + nInts > 0xFFFF )
+            p->iCur = Mf_ManFetchPage( p );
+    }
+    else
+    {
+        if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
+        {
+            if ( (p->iCur >> 16) + 1 == (1 << 15) )
+                printf( "Hard limit on the cut memory (2^31 integers) is reached. Quitting...\n" ), exit(1);
+            p->iCur = ((p->iCur >> 16) + 1) << 16;
+        }
+        if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
+            Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
+    }
     iCur = p->iCur; p->iCur += nInts;
     pPlace = Mf_ManCutSet( p, iCur );
     *pPlace++ = nCuts;
@@ -993,7 +1101,13 @@ static inline int Mf_CutArea( Mf_Man_t * p, int nLeaves, int iFunc )
     if ( nLeaves < 2 )
         return 0;
     if ( p->pPars->fGenCnf )
-        return Vec_IntEntry(&p->vCnfSizes, Abc_Lit2Var(iFunc));
+    {
+        int nCnfSize;
+        Mf_ManLock( p );
+        nCnfSize = Vec_IntEntry(Mf_ManCnfSizes(p), Abc_Lit2Var(iFunc));
+        Mf_ManUnlock( p );
+        return nCnfSize;
+    }
     if ( p->pPars->fOptEdge )
         return nLeaves + p->pPars->nAreaTuner;
     return 1;
@@ -1322,7 +1436,7 @@ Gia_Man_t * Mf_ManDeriveMappingGia( Mf_Man_t * p )
         Vec_IntClear( vLeaves );
         for ( k = 1; k <= Mf_CutSize(pCut); k++ )
             Vec_IntPush( vLeaves, Vec_IntEntry(vCopies, pCut[k]) );
-        pTruth = Vec_MemReadEntry( p->vTtMem, Abc_Lit2Var(Mf_CutFunc(pCut)) );
+        pTruth = Vec_MemCReadEntry( p->vTtMem, Abc_Lit2Var(Mf_CutFunc(pCut)) );
         iLit = Kit_TruthToGia( pNew, (unsigned *)pTruth, Vec_IntSize(vLeaves), vCover, vLeaves, 0 );
         Vec_IntWriteEntry( vCopies, i, Abc_LitNotCond(iLit, Abc_LitIsCompl(Mf_CutFunc(pCut))) );
         // create mapping
@@ -1384,7 +1498,7 @@ Mf_Man_t * Mf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     p->clkStart  = Abc_Clock();
     p->pGia      = pGia;
     p->pPars     = pPars;
-    p->vTtMem    = pPars->fCutMin ? Vec_MemAllocForTT( pPars->nLutSize, 0 ) : NULL;
+    p->vTtMem    = pPars->fCutMin ? Vec_MemCAllocForTT( pPars->nLutSize, 0 ) : NULL;
     p->pLfObjs   = ABC_CALLOC( Mf_Obj_t, Gia_ManObjNum(pGia) );
     p->iCur      = 2;
     Vec_PtrGrow( &p->vPages, 256 );
@@ -1400,21 +1514,25 @@ Mf_Man_t * Mf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     Vec_IntForEachEntry( vFlowRefs, Entry, i )
         p->pLfObjs[i].nFlowRefs = Entry;
     Vec_IntFree(vFlowRefs);
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+#endif
     return p;
 }
 void Mf_ManFree( Mf_Man_t * p )
 {
-    assert( !p->pPars->fGenCnf || Vec_IntSize(&p->vCnfSizes) == Vec_MemEntryNum(p->vTtMem) );
+    assert( !p->pPars->fGenCnf || Vec_IntSize(&p->vCnfSizes) == Vec_MemCEntryNum(p->vTtMem) );
     if ( p->pPars->fCutMin )
-        Vec_MemHashFree( p->vTtMem );
-    if ( p->pPars->fCutMin )
-        Vec_MemFree( p->vTtMem );
+        Vec_MemCFree( p->vTtMem );
     Vec_PtrFreeData( &p->vPages );
     ABC_FREE( p->vCnfSizes.pArray );
     ABC_FREE( p->vCnfMem.pArray );
     ABC_FREE( p->vPages.pArray );
     ABC_FREE( p->vTemp.pArray );
     ABC_FREE( p->pLfObjs );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
     ABC_FREE( p );
 }
 
@@ -1486,7 +1604,7 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
     float MemGia   = Gia_ManMemory(p->pGia) / (1<<20);
     float MemMan   = 1.0 * sizeof(Mf_Obj_t) * Gia_ManObjNum(p->pGia) / (1<<20);
     float MemCuts  = 1.0 * sizeof(int) * (1 << 16) * Vec_PtrSize(&p->vPages) / (1<<20);
-    float MemTt    = p->vTtMem ? Vec_MemMemory(p->vTtMem) / (1<<20) : 0;
+    float MemTt    = p->vTtMem ? Vec_MemCMemory(p->vTtMem) / (1<<20) : 0;
     float MemMap   = Vec_IntMemory(pNew->vMapping) / (1<<20);
     if ( p->CutCount[0] == 0 )
         p->CutCount[0] = 1;
@@ -1510,16 +1628,129 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
         for ( i = 0; i <= p->pPars->nLutSize; i++ )
             printf( "%d = %d  ", i, p->nCutCounts[i] );
         if ( p->vTtMem )
-            printf( "TT = %d (%.2f %%)  ", Vec_MemEntryNum(p->vTtMem), 100.0 * Vec_MemEntryNum(p->vTtMem) / p->CutCount[2] );
+            printf( "TT = %d (%.2f %%)  ", Vec_MemCEntryNum(p->vTtMem), 100.0 * Vec_MemCEntryNum(p->vTtMem) / p->CutCount[2] );
         Abc_PrintTime( 1, "Time",    Abc_Clock() - p->clkStart );
     }
     fflush( stdout );
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cuts using several threads.]
+
+  Description [The nodes are grouped by logic level, with the choice node 
+  placed above its siblings. The nodes of one level are divided into
+  contiguous ranges, which are processed concurrently by thread-local
+  copies of the manager. Each copy saves the cuts into its own memory 
+  pages, fetched from the shared page array, which is allocated in advance
+  and never reallocated. The truth tables are stored in the shared table
+  protected by a mutex. Since the cuts of a node are computed from the cuts
+  of its fanins only, the result does not depend on the number of threads
+  and is the same as the result of the sequential computation.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Wec_t * Mf_ManLevelizeAnds( Mf_Man_t * p )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Vec_Int_t * vLevels = Vec_IntStart( Gia_ManObjNum(pGia) );
+    Vec_Wec_t * vNodes;
+    Gia_Obj_t * pObj;
+    int i, iSibl, Level, LevelMax = 0;
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        Level = Abc_MaxInt( Vec_IntEntry(vLevels, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(vLevels, Gia_ObjFaninId1(pObj, i)) );
+        if ( Gia_ObjIsMuxId(pGia, i) )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevels, Gia_ObjFaninId2(pGia, i)) );
+        if ( (iSibl = Gia_ObjSibl(pGia, i)) )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevels, iSibl) );
+        Vec_IntWriteEntry( vLevels, i, ++Level );
+        LevelMax = Abc_MaxInt( LevelMax, Level );
+    }
+    vNodes = Vec_WecStart( LevelMax + 1 );
+    Gia_ManForEachAndId( pGia, i )
+        Vec_WecPush( vNodes, Vec_IntEntry(vLevels, i), i );
+    Vec_IntFree( vLevels );
+    return vNodes;
+}
+static Mf_Man_t * Mf_ManCopyStart( Mf_Man_t * p )
+{
+    Mf_Man_t * pCopy = ABC_ALLOC( Mf_Man_t, 1 );
+    *pCopy = *p;
+    pCopy->pOwner = p;
+    pCopy->iCur   = 0;
+    // the copy reads the preallocated page array of the owner but never resizes it
+    pCopy->vPages.nSize = Vec_PtrCap( &p->vPages );
+    memset( &pCopy->vTemp, 0, sizeof(Vec_Int_t) );
+    memset( pCopy->CutCount, 0, sizeof(pCopy->CutCount) );
+    memset( pCopy->nCutCounts, 0, sizeof(pCopy->nCutCounts) );
+    return pCopy;
+}
+static void Mf_ManCopyStop( Mf_Man_t * p, Mf_Man_t * pCopy )
+{
+    int i;
+    for ( i = 0; i < 4; i++ )
+        p->CutCount[i] += pCopy->CutCount[i];
+    for ( i = 0; i <= MF_LEAF_MAX; i++ )
+        p->nCutCounts[i] += pCopy->nCutCounts[i];
+    ABC_FREE( pCopy );
+}
+static void Mf_ManComputeCutsTask( void * pArg )
+{
+    Mf_ParTask_t * pTask = (Mf_ParTask_t *)pArg;
+    int i;
+    for ( i = pTask->iStart; i < pTask->iStop; i++ )
+        Mf_ObjMergeOrder( pTask->pCopy, Vec_IntEntry(pTask->vLevel, i) );
+}
+void Mf_ManComputeCutsPar( Mf_Man_t * p )
+{
+    Mf_Man_t * pCopies[MF_PAR_PROC_MAX];
+    Mf_ParTask_t pTasks[MF_PAR_PROC_MAX];
+    Vec_Wec_t * vLevels = Mf_ManLevelizeAnds( p );
+    int nProcs = Abc_MinInt( p->pPars->nProcNum, MF_PAR_PROC_MAX );
+    Vec_Int_t * vLevel;
+    Util_Job_t * pJob;
+    int i, k, nTasks;
+    // allocate the page array for the largest number of handles
+    // and the first page, so that no cutset gets handle 0
+    Vec_PtrGrow( &p->vPages, 1 << 15 );
+    if ( Vec_PtrSize(&p->vPages) == 0 )
+        Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
+    for ( k = 0; k < nProcs; k++ )
+        pCopies[k] = Mf_ManCopyStart( p );
+    pJob = Util_JobStart( Util_PoolGlobal() );
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    {
+        nTasks = Abc_MinInt( nProcs, 1 + Vec_IntSize(vLevel) / MF_PAR_NODE_MIN );
+        for ( k = 0; k < nTasks; k++ )
+        {
+            pTasks[k].pCopy  = pCopies[k];
+            pTasks[k].vLevel = vLevel;
+            pTasks[k].iStart = (int)((word)Vec_IntSize(vLevel) * k / nTasks);
+            pTasks[k].iStop  = (int)((word)Vec_IntSize(vLevel) * (k+1) / nTasks);
+            if ( nTasks == 1 )
+                Mf_ManComputeCutsTask( pTasks + k );
+            else
+                Util_JobSubmit( pJob, Mf_ManComputeCutsTask, pTasks + k );
+        }
+        Util_JobWaitAll( pJob );
+    }
+    Util_JobStop( pJob );
+    for ( k = 0; k < nProcs; k++ )
+        Mf_ManCopyStop( p, pCopies[k] );
+    Vec_WecFree( vLevels );
+}
 void Mf_ManComputeCuts( Mf_Man_t * p )
 {
     int i;
-    Gia_ManForEachAndId( p->pGia, i )
-        Mf_ObjMergeOrder( p, i );
+    if ( p->pPars->nProcNum > 1 )
+        Mf_ManComputeCutsPar( p );
+    else
+        Gia_ManForEachAndId( p->pGia, i )
+            Mf_ObjMergeOrder( p, i );
     Mf_ManSetMapRefs( p );
     Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
 }
@@ -1670,7 +1901,7 @@ Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
     for ( ; p->Iter < p->pPars->nRounds + pPars->nRoundsEla; p->Iter++ )
         Mf_ManComputeMapping( p );
     if ( pPars->fVeryVerbose && pPars->fCutMin )
-        Vec_MemDumpTruthTables( p->vTtMem, Gia_ManName(p->pGia), pPars->nLutSize );
+        Vec_MemCDumpTruthTables( p->vTtMem, Gia_ManName(p->pGia), pPars->nLutSize );
     if ( pPars->fCutMin )
         pNew = Mf_ManDeriveMappingGia( p );
     else if ( pPars->fCoarsen )
@@ -1683,6 +1914,8 @@ Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
 //        Mf_ManProfileTruths( p );
     Gia_ManMappingVerify( pNew );
     Mf_ManPrintQuit( p, pNew );
+    pPars->nCutsAll = (word)p->CutCount[3];
+    pPars->nCutMem  = (word)sizeof(int) * (1 << 16) * Vec_PtrSize(&p->vPages);
     Mf_ManFree( p );
     if ( pCls != pGia )
         Gia_ManStop( pCls );
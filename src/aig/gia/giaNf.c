@@ -26,10 +26,22 @@
 #include "misc/extra/extra.h"
 #include "base/main/main.h"
 #include "misc/vec/vecMem.h"
+#include "misc/vec/vecMemC.h"
 #include "misc/vec/vecWec.h"
 #include "opt/dau/dau.h"
 #include "misc/util/utilNam.h"
 #include "map/scl/sclCon.h"
+#include "misc/util/utilPool.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -42,6 +54,8 @@ ABC_NAMESPACE_IMPL_START
 #define NF_NO_LEAF  31
 #define NF_NO_FUNC  0x3FFFFFF
 #define NF_EPSILON  0.001
+#define NF_PAR_PROC_MAX  64    // the max number of threads
+#define NF_PAR_NODE_MIN  64    // the min number of nodes in one task
 
 typedef struct Nf_Cut_t_ Nf_Cut_t; 
 struct Nf_Cut_t_
@@ -84,7 +98,8 @@ struct Nf_Man_t_
     Gia_Man_t *     pGia;           // derived manager
     Jf_Par_t *      pPars;          // parameters
     // matching
-    Vec_Mem_t *     vTtMem;         // truth tables
+    Vec_Mem_t *     vTtMem;         // truth tables of the library
+    Vec_MemC_t *    vTtMemC;        // truth tables of the cuts
     Vec_Wec_t *     vTt2Match;      // matches for truth tables
     Mio_Cell2_t *   pCells;         // library gates
     int             nCells;         // library gate count
@@ -109,6 +124,23 @@ struct Nf_Man_t_
     abctime         clkStart;       // starting time
     double          CutCount[6];    // cut counts
     int             nCutUseAll;     // objects with useful cuts
+    // parallel computation
+    Vec_Wec_t *     vLevels;        // the nodes grouped by level
+    Nf_Man_t *      pOwner;         // the manager owning the shared data (in thread-local copies)
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;          // protects the page array
+#endif
+};
+
+// the task processing a range of nodes of one level
+typedef struct Nf_ParTask_t_ Nf_ParTask_t; 
+struct Nf_ParTask_t_
+{
+    Nf_Man_t *      pCopy;          // the thread-local manager
+    Vec_Int_t *     vLevel;         // the nodes of the level
+    int             iStart;         // the first node
+    int             iStop;          // the node after the last one
+    void         (* pFunc)( Nf_Man_t *, int ); // the procedure applied to the nodes
 };
 
 static inline int          Nf_Cfg2Int( Nf_Cfg_t Mat )                                { union { int x; Nf_Cfg_t y; } v; v.y = Mat; return v.x;           }
@@ -158,6 +190,32 @@ static inline int          Nf_CfgCompl( Nf_Cfg_t Cfg, int i )
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Locks the data shared by the threads.]
+
+  Description [Does nothing unless called for a thread-local copy.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Nf_ManLock( Nf_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->pOwner )
+        pthread_mutex_lock( &p->pOwner->Mutex );
+#endif
+}
+static inline void Nf_ManUnlock( Nf_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->pOwner )
+        pthread_mutex_unlock( &p->pOwner->Mutex );
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -278,14 +336,12 @@ void Nf_StoCreateGateMaches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, Mio_Cell
     }
     assert( tTemp1 == tCur );
 }
-Mio_Cell2_t * Nf_StoDeriveMatches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, int * pnCells, int fPinFilter, int fPinPerm, int fPinQuick )
+void Nf_StoDeriveMatches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, Mio_Cell2_t * pCells, int nCells, int fPinFilter, int fPinPerm, int fPinQuick )
 {
-    int fVerbose = 0;
     //abctime clk = Abc_Clock();
     Vec_Wec_t * vProfs = Vec_WecAlloc( 1000 );
     Vec_Int_t * vStore = Vec_IntAlloc( 10000 );
     int * pComp[7], * pPerm[7], nPerms[7], i;
-    Mio_Cell2_t * pCells;
     Vec_WecPushLevel( vProfs );
     Vec_WecPushLevel( vProfs );
     for ( i = 1; i <= 6; i++ )
@@ -294,8 +350,7 @@ Mio_Cell2_t * Nf_StoDeriveMatches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, in
         pPerm[i] = Extra_PermSchedule( i );
     for ( i = 1; i <= 6; i++ )
         nPerms[i] = Extra_Factorial( i );
-    pCells = Mio_CollectRootsNewDefault2( 6, pnCells, fVerbose );
-    for ( i = 2; i < *pnCells; i++ )
+    for ( i = 2; i < nCells; i++ )
         Nf_StoCreateGateMaches( vTtMem, vTt2Match, pCells+i, pComp, pPerm, nPerms, vProfs, vStore, fPinFilter, fPinPerm, fPinQuick );
     for ( i = 1; i <= 6; i++ )
         ABC_FREE( pComp[i] );
@@ -304,7 +359,6 @@ Mio_Cell2_t * Nf_StoDeriveMatches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, in
     Vec_WecFree( vProfs );
     Vec_IntFree( vStore );
     //Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
-    return pCells;
 }
 void Nf_StoPrintOne( Nf_Man_t * p, int Count, int t, int i, int GateId, Nf_Cfg_t Mat )
 {
@@ -401,16 +455,29 @@ Nf_Man_t * Nf_StoCreate( Gia_Man_t * pGia, Jf_Par_t * pPars )
     Vec_IntFree(vFlowRefs);
     // matching
     Mio_LibraryMatchesFetch( (Mio_Library_t *)Abc_FrameReadLibGen(), &p->vTtMem, &p->vTt2Match, &p->pCells, &p->nCells, p->pPars->fPinFilter, p->pPars->fPinPerm, p->pPars->fPinQuick );
+    // the truth tables of the library functions keep their IDs
+    p->vTtMemC = Vec_MemCAlloc( 1, 12, 10000 );
+    for ( i = 0; i < Vec_WecSize(p->vTt2Match); i++ )
+    {
+        Entry = Vec_MemCHashInsert( p->vTtMemC, Vec_MemReadEntry(p->vTtMem, i) );
+        assert( Entry == i );
+    }
     p->InvDelayI = p->pCells[3].iDelays[0];
     p->InvAreaW  = p->pCells[3].AreaW;
     p->InvAreaF  = p->pCells[3].AreaF;
     Nf_ObjMatchD(p, 0, 0)->Gate = 0;
     Nf_ObjMatchD(p, 0, 1)->Gate = 1;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+#endif
     // prepare cuts
     return p;
 }
 void Nf_StoDelete( Nf_Man_t * p )
 {
+    Vec_MemCFree( p->vTtMemC );
+    if ( p->vLevels )
+        Vec_WecFree( p->vLevels );
     Vec_PtrFreeData( &p->vPages );
     ABC_FREE( p->vPages.pArray );
     ABC_FREE( p->vMapRefs.pArray );
@@ -421,6 +488,9 @@ void Nf_StoDelete( Nf_Man_t * p )
     ABC_FREE( p->vCutDelays.pArray );
     ABC_FREE( p->vBackup.pArray );
     ABC_FREE( p->pNfObjs );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
     ABC_FREE( p );
 }
 
@@ -442,8 +512,8 @@ static inline int Nf_CutComputeTruth6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut_t
 {
 //    extern int Nf_ManTruthCanonicize( word * t, int nVars );
     int nOldSupp = pCutR->nLeaves, truthId, fCompl; word t;
-    word t0 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc));
-    word t1 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc));
+    word t0 = *Vec_MemCReadEntry(p->vTtMemC, Abc_Lit2Var(pCut0->iFunc));
+    word t1 = *Vec_MemCReadEntry(p->vTtMemC, Abc_Lit2Var(pCut1->iFunc));
     if ( Abc_LitIsCompl(pCut0->iFunc) ^ fCompl0 ) t0 = ~t0;
     if ( Abc_LitIsCompl(pCut1->iFunc) ^ fCompl1 ) t1 = ~t1;
     t0 = Abc_Tt6Expand( t0, pCut0->pLeaves, pCut0->nLeaves, pCutR->pLeaves, pCutR->nLeaves );
@@ -452,7 +522,7 @@ static inline int Nf_CutComputeTruth6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut_t
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Vec_MemCHashInsert(p->vTtMemC, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     pCutR->Useless = Nf_ObjCutUseless( p, truthId );
     assert( (int)pCutR->nLeaves <= nOldSupp );
@@ -461,9 +531,9 @@ static inline int Nf_CutComputeTruth6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut_t
 static inline int Nf_CutComputeTruthMux6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut_t * pCut1, Nf_Cut_t * pCutC, int fCompl0, int fCompl1, int fComplC, Nf_Cut_t * pCutR )
 {
     int nOldSupp = pCutR->nLeaves, truthId, fCompl; word t;
-    word t0 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc));
-    word t1 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc));
-    word tC = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCutC->iFunc));
+    word t0 = *Vec_MemCReadEntry(p->vTtMemC, Abc_Lit2Var(pCut0->iFunc));
+    word t1 = *Vec_MemCReadEntry(p->vTtMemC, Abc_Lit2Var(pCut1->iFunc));
+    word tC = *Vec_MemCReadEntry(p->vTtMemC, Abc_Lit2Var(pCutC->iFunc));
     if ( Abc_LitIsCompl(pCut0->iFunc) ^ fCompl0 ) t0 = ~t0;
     if ( Abc_LitIsCompl(pCut1->iFunc) ^ fCompl1 ) t1 = ~t1;
     if ( Abc_LitIsCompl(pCutC->iFunc) ^ fComplC ) tC = ~tC;
@@ -474,7 +544,7 @@ static inline int Nf_CutComputeTruthMux6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Vec_MemCHashInsert(p->vTtMemC, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     pCutR->Useless = Nf_ObjCutUseless( p, truthId );
     assert( (int)pCutR->nLeaves <= nOldSupp );
@@ -527,8 +597,8 @@ static inline void Nf_CutPrint( Nf_Man_t * p, Nf_Cut_t * pCut )
         printf( " %*s", nDigits, " " );
     printf( "  }   Useless = %d. D = %4d  A = %9.4f  F = %6d  ", 
         pCut->Useless, pCut->Delay, pCut->Flow, pCut->iFunc );
-    if ( p->vTtMem )
-        Dau_DsdPrintFromTruth( Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut->iFunc)), pCut->nLeaves );
+    if ( p->vTtMemC )
+        Dau_DsdPrintFromTruth( Vec_MemCReadEntry(p->vTtMemC, Abc_Lit2Var(pCut->iFunc)), pCut->nLeaves );
     else
         printf( "\n" );
 }
@@ -555,16 +625,35 @@ static inline int Nf_ManPrepareCuts( Nf_Cut_t * pCuts, Nf_Man_t * p, int iObj, i
     }
     return Nf_CutCreateUnit( pCuts, iObj );
 }
+static inline int Nf_ManFetchPage( Nf_Man_t * p )
+{
+    Vec_Ptr_t * vPages = &p->pOwner->vPages;
+    int iPage;
+    Nf_ManLock( p );
+    assert( Vec_PtrSize(vPages) < Vec_PtrCap(vPages) );
+    iPage = Vec_PtrSize(vPages);
+    Vec_PtrPush( vPages, ABC_ALLOC(int, (1<<16)) );
+    Nf_ManUnlock( p );
+    return iPage << 16;
+}
 static inline int Nf_ManSaveCuts( Nf_Man_t * p, Nf_Cut_t ** pCuts, int nCuts, int fUseful )
 {
     int i, * pPlace, iCur, nInts = 1, nCutsNew = 0;
     for ( i = 0; i < nCuts; i++ )
         if ( !fUseful || !pCuts[i]->Useless )
             nInts += pCuts[i]->nLeaves + 1, nCutsNew++;
-    if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
-        p->iCur = ((p->iCur >> 16) + 1) << 16;
-    if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
-        Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
+    if ( p->pOwner ) // thread-local copy writes into its own pages
+    {
+        if ( p->iCur == 0 || (p->iCur & 0xFFFF) + nInts > 0xFFFF )
+            p->iCur = Nf_ManFetchPage( p );
+    }
+    else
+    {
+        if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
+            p->iCur = ((p->iCur >> 16) + 1) << 16;
+        if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
+            Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
+    }
     iCur = p->iCur; p->iCur += nInts;
     pPlace = Nf_ManCutSet( p, iCur );
     *pPlace++ = nCutsNew;
@@ -951,18 +1040,153 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
     p->nCutUseAll  += nCutsUse == nCutsR;
     p->CutCount[5] += Nf_ManCountMatches(p, pCutsR, nCutsR);
 }
-void Nf_ManComputeCuts( Nf_Man_t * p )
+
+/**Function*************************************************************
+
+  Synopsis    [Processes the nodes using several threads.]
+
+  Description [The nodes are grouped by logic level, with the choice node 
+  placed above its siblings. The nodes of one level are divided into
+  contiguous ranges, which are processed concurrently by thread-local
+  copies of the manager. The procedure applied to a node reads the data 
+  of its fanins and writes the data of the node only, so the result does 
+  not depend on the number of threads and is the same as the result of 
+  the sequential computation. When cuts are computed, each copy saves 
+  them into its own memory pages, fetched from the shared page array, 
+  which is allocated in advance and never reallocated, while the truth 
+  tables go into the concurrent table. The cut counters are accumulated 
+  by the copies and added to the manager at the end.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Wec_t * Nf_ManLevelizeAnds( Nf_Man_t * p )
 {
-    Gia_Obj_t * pObj; int i, iFanin;
-    Gia_ManForEachAnd( p->pGia, pObj, i )
-        if ( Gia_ObjIsBuf(pObj) )
+    Gia_Man_t * pGia = p->pGia;
+    Vec_Int_t * vLevels = Vec_IntStart( Gia_ManObjNum(pGia) );
+    Vec_Wec_t * vNodes;
+    Gia_Obj_t * pObj;
+    int i, iSibl, Level, LevelMax = 0;
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        Level = Abc_MaxInt( Vec_IntEntry(vLevels, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(vLevels, Gia_ObjFaninId1(pObj, i)) );
+        if ( Gia_ObjIsMuxId(pGia, i) )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevels, Gia_ObjFaninId2(pGia, i)) );
+        if ( (iSibl = Gia_ObjSibl(pGia, i)) )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevels, iSibl) );
+        Vec_IntWriteEntry( vLevels, i, ++Level );
+        LevelMax = Abc_MaxInt( LevelMax, Level );
+    }
+    vNodes = Vec_WecStart( LevelMax + 1 );
+    Gia_ManForEachAndId( pGia, i )
+        Vec_WecPush( vNodes, Vec_IntEntry(vLevels, i), i );
+    Vec_IntFree( vLevels );
+    return vNodes;
+}
+static Nf_Man_t * Nf_ManCopyStart( Nf_Man_t * p )
+{
+    Nf_Man_t * pCopy = ABC_ALLOC( Nf_Man_t, 1 );
+    *pCopy = *p;
+    pCopy->pOwner = p;
+    pCopy->iCur   = 0;
+    // the copy reads the preallocated page array of the owner but never resizes it
+    pCopy->vPages.nSize = Vec_PtrCap( &p->vPages );
+    memset( &pCopy->vBackup, 0, sizeof(Vec_Int_t) );
+    memset( pCopy->CutCount, 0, sizeof(pCopy->CutCount) );
+    pCopy->nCutUseAll = 0;
+    return pCopy;
+}
+static void Nf_ManCopyStop( Nf_Man_t * p, Nf_Man_t * pCopy )
+{
+    int i;
+    for ( i = 0; i < 6; i++ )
+        p->CutCount[i] += pCopy->CutCount[i];
+    p->nCutUseAll += pCopy->nCutUseAll;
+    ABC_FREE( pCopy );
+}
+static void Nf_ManPerformTask( void * pArg )
+{
+    Nf_ParTask_t * pTask = (Nf_ParTask_t *)pArg;
+    int i;
+    for ( i = pTask->iStart; i < pTask->iStop; i++ )
+        pTask->pFunc( pTask->pCopy, Vec_IntEntry(pTask->vLevel, i) );
+}
+static void Nf_ManPerformPar( Nf_Man_t * p, void (* pFunc)( Nf_Man_t *, int ) )
+{
+    Nf_Man_t * pCopies[NF_PAR_PROC_MAX];
+    Nf_ParTask_t pTasks[NF_PAR_PROC_MAX];
+    int nProcs = Abc_MinInt( p->pPars->nProcNum, NF_PAR_PROC_MAX );
+    Vec_Int_t * vLevel;
+    Util_Job_t * pJob;
+    int i, k, nTasks;
+    if ( p->vLevels == NULL )
+        p->vLevels = Nf_ManLevelizeAnds( p );
+    for ( k = 0; k < nProcs; k++ )
+        pCopies[k] = Nf_ManCopyStart( p );
+    pJob = Util_JobStart( Util_PoolGlobal() );
+    Vec_WecForEachLevel( p->vLevels, vLevel, i )
+    {
+        nTasks = Abc_MinInt( nProcs, 1 + Vec_IntSize(vLevel) / NF_PAR_NODE_MIN );
+        for ( k = 0; k < nTasks; k++ )
         {
-            iFanin = Gia_ObjFaninId0(pObj, i);
-            Nf_ObjSetCutFlow( p, i,  Nf_ObjCutFlow(p, iFanin) );
-            Nf_ObjSetCutDelay( p, i, Nf_ObjCutDelay(p, iFanin) );
+            pTasks[k].pCopy  = pCopies[k];
+            pTasks[k].vLevel = vLevel;
+            pTasks[k].iStart = (int)((word)Vec_IntSize(vLevel) * k / nTasks);
+            pTasks[k].iStop  = (int)((word)Vec_IntSize(vLevel) * (k+1) / nTasks);
+            pTasks[k].pFunc  = pFunc;
+            if ( nTasks == 1 )
+                Nf_ManPerformTask( pTasks + k );
+            else
+                Util_JobSubmit( pJob, Nf_ManPerformTask, pTasks + k );
         }
-        else
-            Nf_ObjMergeOrder( p, i );
+        Util_JobWaitAll( pJob );
+    }
+    Util_JobStop( pJob );
+    for ( k = 0; k < nProcs; k++ )
+        Nf_ManCopyStop( p, pCopies[k] );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cuts of all nodes.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Nf_ObjComputeCuts( Nf_Man_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+    int iFanin;
+    if ( Gia_ObjIsBuf(pObj) )
+    {
+        iFanin = Gia_ObjFaninId0(pObj, iObj);
+        Nf_ObjSetCutFlow( p, iObj,  Nf_ObjCutFlow(p, iFanin) );
+        Nf_ObjSetCutDelay( p, iObj, Nf_ObjCutDelay(p, iFanin) );
+    }
+    else
+        Nf_ObjMergeOrder( p, iObj );
+}
+void Nf_ManComputeCuts( Nf_Man_t * p )
+{
+    int i;
+    if ( p->pPars->nProcNum > 1 )
+    {
+        // allocate the page array for the largest number of handles
+        // and the first page, so that no cutset gets handle 0
+        Vec_PtrGrow( &p->vPages, 1 << 15 );
+        if ( Vec_PtrSize(&p->vPages) == 0 )
+            Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
+        Nf_ManPerformPar( p, Nf_ObjComputeCuts );
+    }
+    else
+        Gia_ManForEachAndId( p->pGia, i )
+            Nf_ObjComputeCuts( p, i );
 }
 
 
@@ -1002,7 +1226,7 @@ void Nf_ManPrintInit( Nf_Man_t * p )
     printf( "Iter = %d  ",    p->pPars->nRounds );//+ p->pPars->nRoundsEla );
     printf( "Coarse = %d   ", p->pPars->fCoarsen );
     printf( "Cells = %d  ",   p->nCells );
-    printf( "Funcs = %d  ",   Vec_MemEntryNum(p->vTtMem) );
+    printf( "Funcs = %d  ",   Vec_MemCEntryNum(p->vTtMemC) );
     printf( "Matches = %d  ", Vec_WecSizeSize(p->vTt2Match)/2 );
     printf( "And = %d  ",     Gia_ManAndNum(p->pGia) );
     nChoices = Gia_ManChoiceNum( p->pGia );
@@ -1017,7 +1241,7 @@ void Nf_ManPrintQuit( Nf_Man_t * p )
     float MemGia   = Gia_ManMemory(p->pGia) / (1<<20);
     float MemMan   =(1.0 * sizeof(Nf_Obj_t) + 8.0 * sizeof(int)) * Gia_ManObjNum(p->pGia) / (1<<20);
     float MemCuts  = 1.0 * sizeof(int) * (1 << 16) * Vec_PtrSize(&p->vPages) / (1<<20);
-    float MemTt    = p->vTtMem ? Vec_MemMemory(p->vTtMem) / (1<<20) : 0;
+    float MemTt    = p->vTtMemC ? Vec_MemCMemory(p->vTtMemC) / (1<<20) : 0;
     if ( p->CutCount[0] == 0 )
         p->CutCount[0] = 1;
     if ( !p->pPars->fVerbose )
@@ -1028,6 +1252,8 @@ void Nf_ManPrintQuit( Nf_Man_t * p )
     printf( "Cut = %.0f (%.1f)  ",      p->CutCount[3], 1.0*p->CutCount[3]/Gia_ManAndNum(p->pGia) );
     printf( "Use = %.0f (%.1f)  ",      p->CutCount[4], 1.0*p->CutCount[4]/Gia_ManAndNum(p->pGia) );
     printf( "Mat = %.0f (%.1f)  ",      p->CutCount[5], 1.0*p->CutCount[5]/Gia_ManAndNum(p->pGia) );
+    if ( p->vTtMemC )
+    printf( "Funcs = %d  ",             Vec_MemCEntryNum(p->vTtMemC) );
 //    printf( "Equ = %d (%.2f %%)  ",     p->nCutUseAll,  100.0*p->nCutUseAll /p->CutCount[0] );
     printf( "\n" );
     printf( "Gia = %.2f MB  ",          MemGia );
@@ -1379,14 +1605,22 @@ void Nf_ManCutMatch( Nf_Man_t * p, int iObj )
     }
 */
 }
+void Nf_ObjComputeMapping( Nf_Man_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+    if ( Gia_ObjIsBuf(pObj) )
+        Nf_ObjPrepareBuf( p, pObj );
+    else
+        Nf_ManCutMatch( p, iObj );
+}
 void Nf_ManComputeMapping( Nf_Man_t * p )
 {
-    Gia_Obj_t * pObj; int i;
-    Gia_ManForEachAnd( p->pGia, pObj, i )
-        if ( Gia_ObjIsBuf(pObj) )
-            Nf_ObjPrepareBuf( p, pObj );
-        else
-            Nf_ManCutMatch( p, i );
+    int i;
+    if ( p->pPars->nProcNum > 1 )
+        Nf_ManPerformPar( p, Nf_ObjComputeMapping );
+    else
+        Gia_ManForEachAndId( p->pGia, i )
+            Nf_ObjComputeMapping( p, i );
 }
 
 
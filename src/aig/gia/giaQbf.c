@@ -291,8 +291,10 @@ Qbf_Man_t * Gia_QbfAlloc( Gia_Man_t * pGia, int nPars, int fGlucose, int fVerbos
     Qbf_Man_t * p;
     Cnf_Dat_t * pCnf;
     Gia_ObjFlipFaninC0( Gia_ManPo(pGia, 0) );
+    Gia_ManSoaUpdateCo( pGia, Gia_ManPo(pGia, 0) );
     pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( pGia, 8, 0, 1, 0, 0 );
     Gia_ObjFlipFaninC0( Gia_ManPo(pGia, 0) );
+    Gia_ManSoaUpdateCo( pGia, Gia_ManPo(pGia, 0) );
     p = ABC_CALLOC( Qbf_Man_t, 1 );
     p->clkStart   = Abc_Clock();
     p->pGia       = pGia;
@@ -19,6 +19,8 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "misc/util/utilSimd.h"
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -27,6 +29,18 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define GIA_SIM_PROC_MAX   64          // the max number of threads
+#define GIA_SIM_CACHE      (1 << 18)   // the target size of the frontier info of one block
+
+typedef struct Gia_SimTask_t_ Gia_SimTask_t;
+struct Gia_SimTask_t_
+{
+    Gia_ManSim_t * p;             // the simulation manager
+    int            iStart;        // the first word
+    int            iStop;         // the word after the last one
+    int            nBlock;        // the number of words in one block
+};
+
 static inline unsigned * Gia_SimData( Gia_ManSim_t * p, int i )    { return p->pDataSim + i * p->nWords;    }
 static inline unsigned * Gia_SimDataCi( Gia_ManSim_t * p, int i )  { return p->pDataSimCis + i * p->nWords; }
 static inline unsigned * Gia_SimDataCo( Gia_ManSim_t * p, int i )  { return p->pDataSimCos + i * p->nWords; }
@@ -172,6 +186,7 @@ void Gia_ManSimSetDefaultParams( Gia_ParSim_t * p )
     p->fCheckMiter  =   0;    // check if miter outputs are non-zero 
     p->fVerbose     =   0;    // enables verbose output
     p->iOutFail     =  -1;    // index of the failed output
+    p->nProcs       =   1;    // the number of threads
 }
 
 /**Function*************************************************************
@@ -329,9 +344,7 @@ static inline void Gia_ManSimInfoOne( Gia_ManSim_t * p, unsigned * pInfo )
 ***********************************************************************/
 static inline void Gia_ManSimInfoCopy( Gia_ManSim_t * p, unsigned * pInfo, unsigned * pInfo0 )
 {
-    int w;
-    for ( w = p->nWords-1; w >= 0; w-- )
-        pInfo[w] = pInfo0[w];
+    Abc_SimdCopy( pInfo, pInfo0, 0, p->nWords );
 }
 
 /**Function*************************************************************
@@ -345,13 +358,11 @@ static inline void Gia_ManSimInfoCopy( Gia_ManSim_t * p, unsigned * pInfo, unsig
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iCi )
+static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iCi, int iStart, int nUnits )
 {
-    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
-    unsigned * pInfo0 = Gia_SimDataCi( p, iCi );
-    int w;
-    for ( w = p->nWords-1; w >= 0; w-- )
-        pInfo[w] = pInfo0[w];
+    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) ) + iStart;
+    unsigned * pInfo0 = Gia_SimDataCi( p, iCi ) + iStart;
+    Abc_SimdCopy( pInfo, pInfo0, 0, nUnits );
 }
 
 /**Function*************************************************************
@@ -365,17 +376,11 @@ static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iC
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pObj )
+static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pObj, int iStart, int nUnits )
 {
-    unsigned * pInfo  = Gia_SimDataCo( p, iCo );
-    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
-    int w;
-    if ( Gia_ObjFaninC0(pObj) )
-        for ( w = p->nWords-1; w >= 0; w-- )
-            pInfo[w] = ~pInfo0[w];
-    else 
-        for ( w = p->nWords-1; w >= 0; w-- )
-            pInfo[w] = pInfo0[w];
+    unsigned * pInfo  = Gia_SimDataCo( p, iCo ) + iStart;
+    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) ) + iStart;
+    Abc_SimdCopy( pInfo, pInfo0, Gia_ObjFaninC0(pObj), nUnits );
 }
 
 /**Function*************************************************************
@@ -389,30 +394,12 @@ static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pOb
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj )
+static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iStart, int nUnits )
 {
-    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
-    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
-    unsigned * pInfo1 = Gia_SimData( p, Gia_ObjDiff1(pObj) );
-    int w;
-    if ( Gia_ObjFaninC0(pObj) )
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~pInfo0[w] & pInfo1[w];
-    }
-    else 
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & ~pInfo1[w];
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & pInfo1[w];
-    }
+    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) ) + iStart;
+    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) ) + iStart;
+    unsigned * pInfo1 = Gia_SimData( p, Gia_ObjDiff1(pObj) ) + iStart;
+    Abc_SimdAnd( pInfo, pInfo0, pInfo1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), 0, nUnits );
 }
 
 /**Function*************************************************************
@@ -472,35 +459,118 @@ void Gia_ManSimInfoTransfer( Gia_ManSim_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManSimulateRound( Gia_ManSim_t * p )
+void Gia_ManSimulateRoundRange( Gia_ManSim_t * p, int iStart, int nUnits )
 {
     Gia_Obj_t * pObj;
     int i, iCis = 0, iCos = 0;
-    assert( p->pAig->nFront > 0 );
-    assert( Gia_ManConst0(p->pAig)->Value == 0 );
-    Gia_ManSimInfoZero( p, Gia_SimData(p, 0) );
     Gia_ManForEachObj1( p->pAig, pObj, i )
     {
         if ( Gia_ObjIsAndOrConst0(pObj) )
         {
             assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateNode( p, pObj );
+            Gia_ManSimulateNode( p, pObj, iStart, nUnits );
         }
         else if ( Gia_ObjIsCo(pObj) )
         {
             assert( Gia_ObjValue(pObj) == GIA_NONE );
-            Gia_ManSimulateCo( p, iCos++, pObj );
+            Gia_ManSimulateCo( p, iCos++, pObj, iStart, nUnits );
         }
         else // if ( Gia_ObjIsCi(pObj) )
         {
             assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateCi( p, pObj, iCis++ );
+            Gia_ManSimulateCi( p, pObj, iCis++, iStart, nUnits );
         }
     }
     assert( Gia_ManCiNum(p->pAig) == iCis );
     assert( Gia_ManCoNum(p->pAig) == iCos );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Simulates a range of blocks of simulation words.]
+
+  Description [Each block is simulated through the whole AIG before 
+  moving to the next one, so that the frontier of one block stays in
+  the cache.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimulateWorkerTask( void * pArg )
+{
+    Gia_SimTask_t * pTask = (Gia_SimTask_t *)pArg;
+    int w;
+    for ( w = pTask->iStart; w < pTask->iStop; w += pTask->nBlock )
+        Gia_ManSimulateRoundRange( pTask->p, w, Abc_MinInt(pTask->nBlock, pTask->iStop - w) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of words in one block.]
+
+  Description [The block is chosen so that the simulation info of the 
+  frontier fits into GIA_SIM_CACHE bytes. Blocks are multiples of 16 
+  words, so that different threads do not share cache lines.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManSimBlockSize( Gia_ManSim_t * p )
+{
+    int nBlock = GIA_SIM_CACHE / (4 * Abc_MaxInt(p->pAig->nFront, 1));
+    return Abc_MaxInt( 16, nBlock & ~15 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one round.]
+
+  Description [If several threads are requested, the simulation words
+  are divided among them; each thread simulates its words through the 
+  whole AIG. The result does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimulateRound( Gia_ManSim_t * p )
+{
+    Gia_SimTask_t Tasks[GIA_SIM_PROC_MAX];
+    Util_Job_t * pJob;
+    int nBlock = Gia_ManSimBlockSize( p );
+    int nBlocks = (p->nWords + nBlock - 1) / nBlock;
+    int nProcs = Abc_MinInt( Abc_MinInt(p->pPars->nProcs, GIA_SIM_PROC_MAX), nBlocks );
+    int i;
+    assert( p->pAig->nFront > 0 );
+    assert( Gia_ManConst0(p->pAig)->Value == 0 );
+    Gia_ManSimInfoZero( p, Gia_SimData(p, 0) );
+    if ( nProcs <= 1 )
+    {
+        Tasks[0].p      = p;
+        Tasks[0].iStart = 0;
+        Tasks[0].iStop  = p->nWords;
+        Tasks[0].nBlock = nBlock;
+        Gia_ManSimulateWorkerTask( Tasks );
+        return;
+    }
+    pJob = Util_JobStart( Util_PoolGlobal() );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Tasks[i].p      = p;
+        Tasks[i].iStart = Abc_MinInt( nBlocks * i / nProcs * nBlock, p->nWords );
+        Tasks[i].iStop  = Abc_MinInt( nBlocks * (i+1) / nProcs * nBlock, p->nWords );
+        Tasks[i].nBlock = nBlock;
+        Util_JobSubmit( pJob, Gia_ManSimulateWorkerTask, Tasks + i );
+    }
+    Util_JobWaitAll( pJob );
+    Util_JobStop( pJob );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns index of the PO and pattern that failed it.]
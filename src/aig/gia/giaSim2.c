@@ -19,6 +19,8 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "misc/util/utilSimd.h"
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -38,6 +40,16 @@ struct Gia_Sim2_t_
     Vec_Int_t *    vClassNew;
 };
 
+#define GIA_SIM2_PROC_MAX  64          // the max number of threads
+
+typedef struct Gia_Sim2Task_t_ Gia_Sim2Task_t;
+struct Gia_Sim2Task_t_
+{
+    Gia_Sim2_t *   p;             // the simulation manager
+    int            iStart;        // the first word
+    int            nUnits;        // the number of words
+};
+
 static inline unsigned * Gia_Sim2Data( Gia_Sim2_t * p, int i )    { return p->pDataSim + i * p->nWords;    }
 
 extern void Gia_ManResetRandom( Gia_ParSim_t * pPars );
@@ -172,9 +184,7 @@ static inline void Gia_Sim2InfoOne( Gia_Sim2_t * p, unsigned * pInfo )
 ***********************************************************************/
 static inline void Gia_Sim2InfoCopy( Gia_Sim2_t * p, unsigned * pInfo, unsigned * pInfo0 )
 {
-    int w;
-    for ( w = p->nWords-1; w >= 0; w-- )
-        pInfo[w] = pInfo0[w];
+    Abc_SimdCopy( pInfo, pInfo0, 0, p->nWords );
 }
 
 /**Function*************************************************************
@@ -188,17 +198,11 @@ static inline void Gia_Sim2InfoCopy( Gia_Sim2_t * p, unsigned * pInfo, unsigned
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_Sim2SimulateCo( Gia_Sim2_t * p, Gia_Obj_t * pObj )
+static inline void Gia_Sim2SimulateCo( Gia_Sim2_t * p, Gia_Obj_t * pObj, int iStart, int nUnits )
 {
-    unsigned * pInfo  = Gia_Sim2Data( p, Gia_ObjValue(pObj) );
-    unsigned * pInfo0 = Gia_Sim2Data( p, Gia_ObjFaninId0(pObj, Gia_ObjValue(pObj)) );
-    int w;
-    if ( Gia_ObjFaninC0(pObj) )
-        for ( w = p->nWords-1; w >= 0; w-- )
-            pInfo[w] = ~pInfo0[w];
-    else 
-        for ( w = p->nWords-1; w >= 0; w-- )
-            pInfo[w] = pInfo0[w];
+    unsigned * pInfo  = Gia_Sim2Data( p, Gia_ObjValue(pObj) ) + iStart;
+    unsigned * pInfo0 = Gia_Sim2Data( p, Gia_ObjFaninId0(pObj, Gia_ObjValue(pObj)) ) + iStart;
+    Abc_SimdCopy( pInfo, pInfo0, Gia_ObjFaninC0(pObj), nUnits );
 }
 
 /**Function*************************************************************
@@ -212,30 +216,12 @@ static inline void Gia_Sim2SimulateCo( Gia_Sim2_t * p, Gia_Obj_t * pObj )
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_Sim2SimulateNode( Gia_Sim2_t * p, Gia_Obj_t * pObj )
+static inline void Gia_Sim2SimulateNode( Gia_Sim2_t * p, Gia_Obj_t * pObj, int iStart, int nUnits )
 {
-    unsigned * pInfo  = Gia_Sim2Data( p, Gia_ObjValue(pObj) );
-    unsigned * pInfo0 = Gia_Sim2Data( p, Gia_ObjFaninId0(pObj, Gia_ObjValue(pObj)) );
-    unsigned * pInfo1 = Gia_Sim2Data( p, Gia_ObjFaninId1(pObj, Gia_ObjValue(pObj)) );
-    int w;
-    if ( Gia_ObjFaninC0(pObj) )
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~pInfo0[w] & pInfo1[w];
-    }
-    else 
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & ~pInfo1[w];
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & pInfo1[w];
-    }
+    unsigned * pInfo  = Gia_Sim2Data( p, Gia_ObjValue(pObj) ) + iStart;
+    unsigned * pInfo0 = Gia_Sim2Data( p, Gia_ObjFaninId0(pObj, Gia_ObjValue(pObj)) ) + iStart;
+    unsigned * pInfo1 = Gia_Sim2Data( p, Gia_ObjFaninId1(pObj, Gia_ObjValue(pObj)) ) + iStart;
+    Abc_SimdAnd( pInfo, pInfo0, pInfo1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), 0, nUnits );
 }
 
 /**Function*************************************************************
@@ -272,23 +258,66 @@ static inline void Gia_Sim2InfoTransfer( Gia_Sim2_t * p )
 
   SeeAlso     []
 
+***********************************************************************/
+void Gia_Sim2WorkerTask( void * pArg )
+{
+    Gia_Sim2Task_t * pTask = (Gia_Sim2Task_t *)pArg;
+    Gia_Sim2_t * p = pTask->p;
+    Gia_Obj_t * pObj;
+    int i;
+    Gia_ManForEachAnd( p->pAig, pObj, i )
+    {
+        assert( Gia_ObjValue(pObj) == i );
+        Gia_Sim2SimulateNode( p, pObj, pTask->iStart, pTask->nUnits );
+    }
+    Gia_ManForEachCo( p->pAig, pObj, i )
+        Gia_Sim2SimulateCo( p, pObj, pTask->iStart, pTask->nUnits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description [The random inputs are generated by the calling thread,
+  then the simulation words are divided among the threads (in multiples 
+  of 16 words). The result does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
 ***********************************************************************/
 static inline void Gia_Sim2SimulateRound( Gia_Sim2_t * p )
 {
+    Gia_Sim2Task_t Tasks[GIA_SIM2_PROC_MAX];
+    Util_Job_t * pJob;
     Gia_Obj_t * pObj;
+    int nChunks = (p->nWords + 15) / 16;
+    int nProcs = Abc_MinInt( Abc_MinInt(p->pPars->nProcs, GIA_SIM2_PROC_MAX), nChunks );
     int i;
     pObj = Gia_ManConst0(p->pAig);
     assert( Gia_ObjValue(pObj) == 0 );
     Gia_Sim2InfoZero( p, Gia_Sim2Data(p, Gia_ObjValue(pObj)) );
     Gia_ManForEachPi( p->pAig, pObj, i )
         Gia_Sim2InfoRandom( p, Gia_Sim2Data(p, Gia_ObjValue(pObj)) );
-    Gia_ManForEachAnd( p->pAig, pObj, i )
+    if ( nProcs <= 1 )
     {
-        assert( Gia_ObjValue(pObj) == i );
-        Gia_Sim2SimulateNode( p, pObj );
+        Tasks[0].p      = p;
+        Tasks[0].iStart = 0;
+        Tasks[0].nUnits = p->nWords;
+        Gia_Sim2WorkerTask( Tasks );
+        return;
     }
-    Gia_ManForEachCo( p->pAig, pObj, i )
-        Gia_Sim2SimulateCo( p, pObj );
+    pJob = Util_JobStart( Util_PoolGlobal() );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Tasks[i].p      = p;
+        Tasks[i].iStart = Abc_MinInt( 16 * (nChunks * i / nProcs), p->nWords );
+        Tasks[i].nUnits = Abc_MinInt( 16 * (nChunks * (i+1) / nProcs), p->nWords ) - Tasks[i].iStart;
+        Util_JobSubmit( pJob, Gia_Sim2WorkerTask, Tasks + i );
+    }
+    Util_JobWaitAll( pJob );
+    Util_JobStop( pJob );
 }
 
 
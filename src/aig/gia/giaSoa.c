@@ -0,0 +1,272 @@
+/**CFile****************************************************************
+
+  FileName    [giaSoa.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Structure-of-arrays copy of the AIG.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaSoa.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the structure-of-arrays copy of the AIG.]
+
+  Description [The fanin literals are stored in two integer arrays and
+  the marks are stored as bitsets, so that a traversal reading only the
+  structure streams through 8 bytes and 2 bits per object, compared to
+  12 bytes of Gia_Obj_t plus the parallel arrays indexed by object ID.
+  The old copy, if any, is replaced.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Soa_t * Gia_ManSoaStart( Gia_Man_t * p )
+{
+    Gia_Soa_t * pSoa;
+    Gia_Obj_t * pObj;
+    int i, nWords = Abc_Bit6WordNum( Gia_ManObjNum(p) );
+    Gia_ManSoaStop( p );
+    pSoa = ABC_CALLOC( Gia_Soa_t, 1 );
+    pSoa->nObjs  = Gia_ManObjNum(p);
+    pSoa->fPlain = (p->pMuxes == NULL);
+    pSoa->pFans0 = ABC_ALLOC( int, pSoa->nObjs );
+    pSoa->pFans1 = ABC_ALLOC( int, pSoa->nObjs );
+    pSoa->pMark0 = ABC_CALLOC( word, nWords );
+    pSoa->pMark1 = ABC_CALLOC( word, nWords );
+    Gia_ManForEachObj( p, pObj, i )
+    {
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            pSoa->pFans0[i] = Gia_ObjFaninLit0( pObj, i );
+            pSoa->pFans1[i] = Gia_ObjFaninLit1( pObj, i );
+            if ( Gia_ObjIsXor(pObj) || (!p->fGiaSimple && Gia_ObjIsBuf(pObj)) )
+                pSoa->fPlain = 0;
+        }
+        else if ( Gia_ObjIsCo(pObj) )
+        {
+            pSoa->pFans0[i] = Gia_ObjFaninLit0( pObj, i );
+            pSoa->pFans1[i] = -1;
+        }
+        else
+        {
+            pSoa->pFans0[i] = -1;
+            pSoa->pFans1[i] = -1;
+        }
+    }
+    return p->pSoa = pSoa;
+}
+void Gia_ManSoaStop( Gia_Man_t * p )
+{
+    if ( p->pSoa == NULL )
+        return;
+    ABC_FREE( p->pSoa->pFans0 );
+    ABC_FREE( p->pSoa->pFans1 );
+    ABC_FREE( p->pSoa->pMark0 );
+    ABC_FREE( p->pSoa->pMark1 );
+    ABC_FREE( p->pSoa );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects AND nodes in the TFI of the COs in the DFS order.]
+
+  Description [Produces the same order as Gia_ManCollectAnds() applied
+  to all COs. Uses an explicit stack and the first mark as the visited
+  flag, so the traversal does not touch Gia_Obj_t or the traversal IDs.]
+
+  SideEffects [Cleans the first mark of the copy.]
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSoaCollectAnds( Gia_Man_t * p, Vec_Int_t * vNodes )
+{
+    Gia_Soa_t * pSoa = p->pSoa;
+    Vec_Int_t * vStack = Vec_IntAlloc( 1000 );
+    int i, Id, iFan0, iFan1;
+    assert( Gia_ManHasSoa(p) );
+    Gia_SoaCleanMark0( pSoa );
+    for ( i = 0; i < pSoa->nObjs; i++ )
+        if ( !Gia_SoaObjIsAnd(pSoa, i) )
+            Gia_SoaObjSetMark0( pSoa, i );
+    Vec_IntClear( vNodes );
+    for ( i = 0; i < pSoa->nObjs; i++ )
+    {
+        if ( !Gia_SoaObjIsCo(pSoa, i) )
+            continue;
+        Vec_IntPush( vStack, Gia_SoaObjFaninId0(pSoa, i) );
+        while ( Vec_IntSize(vStack) > 0 )
+        {
+            Id = Vec_IntEntryLast( vStack );
+            if ( Gia_SoaObjMark0(pSoa, Id) )
+            {
+                Vec_IntPop( vStack );
+                continue;
+            }
+            iFan0 = Gia_SoaObjFaninId0( pSoa, Id );
+            if ( !Gia_SoaObjMark0(pSoa, iFan0) )
+            {
+                Vec_IntPush( vStack, iFan0 );
+                continue;
+            }
+            iFan1 = Gia_SoaObjFaninId1( pSoa, Id );
+            if ( !Gia_SoaObjMark0(pSoa, iFan1) )
+            {
+                Vec_IntPush( vStack, iFan1 );
+                continue;
+            }
+            Vec_IntPop( vStack );
+            Gia_SoaObjSetMark0( pSoa, Id );
+            Vec_IntPush( vNodes, Id );
+        }
+    }
+    Vec_IntFree( vStack );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the levels using the structure-of-arrays copy.]
+
+  Description [Produces the same result as Gia_ManLevelNum() for the
+  AIGs composed of AND gates.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSoaLevelNum( Gia_Man_t * p )
+{
+    Gia_Soa_t * pSoa = p->pSoa;
+    int i, * pLevels;
+    assert( Gia_ManHasSoa(p) && pSoa->fPlain );
+    Gia_ManCleanLevels( p, Gia_ManObjNum(p) );
+    pLevels = Vec_IntArray( p->vLevels );
+    p->nLevels = 0;
+    for ( i = 0; i < pSoa->nObjs; i++ )
+    {
+        if ( Gia_SoaObjIsAnd(pSoa, i) )
+            pLevels[i] = 1 + Abc_MaxInt( pLevels[Gia_SoaObjFaninId0(pSoa, i)], pLevels[Gia_SoaObjFaninId1(pSoa, i)] );
+        else if ( Gia_SoaObjIsCo(pSoa, i) )
+            pLevels[i] = pLevels[Gia_SoaObjFaninId0(pSoa, i)];
+        else
+            pLevels[i] = 0;
+        p->nLevels = Abc_MaxInt( p->nLevels, pLevels[i] );
+    }
+    return p->nLevels;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares traversals of the two representations.]
+
+  Description [Runs the DFS collection and the level computation several
+  times using Gia_Obj_t and using the structure-of-arrays copy, checks
+  that the results are the same, and prints the runtime and the number
+  of bytes read per object.]
+
+  SideEffects [Deletes the copy, if the manager has one.]
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSoaBench( Gia_Man_t * p, int nIters, int fVerbose )
+{
+    Gia_Soa_t * pSoa;
+    Vec_Int_t * vCos   = Vec_IntAlloc( Gia_ManCoNum(p) );
+    Vec_Int_t * vNodes = Vec_IntAlloc( Gia_ManAndNum(p) );
+    Vec_Int_t * vNodes2 = Vec_IntAlloc( Gia_ManAndNum(p) );
+    Vec_Int_t * vLevels;
+    abctime clk, clkDfs[2] = {0}, clkLev[2] = {0};
+    int i, Id, nLevels[2] = {0};
+    Gia_ManForEachCoId( p, Id, i )
+        Vec_IntPush( vCos, Id );
+    // array of structures
+    Gia_ManSoaStop( p );
+    for ( i = 0; i < nIters; i++ )
+    {
+        clk = Abc_Clock();
+        Gia_ManIncrementTravId( p );
+        Gia_ManCollectAnds( p, Vec_IntArray(vCos), Vec_IntSize(vCos), vNodes, NULL );
+        clkDfs[0] += Abc_Clock() - clk;
+        clk = Abc_Clock();
+        nLevels[0] = Gia_ManLevelNum( p );
+        clkLev[0] += Abc_Clock() - clk;
+    }
+    vLevels = p->vLevels; p->vLevels = NULL;
+    // structure of arrays
+    clk = Abc_Clock();
+    pSoa = Gia_ManSoaStart( p );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Creating the copy", Abc_Clock() - clk );
+    for ( i = 0; i < nIters; i++ )
+    {
+        clk = Abc_Clock();
+        Gia_ManSoaCollectAnds( p, vNodes2 );
+        clkDfs[1] += Abc_Clock() - clk;
+        if ( pSoa->fPlain )
+        {
+            clk = Abc_Clock();
+            nLevels[1] = Gia_ManSoaLevelNum( p );
+            clkLev[1] += Abc_Clock() - clk;
+        }
+    }
+    // compare the results
+    if ( !Vec_IntEqual(vNodes, vNodes2) )
+        printf( "Gia_ManSoaBench(): The DFS orders are different.\n" );
+    if ( pSoa->fPlain && (nLevels[0] != nLevels[1] || !Vec_IntEqual(vLevels, p->vLevels)) )
+        printf( "Gia_ManSoaBench(): The levels are different.\n" );
+    printf( "Objects = %d.  ANDs in the TFI of the COs = %d.  Levels = %d.  Iterations = %d.\n",
+        Gia_ManObjNum(p), Vec_IntSize(vNodes), nLevels[0], nIters );
+    printf( "Bytes read per object: array of structures = %d.  structure of arrays = %d (plus 2 bits).\n",
+        (int)sizeof(Gia_Obj_t) + (int)sizeof(int), 2 * (int)sizeof(int) );
+    Abc_PrintTime( 1, "DFS (AoS)      ", clkDfs[0] );
+    Abc_PrintTime( 1, "DFS (SoA)      ", clkDfs[1] );
+    Abc_PrintTime( 1, "Levels (AoS)   ", clkLev[0] );
+    if ( pSoa->fPlain )
+        Abc_PrintTime( 1, "Levels (SoA)   ", clkLev[1] );
+    else
+        printf( "Levels (SoA)    : skipped because the AIG has XORs, MUXes or buffers.\n" );
+    Vec_IntFree( vCos );
+    Vec_IntFree( vNodes );
+    Vec_IntFree( vNodes2 );
+    if ( p->vLevels == NULL )
+        p->vLevels = vLevels;
+    else
+        Vec_IntFree( vLevels );
+    Gia_ManSoaStop( p );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
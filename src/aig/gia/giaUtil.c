@@ -506,6 +506,8 @@ int Gia_ManLevelNum( Gia_Man_t * p )
 {
     Gia_Obj_t * pObj;
     int i;
+    if ( Gia_ManHasSoa(p) && p->pSoa->fPlain )
+        return Gia_ManSoaLevelNum( p );
     Gia_ManCleanLevels( p, Gia_ManObjNum(p) );
     p->nLevels = 0;
     Gia_ManForEachObj( p, pObj, i )
@@ -1489,14 +1491,20 @@ void Gia_ManInvertConstraints( Gia_Man_t * pAig )
         return;
     Gia_ManForEachPo( pAig, pObj, i )
         if ( i >= Gia_ManPoNum(pAig) - Gia_ManConstrNum(pAig) )
+        {
             Gia_ObjFlipFaninC0( pObj );
+            Gia_ManSoaUpdateCo( pAig, pObj );
+        }
 }
 void Gia_ManInvertPos( Gia_Man_t * pAig )
 {
     Gia_Obj_t * pObj;
     int i;
     Gia_ManForEachPo( pAig, pObj, i )
+    {
         Gia_ObjFlipFaninC0( pObj );
+        Gia_ManSoaUpdateCo( pAig, pObj );
+    }
 }
 
 /**Function*************************************************************
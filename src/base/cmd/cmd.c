@@ -28,6 +28,8 @@
 #include "base/main/mainInt.h"
 #include "cmdInt.h"
 #include "misc/util/utilSignal.h"
+#include "misc/util/utilPool.h"
+#include "misc/util/utilZip.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -835,12 +837,15 @@ int CmdCommandSetVariable( Abc_Frame_t * pAbc, int argc, char **argv )
                     pAbc->Hst = NULL;
             }
         }
+        if ( strcmp( argv[1], "threads" ) == 0 )
+            Util_PoolSetThreadNum( atoi(flag_value) );
         return 0;
     }
 
   usage:
     fprintf( pAbc->Err, "usage: set [-h] <name> <value>\n" );
     fprintf( pAbc->Err, "\t        sets the value of parameter <name>\n" );
+    fprintf( pAbc->Err, "\t        (\"set threads <num>\" sets the size of the thread pool used by parallel engines)\n" );
     fprintf( pAbc->Err, "\t-h    : print the command usage\n" );
     return 1;
 
@@ -890,6 +895,8 @@ int CmdCommandUnsetVariable( Abc_Frame_t * pAbc, int argc, char **argv )
             ABC_FREE( key );
             ABC_FREE( value );
         }
+        if ( strcmp( argv[i], "threads" ) == 0 )
+            Util_PoolSetThreadNum( 0 );
     }
     return 0;
 
@@ -1327,11 +1334,12 @@ int CmfFindNumber( char * pName )
 ***********************************************************************/
 void CnfDupFileUnzip( char * pOldName )
 {
-    extern char * Io_MvLoadFileBz2( char * pFileName, int * pnFileSize );
     char pNewName[1000];
     FILE * pFile;
     int nFileSize;
-    char * pBuffer = Io_MvLoadFileBz2( pOldName, &nFileSize );
+    char * pBuffer = Abc_ZipReadFile( pOldName, 0, &nFileSize );
+    if ( pBuffer == NULL )
+        return;
     assert( strlen(pOldName) < 1000 );
     sprintf( pNewName, "%s.v", pOldName );
     pFile = fopen( pNewName, "wb" );
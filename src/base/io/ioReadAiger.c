@@ -29,6 +29,7 @@
 #include "bzlib.h"
 #include "zlib.h"
 #include "ioAbc.h"
+#include "misc/util/utilZip.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -98,128 +99,6 @@ Vec_Int_t * Io_WriteDecodeLiterals( char ** ppPos, int nEntries )
 }
 
 
-/**Function*************************************************************
-
-  Synopsis    [Reads the file into a character buffer.]
-
-  Description []
-               
-  SideEffects []
-
-  SeeAlso     []
-
-***********************************************************************/
-typedef struct buflist {
-  char buf[1<<20];
-  int nBuf;
-  struct buflist * next;
-} buflist;
-
-static char * Ioa_ReadLoadFileBz2Aig( char * pFileName, int * pFileSize )
-{
-    FILE    * pFile;
-    int       nFileSize = 0;
-    char    * pContents;
-    BZFILE  * b;
-    int       bzError;
-    struct buflist * pNext;
-    buflist * bufHead = NULL, * buf = NULL;
-    int RetValue;
-
-    pFile = fopen( pFileName, "rb" );
-    if ( pFile == NULL )
-    {
-        printf( "Ioa_ReadLoadFileBz2(): The file is unavailable (absent or open).\n" );
-        return NULL;
-    }
-    b = BZ2_bzReadOpen(&bzError,pFile,0,0,NULL,0);
-    if (bzError != BZ_OK) {
-        printf( "Ioa_ReadLoadFileBz2(): BZ2_bzReadOpen() failed with error %d.\n",bzError );
-        return NULL;
-    }
-    do {
-        if (!bufHead)
-            buf = bufHead = ABC_ALLOC( buflist, 1 );
-        else
-            buf = buf->next = ABC_ALLOC( buflist, 1 );
-        nFileSize += buf->nBuf = BZ2_bzRead(&bzError,b,buf->buf,1<<20);
-        buf->next = NULL;
-    } while (bzError == BZ_OK);
-    if (bzError == BZ_STREAM_END) {
-        // we're okay
-        char * p;
-        int nBytes = 0;
-        BZ2_bzReadClose(&bzError,b);
-        p = pContents = ABC_ALLOC( char, nFileSize + 10 );
-        buf = bufHead;
-        do {
-            memcpy(p+nBytes,buf->buf,buf->nBuf);
-            nBytes += buf->nBuf;
-//        } while((buf = buf->next));
-            pNext = buf->next;
-            ABC_FREE( buf );
-        } while((buf = pNext));
-    } else if (bzError == BZ_DATA_ERROR_MAGIC) {
-        // not a BZIP2 file
-        BZ2_bzReadClose(&bzError,b);
-        fseek( pFile, 0, SEEK_END );
-        nFileSize = ftell( pFile );
-        if ( nFileSize == 0 )
-        {
-            printf( "Ioa_ReadLoadFileBz2(): The file is empty.\n" );
-            return NULL;
-        }
-        pContents = ABC_ALLOC( char, nFileSize + 10 );
-        rewind( pFile );
-        RetValue = fread( pContents, nFileSize, 1, pFile );
-    } else { 
-        // Some other error.
-        printf( "Ioa_ReadLoadFileBz2(): Unable to read the compressed BLIF.\n" );
-        return NULL;
-    }
-    fclose( pFile );
-    // finish off the file with the spare .end line
-    // some benchmarks suddenly break off without this line
-//    strcpy( pContents + nFileSize, "\n.end\n" );
-    *pFileSize = nFileSize;
-    return pContents;
-}
-
-/**Function*************************************************************
-
-  Synopsis    [Reads the file into a character buffer.]
-
-  Description []
-               
-  SideEffects []
-
-  SeeAlso     []
-
-***********************************************************************/
-static char * Ioa_ReadLoadFileGzAig( char * pFileName, int * pFileSize )
-{
-    const int READ_BLOCK_SIZE = 100000;
-    gzFile pFile;
-    char * pContents;
-    int amtRead, readBlock, nFileSize = READ_BLOCK_SIZE;
-    pFile = gzopen( pFileName, "rb" ); // if pFileName doesn't end in ".gz" then this acts as a passthrough to fopen
-    pContents = ABC_ALLOC( char, nFileSize );        
-    readBlock = 0;
-    while ((amtRead = gzread(pFile, pContents + readBlock * READ_BLOCK_SIZE, READ_BLOCK_SIZE)) == READ_BLOCK_SIZE) {
-        //printf("%d: read %d bytes\n", readBlock, amtRead);
-        nFileSize += READ_BLOCK_SIZE;
-        pContents = ABC_REALLOC(char, pContents, nFileSize);
-        ++readBlock;
-    }
-    //printf("%d: read %d bytes\n", readBlock, amtRead);
-    assert( amtRead != -1 ); // indicates a zlib error
-    nFileSize -= (READ_BLOCK_SIZE - amtRead);
-    gzclose(pFile);
-    *pFileSize = nFileSize;
-    return pContents;
-}
-
-
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
@@ -247,10 +126,12 @@ Abc_Ntk_t * Io_ReadAiger( char * pFileName, int fCheck )
     int RetValue;
 
     // read the file into the buffer
-    if ( !strncmp(pFileName+strlen(pFileName)-4,".bz2",4) )
-        pContents = Ioa_ReadLoadFileBz2Aig( pFileName, &nFileSize );
-    else if ( !strncmp(pFileName+strlen(pFileName)-3,".gz",3) )
-        pContents = Ioa_ReadLoadFileGzAig( pFileName, &nFileSize );
+    if ( Abc_ZipIsCompressed( pFileName ) )
+    {
+        pContents = Abc_ZipReadFile( pFileName, 1, &nFileSize );
+        if ( pContents == NULL )
+            return NULL;
+    }
     else
     {
 //        pContents = Ioa_ReadLoadFile( pFileName );
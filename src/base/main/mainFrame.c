@@ -22,6 +22,7 @@
 #include "mainInt.h"
 #include "bool/dec/dec.h"
 #include "map/if/if.h"
+#include "misc/util/utilPool.h"
 
 #ifdef ABC_USE_CUDD
 #include "bdd/extrab/extraBdd.h"
@@ -196,6 +197,7 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
 //    Abc_HManStop();
 //    undefine_cube_size();
     Rwt_ManGlobalStop();
+    Util_PoolStopGlobal();
 //    Ivy_TruthManStop();
     if ( p->vAbcObjIds)  Vec_IntFree( p->vAbcObjIds );
     if ( p->vCexVec   )  Vec_PtrFreeFree( p->vCexVec );
@@ -0,0 +1,90 @@
+/**CFile****************************************************************
+
+  FileName    [cutbench.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [ABC as a static library.]
+
+  Synopsis    [A stand-alone program benchmarking the cut engines.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: cutbench.c,v 1.00 2005/11/14 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// procedures to start and stop the ABC framework
+// (should be called before and after the ABC procedures are called)
+extern void   Abc_Start();
+extern void   Abc_Stop();
+
+// procedures to get the ABC framework and execute commands in it
+extern void * Abc_FrameGetGlobalFrame();
+extern int    Cmd_CommandExecute( void * pAbc, char * sCommand );
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [The main() procedure.]
+
+  Description [Passes the command-line arguments to the command &cutbench,
+  for example: "cutbench -K 6 -C 8 -F report.json file1.aig file2.aig".
+  Running the program without arguments prints the usage of &cutbench.
+  The arguments are quoted, so that the file names may contain spaces
+  and the characters ';' and '#', which the command line of ABC treats
+  as separators.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int main( int argc, char * argv[] )
+{
+    void * pAbc;
+    char * pCommand;
+    int i, nSize = 100, RetValue;
+    for ( i = 1; i < argc; i++ )
+        nSize += strlen(argv[i]) + 3;
+    pCommand = (char *)malloc( nSize );
+    strcpy( pCommand, argc > 1 ? "&cutbench" : "&cutbench -h" );
+    for ( i = 1; i < argc; i++ )
+    {
+        strcat( pCommand, " \"" );
+        strcat( pCommand, argv[i] );
+        strcat( pCommand, "\"" );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // start the ABC framework
+    Abc_Start();
+    pAbc = Abc_FrameGetGlobalFrame();
+
+    //////////////////////////////////////////////////////////////////////////
+    // run the benchmark
+    RetValue = Cmd_CommandExecute( pAbc, pCommand );
+    if ( RetValue )
+        fprintf( stdout, "Cannot execute command \"%s\".\n", pCommand );
+    free( pCommand );
+
+    //////////////////////////////////////////////////////////////////////////
+    // stop the ABC framework
+    Abc_Stop();
+    return RetValue;
+}
@@ -56,6 +56,8 @@ ABC_NAMESPACE_HEADER_START
 #define IF_INFINITY          100000000  
 // the largest possible user cut cost
 #define IF_COST_MAX          4095 // ((1<<12)-1)
+// the number of extra leaf entries allocated in each cut (the leaves are compared four at a time)
+#define IF_CUT_LEAF_PAD      3
 
 #define IF_BIG_CHAR ((char)120)
 
@@ -143,6 +145,9 @@ struct If_Par_t_
     int                fDoAverage;    // optimize average rather than maximum level
     int                fHashMapping;  // perform AIG hashing after mapping
     int                fVerbose;      // the verbosity flag
+    int                nProcs;        // the number of threads computing cuts
+    int                fCutCompact;   // compacts the cutsets kept for the fanouts
+    int                fKeepSubject;  // keeps the subject AIG with the mapping for incremental remapping
     char *             pLutStruct;    // LUT structure
     float              WireDelay;     // wire delay
     // internal parameters
@@ -241,6 +246,7 @@ struct If_Man_t_
     If_Set_t *         pMemCi;        // memory for CI cutsets
     If_Set_t *         pMemAnd;       // memory for AND cutsets
     If_Set_t *         pFreeList;     // the list of free cutsets
+    Vec_Ptr_t *        vSetChunks;    // additional memory for cutsets
     int                nSmallSupp;    // the small support
     int                nCutsTotal;
     int                nCutsUseless[32];
@@ -281,6 +287,9 @@ struct If_Man_t_
     int                nTableEntries[2]; // hash table entries
     void **            pHashTable[2];    // hash table bins
     Mem_Fixed_t *      pMemEntries;      // memory manager for hash table entries
+    // parallel mapping
+    void *             pParMan;       // the manager of level-parallel mapping
+    int                fParallel;     // this is a thread-local copy of the manager
     // statistics 
 //    abctime                timeTruth;
 };
@@ -294,7 +303,7 @@ struct If_Cut_t_
     float              Delay;         // delay of the cut
     int                iCutFunc;      // TT ID of the cut
     int                uMaskFunc;     // polarity bitmask
-    unsigned           uSign;         // cut signature
+    word               uSign;         // cut signature
     unsigned           Cost    : 12;  // the user's cost of the cut (related to IF_COST_MAX)
     unsigned           fCompl  :  1;  // the complemented attribute 
     unsigned           fUser   :  1;  // using the user's area and delay
@@ -310,6 +319,7 @@ struct If_Set_t_
 {
     short              nCutsMax;      // the max number of cuts
     short              nCuts;         // the current number of cuts
+    int                fCompact;      // the cutset is compacted and allocated separately
     If_Set_t *         pNext;         // next cutset in the free list
     If_Cut_t **        ppCuts;        // the array of pointers to the cuts
 };
@@ -414,8 +424,8 @@ static inline void       If_CutCopy( If_Man_t * p, If_Cut_t * pDst, If_Cut_t * p
 static inline void       If_CutSetup( If_Man_t * p, If_Cut_t * pCut        ) { memset(pCut, 0, p->nCutBytes); pCut->nLimit = p->pPars->nLutSize; }
 
 static inline If_Cut_t * If_ObjCutBest( If_Obj_t * pObj )                    { return &pObj->CutBest;                }
-static inline unsigned   If_ObjCutSign( unsigned ObjId )                     { return (1 << (ObjId % 31));           }
-static inline unsigned   If_ObjCutSignCompute( If_Cut_t * p )                { unsigned s = 0; int i; for ( i = 0; i < If_CutLeaveNum(p); i++ ) s |= If_ObjCutSign(p->pLeaves[i]); return s; }
+static inline word       If_ObjCutSign( unsigned ObjId )                     { return ((word)1 << (ObjId & 0x3F));   }
+static inline word       If_ObjCutSignCompute( If_Cut_t * p )                { word s = 0; int i; for ( i = 0; i < If_CutLeaveNum(p); i++ ) s |= If_ObjCutSign(p->pLeaves[i]); return s; }
 
 static inline float      If_ObjArrTime( If_Obj_t * pObj )                    { return If_ObjCutBest(pObj)->Delay;    }
 static inline void       If_ObjSetArrTime( If_Obj_t * pObj, float ArrTime )  { If_ObjCutBest(pObj)->Delay = ArrTime; }
@@ -565,6 +575,8 @@ extern void            If_DsdManFree( If_DsdMan_t * p, int fVerbose );
 extern void            If_DsdManSave( If_DsdMan_t * p, char * pFileName );
 extern If_DsdMan_t *   If_DsdManLoad( char * pFileName );
 extern void            If_DsdManMerge( If_DsdMan_t * p, If_DsdMan_t * pNew );
+extern void            If_DsdManStore( If_DsdMan_t * p );
+extern void            If_DsdManSetStoreAtExit( If_DsdMan_t * p, int fStore );
 extern void            If_DsdManCleanOccur( If_DsdMan_t * p, int fVerbose );
 extern void            If_DsdManCleanMarks( If_DsdMan_t * p, int fVerbose );
 extern void            If_DsdManInvertMarks( If_DsdMan_t * p, int fVerbose );
@@ -622,13 +634,21 @@ extern void            If_ManSetupCutTriv( If_Man_t * p, If_Cut_t * pCut, int Ob
 extern void            If_ManSetupCiCutSets( If_Man_t * p );
 extern If_Set_t *      If_ManSetupNodeCutSet( If_Man_t * p, If_Obj_t * pObj );
 extern void            If_ManDerefNodeCutSet( If_Man_t * p, If_Obj_t * pObj );
+extern void            If_ManCompactNodeCutSet( If_Man_t * p, If_Obj_t * pObj );
 extern void            If_ManDerefChoiceCutSet( If_Man_t * p, If_Obj_t * pObj );
 extern void            If_ManSetupSetAll( If_Man_t * p, int nCrossCut );
+extern void            If_ManSetupSetMore( If_Man_t * p, int nCutSets );
 /*=== ifMap.c =============================================================*/
 extern int *           If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut );
 extern void            If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst );
 extern void            If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess );
 extern int             If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPreprocess, int fFirst, char * pLabel );
+/*=== ifPar.c =============================================================*/
+extern int             If_ManParCheck( If_Man_t * p, int Mode );
+extern void            If_ManParPerformMappingRound( If_Man_t * p, int Mode, int fPreprocess, int fFirst );
+extern void            If_ManParStop( If_Man_t * p );
+extern void            If_ManParLock( If_Man_t * p );
+extern void            If_ManParUnlock( If_Man_t * p );
 /*=== ifReduce.c ==========================================================*/
 extern void            If_ManImproveMapping( If_Man_t * p );
 /*=== ifSat.c ==========================================================*/
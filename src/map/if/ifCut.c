@@ -20,6 +20,11 @@
 
 #include "if.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define IF_CUT_SSE2
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -109,7 +114,9 @@ int If_CutVerifyCuts( If_Set_t * pCutSet, int fOrdered )
 
   Synopsis    [Returns 1 if pDom is contained in pCut.]
 
-  Description []
+  Description [With SSE2, each leaf of pDom is compared with four leaves
+  of pCut at a time. The cut memory has IF_CUT_LEAF_PAD extra entries, so
+  the last block can be loaded in full; its unused lanes are masked out.]
                
   SideEffects []
 
@@ -118,6 +125,24 @@ int If_CutVerifyCuts( If_Set_t * pCutSet, int fOrdered )
 ***********************************************************************/
 static inline int If_CutCheckDominance( If_Cut_t * pDom, If_Cut_t * pCut )
 {
+#ifdef IF_CUT_SSE2
+    int nLeaves  = (int)pCut->nLeaves;
+    int MaskLast = (1 << (((nLeaves - 1) & 3) + 1)) - 1;
+    int i, k, Mask;
+    assert( pDom->nLeaves <= pCut->nLeaves );
+    for ( i = 0; i < (int)pDom->nLeaves; i++ )
+    {
+        __m128i Leaf = _mm_set1_epi32( pDom->pLeaves[i] );
+        for ( Mask = k = 0; !Mask && k + 4 < nLeaves; k += 4 )
+            Mask = _mm_movemask_ps( _mm_castsi128_ps(_mm_cmpeq_epi32(Leaf, _mm_loadu_si128((__m128i *)(pCut->pLeaves + k)))) );
+        if ( !Mask )
+            Mask = _mm_movemask_ps( _mm_castsi128_ps(_mm_cmpeq_epi32(Leaf, _mm_loadu_si128((__m128i *)(pCut->pLeaves + k)))) ) & MaskLast;
+        if ( !Mask ) // node i in pDom is not contained in pCut
+            return 0;
+    }
+    // every node in pDom is contained in pCut
+    return 1;
+#else
     int i, k;
     assert( pDom->nLeaves <= pCut->nLeaves );
     for ( i = 0; i < (int)pDom->nLeaves; i++ )
@@ -130,6 +155,7 @@ static inline int If_CutCheckDominance( If_Cut_t * pDom, If_Cut_t * pCut )
     }
     // every node in pDom is contained in pCut
     return 1;
+#endif
 }
 
 /**Function*************************************************************
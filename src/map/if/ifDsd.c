@@ -25,6 +25,8 @@
 #include "sat/bsat/satSolver.h"
 #include "aig/gia/gia.h"
 #include "bool/kit/kit.h"
+#include "misc/util/utilPool.h"
+#include "misc/vec/vecHsh.h"
 
 #ifdef ABC_USE_CUDD
 #include "bdd/extrab/extraBdd.h"
@@ -40,15 +42,24 @@
 #endif
 
 #endif
-
-ABC_NAMESPACE_IMPL_START
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#include <process.h>
+#define If_DsdGetPid _getpid
+#else
+#include <unistd.h>
+#define If_DsdGetPid getpid
+#endif
+
+ABC_NAMESPACE_IMPL_START
 
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-#define DSD_VERSION "dsd1"
+#define DSD_VERSION      "dsd2"
+#define DSD_VERSION_PREV "dsd1"   // the format without the structure check cache
 
 // network types
 typedef enum { 
@@ -101,6 +112,12 @@ struct If_DsdMan_t_
     char *         pCellStr;       // symbolic cell description
     int            nObjsPrev;      // previous number of objects
     int            fNewAsUseless;  // set new as useless
+    int            fStoreAtExit;   // merge the manager into its file when it is freed
+    Vec_Int_t *    vCheckKeys;     // structure check cache (DSD literal, LUT size and flags, mask)
+    Vec_Int_t *    vCheckRes;      // structure check cache (the resulting variable sets)
+    Hsh_IntMan_t * pCheckHash;     // structure check cache (hash table)
+    int            nCheckHits;     // statistics
+    int            nCheckMisses;   // statistics
     int            nUniqueHits;    // statistics
     int            nUniqueMisses;  // statistics
     abctime        timeDsd;        // statistics
@@ -220,6 +237,10 @@ char * If_DsdManGetCellStr( If_DsdMan_t * p )
 {
     return p->pCellStr;
 }
+void If_DsdManSetStoreAtExit( If_DsdMan_t * p, int fStore )
+{
+    p->fStoreAtExit = fStore;
+}
 
 /**Function*************************************************************
 
@@ -301,6 +322,9 @@ If_DsdMan_t * If_DsdManAlloc( int nVars, int LutSize )
     if ( LutSize )
     p->pSat     = If_ManSatBuildXY( LutSize );
     p->vCover   = Vec_IntAlloc( 0 );
+    p->vCheckKeys = Vec_IntAlloc( 3 * 1000 );
+    p->vCheckRes  = Vec_IntAlloc( 1000 );
+    p->pCheckHash = Hsh_IntManStart( p->vCheckKeys, 3, 1000 );
     return p;
 }
 void If_DsdManAllocIsops( If_DsdMan_t * p, int nLutSize )
@@ -333,6 +357,8 @@ void If_DsdManAllocIsops( If_DsdMan_t * p, int nLutSize )
 void If_DsdManFree( If_DsdMan_t * p, int fVerbose )
 {
     int v;
+    if ( p->fStoreAtExit )
+        If_DsdManStore( p );
 //    If_DsdManDumpDsd( p );
     if ( fVerbose )
         If_DsdManPrint( p, NULL, 0, 0, 0, 0, 0 );
@@ -364,6 +390,9 @@ void If_DsdManFree( If_DsdMan_t * p, int fVerbose )
     Mem_FlexStop( p->pMem, 0 );
     Gia_ManStopP( &p->pTtGia );
     Vec_IntFreeP( &p->vCover );
+    Vec_IntFreeP( &p->vCheckKeys );
+    Vec_IntFreeP( &p->vCheckRes );
+    Hsh_IntManStop( p->pCheckHash );
     If_ManSatUnbuild( p->pSat );
     ABC_FREE( p->pCellStr );
     ABC_FREE( p->pStore );
@@ -753,6 +782,9 @@ void If_DsdManPrint( If_DsdMan_t * p, char * pFileName, int Number, int Support,
     fprintf( pFile, "Non-DSD AIG nodes          = %8d\n", Gia_ManAndNum(p->pTtGia) );
     fprintf( pFile, "Unique table misses        = %8d\n", p->nUniqueMisses );
     fprintf( pFile, "Unique table hits          = %8d\n", p->nUniqueHits );
+    fprintf( pFile, "Structure checks cached    = %8d\n", Vec_IntSize(p->vCheckRes) );
+    fprintf( pFile, "Structure check cache miss = %8d\n", p->nCheckMisses );
+    fprintf( pFile, "Structure check cache hits = %8d\n", p->nCheckHits );
     fprintf( pFile, "Memory used for objects    = %8.2f MB.\n", 1.0*Mem_FlexReadMemUsage(p->pMem)/(1<<20) );
     fprintf( pFile, "Memory used for functions  = %8.2f MB.\n", 8.0*(MemSizeTTs+sizeof(int)*Vec_IntCap(&p->vTruths))/(1<<20) );
     fprintf( pFile, "Memory used for hash table = %8.2f MB.\n", 1.0*sizeof(int)*(p->nBins+Vec_IntCap(&p->vNexts))/(1<<20) );
@@ -1035,6 +1067,35 @@ int If_DsdObjFindOrAdd( If_DsdMan_t * p, int Type, int * pLits, int nLits, word
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Caching the results of structure checks.]
+
+  Description [The key is the DSD literal, the LUT size with the flags
+  changing the result, and the mask of variables not to be used in the
+  bound set. The cache is saved and loaded together with the manager.
+  Besides the check of each new object, the cuts with known DSD objects
+  are checked by delay-oriented mapping with a LUT structure (&if -S 44 -s)
+  and when the LUT structures of the mapping are derived, which is where
+  the cache hits, also across the runs sharing a manager file.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int If_DsdManCheckCacheLookup( If_DsdMan_t * p, int * pKey )
+{
+    int * pPlace = Hsh_IntManLookup( p->pCheckHash, (unsigned *)pKey );
+    return *pPlace == -1 ? -1 : Hsh_IntObj(p->pCheckHash, *pPlace)->iData;
+}
+static inline void If_DsdManCheckCacheAdd( If_DsdMan_t * p, int * pKey, unsigned uSet )
+{
+    Vec_IntPushArray( p->vCheckKeys, pKey, 3 );
+    Vec_IntPush( p->vCheckRes, (int)uSet );
+    Hsh_IntManAdd( p->pCheckHash, Vec_IntSize(p->vCheckRes) - 1 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Saving/loading DSD manager.]
@@ -1101,6 +1162,13 @@ void If_DsdManSave( If_DsdMan_t * p, char * pFileName )
     fwrite( &Num, 4, 1, pFile );
     if ( Num )
         fwrite( p->pCellStr, sizeof(char)*Num, 1, pFile );
+    Num = Vec_IntSize(p->vCheckRes);
+    fwrite( &Num, 4, 1, pFile );
+    if ( Num )
+    {
+        fwrite( Vec_IntArray(p->vCheckKeys), sizeof(int)*3*Num, 1, pFile );
+        fwrite( Vec_IntArray(p->vCheckRes), sizeof(int)*Num, 1, pFile );
+    }
     fclose( pFile );
 }
 If_DsdMan_t * If_DsdManLoad( char * pFileName )
@@ -1111,7 +1179,7 @@ If_DsdMan_t * If_DsdManLoad( char * pFileName )
     char pBuffer[10];
     unsigned * pSpot;
     word * pTruth;
-    int i, v, Num, Num2, RetValue;
+    int i, v, Num, Num2, RetValue, fPrev;
     FILE * pFile = fopen( pFileName, "rb" );
     if ( pFile == NULL )
     {
@@ -1119,7 +1187,8 @@ If_DsdMan_t * If_DsdManLoad( char * pFileName )
         return NULL;
     }
     RetValue = fread( pBuffer, 4, 1, pFile );
-    if ( strncmp(pBuffer, DSD_VERSION, strlen(DSD_VERSION)) )
+    fPrev = !strncmp(pBuffer, DSD_VERSION_PREV, strlen(DSD_VERSION_PREV));
+    if ( !fPrev && strncmp(pBuffer, DSD_VERSION, strlen(DSD_VERSION)) )
     {
         printf( "Unrecognized format of file \"%s\".\n", pFileName );
         return NULL;
@@ -1195,6 +1264,16 @@ If_DsdMan_t * If_DsdManLoad( char * pFileName )
         p->pCellStr = ABC_CALLOC( char, Num + 1 );
         RetValue = fread( p->pCellStr, sizeof(char)*Num, 1, pFile );
     }
+    RetValue = fPrev ? 0 : fread( &Num, 4, 1, pFile );
+    if ( RetValue && Num )
+    {
+        Vec_IntFill( p->vCheckKeys, 3*Num, 0 );
+        Vec_IntFill( p->vCheckRes, Num, 0 );
+        RetValue = fread( Vec_IntArray(p->vCheckKeys), sizeof(int)*3*Num, 1, pFile );
+        RetValue = fread( Vec_IntArray(p->vCheckRes), sizeof(int)*Num, 1, pFile );
+        for ( i = 0; i < Num; i++ )
+            Hsh_IntManAdd( p->pCheckHash, i );
+    }
     fclose( pFile );
     return p;
 }
@@ -1241,10 +1320,65 @@ void If_DsdManMerge( If_DsdMan_t * p, If_DsdMan_t * pNew )
         Vec_IntPush( vMap, Id );
     }
     assert( Vec_IntSize(vMap) == Vec_PtrSize(&pNew->vObjs) );
+    // the nodes keep the order of fanins, so the cached variable sets remain valid
+    for ( i = 0; i < Vec_IntSize(pNew->vCheckRes); i++ )
+    {
+        int pKey[3];
+        memcpy( pKey, Vec_IntEntryP(pNew->vCheckKeys, 3*i), sizeof(int)*3 );
+        pKey[0] = Abc_Lit2LitV( Vec_IntArray(vMap), pKey[0] );
+        if ( If_DsdManCheckCacheLookup(p, pKey) == -1 )
+            If_DsdManCheckCacheAdd( p, pKey, (unsigned)Vec_IntEntry(pNew->vCheckRes, i) );
+    }
     Vec_IntFree( vMap );
     if ( p->vConfigs && pNew->vConfigs )
         Vec_WrdShrink( p->vConfigs, p->nConfigWords * Vec_PtrSize(&p->vObjs) );
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Merges the manager into its file.]
+
+  Description [If the file exists and contains a compatible manager,
+  the objects, the marks, and the cached structure checks of the given
+  manager are added to those in the file, so that several runs sharing
+  the file accumulate the results. Otherwise, the manager is saved.
+  The result is written into a temporary file, which then replaces the
+  original one, so that other runs never read a partially written file.
+  When two runs store at the same time, the last one wins.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_DsdManStore( If_DsdMan_t * p )
+{
+    If_DsdMan_t * pOld = NULL;
+    char * pFileTemp = ABC_ALLOC( char, strlen(p->pStore) + 20 );
+    FILE * pFile = fopen( p->pStore, "rb" );
+    if ( pFile != NULL )
+    {
+        fclose( pFile );
+        pOld = If_DsdManLoad( p->pStore );
+    }
+    sprintf( pFileTemp, "%s.%d", p->pStore, (int)If_DsdGetPid() );
+    if ( pOld && pOld->nVars >= p->nVars && pOld->LutSize == p->LutSize && 
+         pOld->nTtBits == p->nTtBits && pOld->nConfigWords == p->nConfigWords )
+    {
+        If_DsdManMerge( pOld, p );
+        If_DsdManSave( pOld, pFileTemp );
+    }
+    else
+        If_DsdManSave( p, pFileTemp );
+    if ( pOld )
+        If_DsdManFree( pOld, 0 );
+    if ( rename( pFileTemp, p->pStore ) != 0 )
+    {
+        printf( "Replacing DSD manager file \"%s\" has failed.\n", p->pStore );
+        remove( pFileTemp );
+    }
+    ABC_FREE( pFileTemp );
+}
 void If_DsdManCleanOccur( If_DsdMan_t * p, int fVerbose )
 {
     If_DsdObj_t * pObj; 
@@ -2016,7 +2150,16 @@ unsigned If_DsdManCheckXY_int( If_DsdMan_t * p, int iDsd, int LutSize, int fDeri
 }
 unsigned If_DsdManCheckXY( If_DsdMan_t * p, int iDsd, int LutSize, int fDerive, unsigned uMaskNot, int fHighEffort, int fVerbose )
 {
-    unsigned uSet = If_DsdManCheckXY_int( p, iDsd, LutSize, fDerive, uMaskNot, fVerbose );
+    int pKey[3] = { iDsd, LutSize | (fDerive << 8) | (fHighEffort << 9), (int)uMaskNot };
+    int iEntry = fVerbose ? -1 : If_DsdManCheckCacheLookup( p, pKey );
+    unsigned uSet;
+    if ( iEntry >= 0 )
+    {
+        p->nCheckHits++;
+        return (unsigned)Vec_IntEntry( p->vCheckRes, iEntry );
+    }
+    p->nCheckMisses++;
+    uSet = If_DsdManCheckXY_int( p, iDsd, LutSize, fDerive, uMaskNot, fVerbose );
     if ( uSet == 0 && fHighEffort )
     {
 //        abctime clk = Abc_Clock();
@@ -2030,6 +2173,8 @@ unsigned If_DsdManCheckXY( If_DsdMan_t * p, int iDsd, int LutSize, int fDerive,
         }
 //        p->timeCheck2 += Abc_Clock() - clk;
     }
+    if ( !fVerbose )
+        If_DsdManCheckCacheAdd( p, pKey, uSet );
     return uSet;
 }
 
@@ -2572,33 +2717,17 @@ typedef struct Ifn_ThData_t_
     int         Id;      // object
     int         nConfls; // conflicts
     int         Result;  // result
-    int         Status;  // state
     abctime     clkUsed; // total runtime
 } Ifn_ThData_t;
-void * Ifn_WorkerThread( void * pArg )
+void Ifn_WorkerTask( void * pArg )
 {
     Ifn_ThData_t * pThData = (Ifn_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->Status;
-    abctime clk;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->Status == 1 );
-        if ( pThData->Id == -1 )
-        {
-	        pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        clk = Abc_Clock();
-        memset( pThData->pConfig, 0, sizeof(word) * pThData->nConfigWords );
-        pThData->Result = Ifn_NtkMatch( pThData->pNtk, pThData->pTruth, pThData->nVars, pThData->nConfls, 0, 0, pThData->pConfig );
-        pThData->clkUsed += Abc_Clock() - clk;
-        pThData->Status = 0;
-//        printf( "Finished object %d\n", pThData->Id );
-    }
-	assert( 0 );
-	return NULL;
+    abctime clk = Abc_Clock();
+    assert( pThData->Id >= 0 );
+    memset( pThData->pConfig, 0, sizeof(word) * pThData->nConfigWords );
+    pThData->Result = Ifn_NtkMatch( pThData->pNtk, pThData->pTruth, pThData->nVars, pThData->nConfls, 0, 0, pThData->pConfig );
+    pThData->clkUsed += Abc_Clock() - clk;
+//    printf( "Finished object %d\n", pThData->Id );
 }
 void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs, int fVerbose )
 {
@@ -2658,11 +2787,11 @@ void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs,
 
     // perform concurrent solving
     {
-	    pthread_t WorkerThread[PAR_THR_MAX];
-        Ifn_ThData_t ThData[PAR_THR_MAX];
+        Ifn_ThData_t ThData[PAR_THR_MAX], * pThData = NULL;
+        Util_Job_t * pJob = Util_JobStart( Util_PoolGlobal() );
         abctime clk, clkUsed = 0;
-        int status, fRunning = 1, iCurrentObj = p->nObjsPrev;
-        // start the threads
+        int iCurrentObj = p->nObjsPrev;
+        // the slots are executed by the shared thread pool
         for ( i = 0; i < nProcs; i++ )
         {
             ThData[i].pNtk     = Ifn_NtkParse( pStruct );
@@ -2670,67 +2799,49 @@ void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs,
             ThData[i].Id       = -1;      // object
             ThData[i].nConfls  = nConfls; // conflicts
             ThData[i].Result   = -1;      // result
-            ThData[i].Status   =  0;      // state
             ThData[i].clkUsed  =  0;      // total runtime
             ThData[i].nConfigWords = p->nConfigWords;
-            status = pthread_create( WorkerThread + i, NULL, Ifn_WorkerThread, (void *)(ThData + i) );  assert( status == 0 );
         }
-        // run the threads
-        while ( fRunning || iCurrentObj < Vec_PtrSize(&p->vObjs) )
+        do
         {
-            for ( i = 0; i < nProcs; i++ )
+            if ( pThData != NULL )
             {
-                if ( ThData[i].Status )
-                    continue;
-                assert( ThData[i].Status == 0 );
-                if ( ThData[i].Id >= 0 )
+                //printf( "Closing obj %d with Thread %d:\n", pThData->Id, (int)(pThData - ThData) );
+                assert( pThData->Result == 0 || pThData->Result == 1 );
+                if ( pThData->Result == 0 )
+                    If_DsdVecObjSetMark( &p->vObjs, pThData->Id );
+                else
                 {
-                    //printf( "Closing obj %d with Thread %d:\n", ThData[i].Id, i );
-                    assert( ThData[i].Result == 0 || ThData[i].Result == 1 );
-                    if ( ThData[i].Result == 0 )
-                        If_DsdVecObjSetMark( &p->vObjs, ThData[i].Id );
-                    else
-                    {
-                        word * pTtWords = Vec_WrdEntryP( p->vConfigs, p->nConfigWords * ThData[i].Id );
-                        memcpy( pTtWords, ThData[i].pConfig, sizeof(word) * p->nConfigWords );
-                    }
-                    ThData[i].Id     = -1;
-                    ThData[i].Result = -1;
-                }
-                for ( k = iCurrentObj; k < Vec_PtrSize(&p->vObjs); k++ )
-                {
-                    if ( (k & 0xFF) == 0 )
-                        Extra_ProgressBarUpdate( pProgress, k, NULL );
-                    pObj  = If_DsdVecObj( &p->vObjs, k );
-                    nVars = If_DsdObjSuppSize(pObj);
-                    //if ( nVars <= LutSize )
-                    //    continue;
-                    clk = Abc_Clock();
-                    If_DsdManComputeTruthPtr( p, Abc_Var2Lit(k, 0), NULL, ThData[i].pTruth );
-                    clkUsed += Abc_Clock() - clk;
-                    ThData[i].nVars  = nVars;
-                    ThData[i].Id     =  k;
-                    ThData[i].Result = -1;
-                    ThData[i].Status =  1;
-                    //printf( "Scheduling %d for Thread %d\n", ThData[i].Id, i );
-                    iCurrentObj = k+1;
-                    break;
+                    word * pTtWords = Vec_WrdEntryP( p->vConfigs, p->nConfigWords * pThData->Id );
+                    memcpy( pTtWords, pThData->pConfig, sizeof(word) * p->nConfigWords );
                 }
+                pThData->Id     = -1;
+                pThData->Result = -1;
+            }
+            // give the next objects to the idle slots
+            for ( i = 0; i < nProcs && iCurrentObj < Vec_PtrSize(&p->vObjs); i++ )
+            {
+                if ( ThData[i].Id >= 0 )
+                    continue;
+                k = iCurrentObj++;
+                if ( (k & 0xFF) == 0 )
+                    Extra_ProgressBarUpdate( pProgress, k, NULL );
+                pObj  = If_DsdVecObj( &p->vObjs, k );
+                nVars = If_DsdObjSuppSize(pObj);
+                clk = Abc_Clock();
+                If_DsdManComputeTruthPtr( p, Abc_Var2Lit(k, 0), NULL, ThData[i].pTruth );
+                clkUsed += Abc_Clock() - clk;
+                ThData[i].nVars  = nVars;
+                ThData[i].Id     =  k;
+                ThData[i].Result = -1;
+                Util_JobSubmit( pJob, Ifn_WorkerTask, ThData + i );
+                //printf( "Scheduling %d for Thread %d\n", ThData[i].Id, i );
             }
-            fRunning = 0;
-            for ( i = 0; i < nProcs; i++ )
-                if ( ThData[i].Status == 1 || (ThData[i].Status == 0 && ThData[i].Id >= 0) )
-                    fRunning = 1;
-            //printf( "fRunning %d\n", fRunning );
         }
-        // stop the threads
+        while ( (pThData = (Ifn_ThData_t *)Util_JobWaitNext(pJob)) );
+        Util_JobStop( pJob );
         for ( i = 0; i < nProcs; i++ )
-        {
-            assert( ThData[i].Status == 0 );
-            ThData[i].Id = -1;
-            ThData[i].Status = 1;
             ABC_FREE( ThData[i].pNtk );
-        }
         if ( fVerbose )
         {
             printf( "Main     : " );
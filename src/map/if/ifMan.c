@@ -29,8 +29,18 @@ ABC_NAMESPACE_IMPL_START
 
 static If_Obj_t * If_ManSetupObj( If_Man_t * p );
 
-static void       If_ManCutSetRecycle( If_Man_t * p, If_Set_t * pSet ) { pSet->pNext = p->pFreeList; p->pFreeList = pSet;                            }
-static If_Set_t * If_ManCutSetFetch( If_Man_t * p )                    { If_Set_t * pTemp = p->pFreeList; p->pFreeList = p->pFreeList->pNext; return pTemp; }
+static void       If_ManCutSetRecycle( If_Man_t * p, If_Set_t * pSet ) { if ( pSet->fCompact ) { ABC_FREE( pSet ); return; } pSet->pNext = p->pFreeList; p->pFreeList = pSet; }
+static If_Set_t * If_ManCutSetFetch( If_Man_t * p )                    { If_Set_t * pTemp; if ( p->pFreeList == NULL ) If_ManSetupSetMore( p, 128 ); pTemp = p->pFreeList; p->pFreeList = p->pFreeList->pNext; return pTemp; }
+
+// the visit counters of the fanins are decremented concurrently by level-parallel mapping
+static inline int If_ObjDecVisits( If_Obj_t * pObj )
+{
+#if defined(ABC_USE_PTHREADS) && defined(__GNUC__)
+    return __atomic_sub_fetch( &pObj->nVisits, 1, __ATOMIC_ACQ_REL );
+#else
+    return --pObj->nVisits;
+#endif
+}
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -87,8 +97,8 @@ If_Man_t * If_ManStart( If_Par_t * pPars )
         }
     }
     p->nPermWords  = p->pPars->fUsePerm? If_CutPermWords( p->pPars->nLutSize ) : 0;
-    p->nObjBytes   = sizeof(If_Obj_t) + sizeof(int) * (p->pPars->nLutSize + p->nPermWords);
-    p->nCutBytes   = sizeof(If_Cut_t) + sizeof(int) * (p->pPars->nLutSize + p->nPermWords);
+    p->nObjBytes   = sizeof(If_Obj_t) + sizeof(int) * (p->pPars->nLutSize + p->nPermWords + IF_CUT_LEAF_PAD);
+    p->nCutBytes   = sizeof(If_Cut_t) + sizeof(int) * (p->pPars->nLutSize + p->nPermWords + IF_CUT_LEAF_PAD);
     p->nSetBytes   = sizeof(If_Set_t) + (sizeof(If_Cut_t *) + p->nCutBytes) * (p->pPars->nCutsMax + 1);
     p->pMemObj     = Mem_FixedStart( p->nObjBytes );
     // report expected memory usage
@@ -286,6 +296,9 @@ void If_ManStop( If_Man_t * p )
     Mem_FixedStop( p->pMemObj, 0 );
     ABC_FREE( p->pMemCi );
     ABC_FREE( p->pMemAnd );
+    If_ManParStop( p );
+    if ( p->vSetChunks )
+        Vec_PtrFreeFree( p->vSetChunks );
     ABC_FREE( p->puTemp[0] );
     ABC_FREE( p->puTempW );
     // free pars memory
@@ -485,6 +498,7 @@ void If_ManSetupSet( If_Man_t * p, If_Set_t * pSet )
     int i;
     pSet->nCuts = 0;
     pSet->nCutsMax = p->pPars->nCutsMax;
+    pSet->fCompact = 0;
     pSet->ppCuts = (If_Cut_t **)(pSet + 1);
     pArray = (char *)pSet->ppCuts + sizeof(If_Cut_t *) * (pSet->nCutsMax+1);
     for ( i = 0; i <= pSet->nCutsMax; i++ )
@@ -571,6 +585,7 @@ void If_ManSetupCiCutSets( If_Man_t * p )
         pObj->pCutSet = (If_Set_t *)((char *)p->pMemCi + i * (sizeof(If_Set_t) + sizeof(void *)));
         pObj->pCutSet->nCuts = 1;
         pObj->pCutSet->nCutsMax = p->pPars->nCutsMax;
+        pObj->pCutSet->fCompact = 0;
         pObj->pCutSet->ppCuts = (If_Cut_t **)(pObj->pCutSet + 1);
         pObj->pCutSet->ppCuts[0] = &pObj->CutBest;
     }
@@ -625,7 +640,7 @@ void If_ManDerefNodeCutSet( If_Man_t * p, If_Obj_t * pObj )
     // consider the first fanin
     pFanin = If_ObjFanin0(pObj);
     assert( pFanin->nVisits > 0 );
-    if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+    if ( !If_ObjIsCi(pFanin) && If_ObjDecVisits(pFanin) == 0 )
     {
 //        Mem_FixedEntryRecycle( p->pMemSet, (char *)pFanin->pCutSet );
         If_ManCutSetRecycle( p, pFanin->pCutSet );
@@ -634,7 +649,7 @@ void If_ManDerefNodeCutSet( If_Man_t * p, If_Obj_t * pObj )
     // consider the second fanin
     pFanin = If_ObjFanin1(pObj);
     assert( pFanin->nVisits > 0 );
-    if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+    if ( !If_ObjIsCi(pFanin) && If_ObjDecVisits(pFanin) == 0 )
     {
 //        Mem_FixedEntryRecycle( p->pMemSet, (char *)pFanin->pCutSet );
         If_ManCutSetRecycle( p, pFanin->pCutSet );
@@ -642,6 +657,60 @@ void If_ManDerefNodeCutSet( If_Man_t * p, If_Obj_t * pObj )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Replaces the cutset of the node by its compact copy.]
+
+  Description [The cutsets taken from the free list have room for nCutsMax+1
+  cuts with nLutSize leaves each. The cutset of a node is kept until all of
+  its fanouts are mapped, so in the designs with a wide cut frontier most of
+  the cutset memory is unused. The compact copy stores only the cuts present
+  and only their leaves (and permutations, if used), while the full cutset
+  is returned to the free list. The copy is freed when the node is
+  dereferenced by its last fanout.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int If_ManCutCompactBytes( If_Man_t * p, If_Cut_t * pCut )
+{
+    int nBytes = sizeof(If_Cut_t) + sizeof(int) * (pCut->nLeaves + p->nPermWords);
+    return (nBytes + 7) & ~7;
+}
+void If_ManCompactNodeCutSet( If_Man_t * p, If_Obj_t * pObj )
+{
+    If_Set_t * pCutSet = pObj->pCutSet, * pNew;
+    If_Cut_t * pCut;
+    char * pArray;
+    int i, nBytes;
+    assert( If_ObjIsAnd(pObj) && !pCutSet->fCompact );
+    assert( pObj->nVisits > 0 && pCutSet->nCuts > 0 );
+    nBytes = (sizeof(If_Set_t) + sizeof(If_Cut_t *) * pCutSet->nCuts + 7) & ~7;
+    for ( i = 0; i < pCutSet->nCuts; i++ )
+        nBytes += If_ManCutCompactBytes( p, pCutSet->ppCuts[i] );
+    // the padding lets the leaves of the last cut be read like those of a full cut
+    pNew = (If_Set_t *)ABC_ALLOC( char, nBytes + sizeof(int) * IF_CUT_LEAF_PAD );
+    pNew->nCutsMax = pCutSet->nCuts;
+    pNew->nCuts    = pCutSet->nCuts;
+    pNew->fCompact = 1;
+    pNew->pNext    = NULL;
+    pNew->ppCuts   = (If_Cut_t **)(pNew + 1);
+    pArray = (char *)pNew + ((sizeof(If_Set_t) + sizeof(If_Cut_t *) * pCutSet->nCuts + 7) & ~7);
+    for ( i = 0; i < pCutSet->nCuts; i++ )
+    {
+        pCut = pCutSet->ppCuts[i];
+        pNew->ppCuts[i] = (If_Cut_t *)pArray;
+        memcpy( pArray, pCut, sizeof(If_Cut_t) + sizeof(int) * (pCut->nLeaves + p->nPermWords) );
+        pArray += If_ManCutCompactBytes( p, pCut );
+    }
+    assert( pArray - (char *)pNew == nBytes );
+    memset( pArray, 0, sizeof(int) * IF_CUT_LEAF_PAD );
+    If_ManCutSetRecycle( p, pCutSet );
+    pObj->pCutSet = pNew;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Dereferences cutset of the node.]
@@ -711,6 +780,36 @@ void If_ManSetupSetAll( If_Man_t * p, int nCrossCut )
 
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds cutsets to the free list.]
+
+  Description [Called when the free list is empty, which happens when the
+  nodes are not mapped in the topological order used to compute the cross
+  cut (for example, in the level-parallel mapping).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManSetupSetMore( If_Man_t * p, int nCutSets )
+{
+    If_Set_t * pCutSet, * pChunk;
+    int i;
+    pChunk = pCutSet = (If_Set_t *)ABC_ALLOC( char, nCutSets * p->nSetBytes );
+    if ( p->vSetChunks == NULL )
+        p->vSetChunks = Vec_PtrAlloc( 16 );
+    Vec_PtrPush( p->vSetChunks, pChunk );
+    for ( i = 0; i < nCutSets; i++ )
+    {
+        If_ManSetupSet( p, pCutSet );
+        pCutSet->pNext = (i == nCutSets - 1) ? p->pFreeList : (If_Set_t *)( (char *)pCutSet + p->nSetBytes );
+        pCutSet = (If_Set_t *)( (char *)pCutSet + p->nSetBytes );
+    }
+    p->pFreeList = pChunk;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
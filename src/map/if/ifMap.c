@@ -93,13 +93,9 @@ int If_ManCutAigDelay( If_Man_t * p, If_Obj_t * pObj, If_Cut_t * pCut )
   SeeAlso     []
 
 ***********************************************************************/
-static inline int If_WordCountOnes( unsigned uWord )
+static inline int If_WordCountOnes( word uWord )
 {
-    uWord = (uWord & 0x55555555) + ((uWord>>1) & 0x55555555);
-    uWord = (uWord & 0x33333333) + ((uWord>>2) & 0x33333333);
-    uWord = (uWord & 0x0F0F0F0F) + ((uWord>>4) & 0x0F0F0F0F);
-    uWord = (uWord & 0x00FF00FF) + ((uWord>>8) & 0x00FF00FF);
-    return  (uWord & 0x0000FFFF) + (uWord>>16);
+    return Abc_TtCountOnes( uWord );
 }
 
 /**Function*************************************************************
@@ -177,8 +173,8 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
         pObj->EstRefs = (float)pObj->nRefs;
     else if ( Mode == 1 )
         pObj->EstRefs = (float)((2.0 * pObj->EstRefs + pObj->nRefs) / 3.0);
-    // deref the selected cut
-    if ( Mode && pObj->nRefs > 0 )
+    // deref the selected cut (the parallel round does it for the whole level)
+    if ( Mode && pObj->nRefs > 0 && !p->fParallel )
         If_CutAreaDeref( p, If_ObjCutBest(pObj) );
 
     // prepare the cutset
@@ -296,6 +292,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
             {
                 extern void If_ManCacheRecord( If_Man_t * p, int iDsd0, int iDsd1, int nShared, int iDsd );
                 int truthId = Abc_Lit2Var(pCut->iCutFunc);
+                If_ManParLock( p );
                 if ( truthId >= Vec_IntSize(p->vTtDsds[pCut->nLeaves]) || Vec_IntEntry(p->vTtDsds[pCut->nLeaves], truthId) == -1 )
                 {
                     while ( truthId >= Vec_IntSize(p->vTtDsds[pCut->nLeaves]) )
@@ -308,6 +305,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
                     Vec_IntWriteEntry( p->vTtDsds[pCut->nLeaves], truthId, iCutDsd );
                 }
                 assert( If_DsdManSuppSize(p->pIfDsdMan, If_CutDsdLit(p, pCut)) == (int)pCut->nLeaves );
+                If_ManParUnlock( p );
                 //If_ManCacheRecord( p, If_CutDsdLit(p, pCut0), If_CutDsdLit(p, pCut1), nShared, If_CutDsdLit(p, pCut) );
             }
             // run user functions
@@ -352,7 +350,9 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
             }
             else if ( p->pPars->fUseDsdTune )
             {
+                If_ManParLock( p );
                 pCut->fUseless = If_DsdManReadMark( p->pIfDsdMan, If_CutDsdLit(p, pCut) );
+                If_ManParUnlock( p );
                 p->nCutsUselessAll += pCut->fUseless;
                 p->nCutsUseless[pCut->nLeaves] += pCut->fUseless;
                 p->nCutsCountAll++;
@@ -370,6 +370,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
                 {
                     int iDecMask = -1, truthId = Abc_Lit2Var(pCut->iCutFunc);
                     assert( p->pPars->nLutSize <= 13 );
+                    If_ManParLock( p );
                     if ( truthId >= Vec_IntSize(p->vTtDecs[pCut->nLeaves]) || Vec_IntEntry(p->vTtDecs[pCut->nLeaves], truthId) == -1 )
                     {
                         while ( truthId >= Vec_IntSize(p->vTtDecs[pCut->nLeaves]) )
@@ -381,6 +382,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
                         Vec_IntWriteEntry( p->vTtDecs[pCut->nLeaves], truthId, iDecMask );
                     }
                     iDecMask = Vec_IntEntry(p->vTtDecs[pCut->nLeaves], truthId);
+                    If_ManParUnlock( p );
                     assert( iDecMask >= 0 );
                     pCut->fUseless = (int)(iDecMask == 0 && (int)pCut->nLeaves > p->pPars->nLutSize / 2);
                     p->nCutsUselessAll += pCut->fUseless;
@@ -391,6 +393,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
                 if ( p->pPars->fUseCofVars && (!p->pPars->fUseAndVars || pCut->fUseless) )
                 {
                     int iCofVar = -1, truthId = Abc_Lit2Var(pCut->iCutFunc);
+                    If_ManParLock( p );
                     if ( truthId >= Vec_StrSize(p->vTtVars[pCut->nLeaves]) || Vec_StrEntry(p->vTtVars[pCut->nLeaves], truthId) == (char)-1 )
                     {
                         while ( truthId >= Vec_StrSize(p->vTtVars[pCut->nLeaves]) )
@@ -399,6 +402,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
                         Vec_StrWriteEntry( p->vTtVars[pCut->nLeaves], truthId, (char)iCofVar );
                     }
                     iCofVar = Vec_StrEntry(p->vTtVars[pCut->nLeaves], truthId);
+                    If_ManParUnlock( p );
                     assert( iCofVar >= 0 && iCofVar <= (int)pCut->nLeaves );
                     pCut->fUseless = (int)(iCofVar == (int)pCut->nLeaves && pCut->nLeaves > 0);
                     p->nCutsUselessAll += pCut->fUseless;
@@ -477,7 +481,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
 //        p->nBestCutSmall[1]++;
 
     // ref the selected cut
-    if ( Mode && pObj->nRefs > 0 )
+    if ( Mode && pObj->nRefs > 0 && !p->fParallel )
         If_CutAreaRef( p, If_ObjCutBest(pObj) );
     if ( If_ObjCutBest(pObj)->fUseless )
         Abc_Print( 1, "The best cut is useless.\n" );
@@ -485,6 +489,9 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     if ( p->pPars->pFuncUser )
         If_ObjForEachCut( pObj, pCut, i )
             p->pPars->pFuncUser( p, pObj, pCut );
+    // compact the cuts kept for the fanouts
+    if ( p->pPars->fCutCompact && pObj->nVisits > 0 && p->nChoices == 0 )
+        If_ManCompactNodeCutSet( p, pObj );
     // free the cuts
     If_ManDerefNodeCutSet( p, pObj );
 }
@@ -637,6 +644,8 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+    else if ( If_ManParCheck( p, Mode ) )
+        If_ManParPerformMappingRound( p, Mode, fPreprocess, fFirst );
     else
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
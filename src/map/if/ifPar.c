@@ -0,0 +1,376 @@
+/**CFile****************************************************************
+
+  FileName    [ifPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [FPGA mapping based on priority cuts.]
+
+  Synopsis    [Level-parallel computation of cuts.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - November 21, 2006.]
+
+  Revision    [$Id: ifPar.c,v 1.00 2006/11/21 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "if.h"
+#include "misc/util/utilPool.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define IF_PAR_PROC_MAX   64    // the max number of threads
+#define IF_PAR_NODE_MIN   64    // the min number of nodes in one task
+
+// The nodes of one level do not depend on each other, so their cuts are
+// computed concurrently, while the levels are processed in order. Each thread
+// works with its own shallow copy of the manager, which shares the objects and
+// the parameters with the manager but has its own cutset memory, temporary
+// truth tables and statistics. The truth table store and the DSD manager are
+// shared and protected by a mutex. The cut references are updated for the
+// whole level before and after its nodes are mapped, so the result does not
+// depend on the number of threads.
+typedef struct If_ParMan_t_ If_ParMan_t;
+struct If_ParMan_t_
+{
+    int              nProcs;        // the number of threads
+    If_Man_t *       pCopies[IF_PAR_PROC_MAX]; // thread-local copies of the manager
+    Vec_Wec_t *      vLevels;       // AND nodes by logic level
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;         // protects the shared truth tables and DSD data
+#endif
+};
+
+// the task mapping a range of nodes of one level
+typedef struct If_ParTask_t_ If_ParTask_t;
+struct If_ParTask_t_
+{
+    If_Man_t *       pCopy;         // the thread-local manager
+    Vec_Int_t *      vLevel;        // the nodes of the level
+    int              iStart;        // the first node
+    int              iStop;         // the node after the last one
+    int              Mode;          // the mapping mode
+    int              fPreprocess;   // preprocessing
+    int              fFirst;        // the first round
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the round can be performed in parallel.]
+
+  Description [The level-by-level round is used only when several threads
+  are requested, so the default mapping is computed by the sequential
+  round. With two or more threads, the result does not depend on their
+  number, but it may differ slightly from the sequential one in the 
+  area-flow rounds, because the nodes of one level do not see the updated
+  references of each other. Exact area recovery (Mode 2) evaluates the cuts by updating the references of their
+  cones, which depends on the node order; choices, boxes, and the cost
+  functions keeping their data in the manager are also handled by the
+  sequential code.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManParCheck( If_Man_t * p, int Mode )
+{
+    If_Par_t * pPars = p->pPars;
+    if ( pPars->nProcs < 2 || Mode == 2 || p->pManTim || p->nChoices > 0 )
+        return 0;
+    if ( pPars->pFuncCost || pPars->pFuncUser || pPars->pFuncCell || pPars->pFuncCell2 )
+        return 0;
+    if ( pPars->fDelayOpt || pPars->fDelayOptLut || pPars->fDsdBalance || pPars->fUserRecLib || pPars->fUserSesLib )
+        return 0;
+    if ( pPars->fUse34Spec || pPars->fUseTtPerm || pPars->nGateSize > 0 )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Locks the data shared by the threads.]
+
+  Description [Does nothing unless called for a thread-local copy.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManParLock( If_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->fParallel )
+        pthread_mutex_lock( &((If_ParMan_t *)p->pParMan)->Mutex );
+#endif
+}
+void If_ManParUnlock( If_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->fParallel )
+        pthread_mutex_unlock( &((If_ParMan_t *)p->pParMan)->Mutex );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Manipulates thread-local copies of the manager.]
+
+  Description [The copy is refreshed before each round, because the
+  manager's parameters (such as the sorting mode) change between rounds.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static If_Man_t * If_ManParCopyStart( If_Man_t * p )
+{
+    If_Man_t * pCopy = ABC_CALLOC( If_Man_t, 1 );
+    if ( p->pPars->fTruth )
+    {
+        pCopy->puTemp[0] = ABC_ALLOC( unsigned, 8 * p->nTruth6Words[p->pPars->nLutSize] );
+        pCopy->puTemp[1] = pCopy->puTemp[0] + p->nTruth6Words[p->pPars->nLutSize]*2;
+        pCopy->puTemp[2] = pCopy->puTemp[1] + p->nTruth6Words[p->pPars->nLutSize]*2;
+        pCopy->puTemp[3] = pCopy->puTemp[2] + p->nTruth6Words[p->pPars->nLutSize]*2;
+        pCopy->puTempW   = ABC_ALLOC( word, p->nTruth6Words[p->pPars->nLutSize] );
+    }
+    return pCopy;
+}
+static void If_ManParCopyUpdate( If_Man_t * p, If_Man_t * pCopy )
+{
+    unsigned * puTemp[4];
+    word * puTempW = pCopy->puTempW;
+    If_Set_t * pFreeList = pCopy->pFreeList;
+    Vec_Ptr_t * vSetChunks = pCopy->vSetChunks;
+    memcpy( puTemp, pCopy->puTemp, sizeof(puTemp) );
+    *pCopy = *p;
+    memcpy( pCopy->puTemp, puTemp, sizeof(puTemp) );
+    pCopy->puTempW    = puTempW;
+    pCopy->pFreeList  = pFreeList;
+    pCopy->vSetChunks = vSetChunks;
+    pCopy->fParallel  = 1;
+    // reset the statistics
+    pCopy->nCutsMerged     = 0;
+    pCopy->nCutsTotal      = 0;
+    pCopy->nCutsCountAll   = 0;
+    pCopy->nCutsUselessAll = 0;
+    memset( pCopy->nCutsUseless, 0, sizeof(pCopy->nCutsUseless) );
+    memset( pCopy->nCutsCount, 0, sizeof(pCopy->nCutsCount) );
+    memset( pCopy->timeCache, 0, sizeof(pCopy->timeCache) );
+}
+static void If_ManParCopyCollect( If_Man_t * p, If_Man_t * pCopy )
+{
+    int i;
+    p->nCutsMerged     += pCopy->nCutsMerged;
+    p->nCutsTotal      += pCopy->nCutsTotal;
+    p->nCutsCountAll   += pCopy->nCutsCountAll;
+    p->nCutsUselessAll += pCopy->nCutsUselessAll;
+    for ( i = 0; i < 32; i++ )
+    {
+        p->nCutsUseless[i] += pCopy->nCutsUseless[i];
+        p->nCutsCount[i]   += pCopy->nCutsCount[i];
+    }
+    for ( i = 0; i < 6; i++ )
+        p->timeCache[i] += pCopy->timeCache[i];
+}
+static void If_ManParCopyStop( If_Man_t * pCopy )
+{
+    if ( pCopy->vSetChunks )
+        Vec_PtrFreeFree( pCopy->vSetChunks );
+    ABC_FREE( pCopy->puTemp[0] );
+    ABC_FREE( pCopy->puTempW );
+    ABC_FREE( pCopy );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the parallel mapping manager.]
+
+  Description [The manager is created before the first parallel round and
+  kept until the mapping manager is deleted, so that the cutset memory of
+  the threads is reused in the following rounds.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static If_ParMan_t * If_ManParStart( If_Man_t * p )
+{
+    If_ParMan_t * pPar;
+    If_Obj_t * pObj;
+    int i, LevelMax = 0;
+    if ( p->pParMan )
+        return (If_ParMan_t *)p->pParMan;
+    pPar = ABC_CALLOC( If_ParMan_t, 1 );
+    pPar->nProcs = Abc_MinInt( p->pPars->nProcs, IF_PAR_PROC_MAX );
+    for ( i = 0; i < pPar->nProcs; i++ )
+        pPar->pCopies[i] = If_ManParCopyStart( p );
+    If_ManForEachNode( p, pObj, i )
+        LevelMax = Abc_MaxInt( LevelMax, If_ObjLevel(pObj) );
+    pPar->vLevels = Vec_WecStart( LevelMax + 1 );
+    If_ManForEachNode( p, pObj, i )
+        Vec_WecPush( pPar->vLevels, If_ObjLevel(pObj), pObj->Id );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &pPar->Mutex, NULL );
+#endif
+    p->pParMan = pPar;
+    return pPar;
+}
+void If_ManParStop( If_Man_t * p )
+{
+    If_ParMan_t * pPar = (If_ParMan_t *)p->pParMan;
+    int i;
+    if ( pPar == NULL )
+        return;
+    for ( i = 0; i < pPar->nProcs; i++ )
+        If_ManParCopyStop( pPar->pCopies[i] );
+    Vec_WecFree( pPar->vLevels );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &pPar->Mutex );
+#endif
+    ABC_FREE( pPar );
+    p->pParMan = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps a range of nodes of one level.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_ManParWorkerTask( void * pArg )
+{
+    If_ParTask_t * pTask = (If_ParTask_t *)pArg;
+    If_Obj_t * pObj;
+    int i;
+    for ( i = pTask->iStart; i < pTask->iStop; i++ )
+    {
+        pObj = If_ManObj( pTask->pCopy, Vec_IntEntry(pTask->vLevel, i) );
+        If_ObjPerformMappingAnd( pTask->pCopy, pObj, pTask->Mode, pTask->fPreprocess, pTask->fFirst );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Dereferences or references the selected cuts of one level.]
+
+  Description [The cuts of the nodes on one level contain only the nodes
+  on the lower levels, so the result does not depend on the node order.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_ManParDerefLevel( If_Man_t * p, Vec_Int_t * vLevel, int fDeref )
+{
+    If_Obj_t * pObj;
+    int i, Id;
+    Vec_IntForEachEntry( vLevel, Id, i )
+    {
+        pObj = If_ManObj( p, Id );
+        if ( pObj->nRefs == 0 )
+            continue;
+        if ( fDeref )
+            If_CutAreaDeref( p, If_ObjCutBest(pObj) );
+        else
+            If_CutAreaRef( p, If_ObjCutBest(pObj) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping pass over all nodes using several threads.]
+
+  Description [The nodes of each level are divided into contiguous ranges,
+  one per thread. Since the cuts of a node depend only on the cuts of the
+  nodes on the lower levels, the result is the same for any number of threads.
+  In the area-flow mode, the selected cuts of the level are dereferenced
+  before mapping it and referenced after, as the sequential round does for
+  each node, except that the nodes of one level do not see the updates of
+  each other.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManParPerformMappingRound( If_Man_t * p, int Mode, int fPreprocess, int fFirst )
+{
+    If_ParMan_t * pPar = If_ManParStart( p );
+    If_ParTask_t pTasks[IF_PAR_PROC_MAX];
+    Util_Job_t * pJob;
+    Vec_Int_t * vLevel;
+    int i, k, nTasks;
+    assert( Mode < 2 );
+    for ( k = 0; k < pPar->nProcs; k++ )
+        If_ManParCopyUpdate( p, pPar->pCopies[k] );
+    pJob = Util_JobStart( Util_PoolGlobal() );
+    Vec_WecForEachLevel( pPar->vLevels, vLevel, i )
+    {
+        // dereference the selected cuts of the level
+        if ( Mode )
+            If_ManParDerefLevel( p, vLevel, 1 );
+        nTasks = Abc_MinInt( pPar->nProcs, 1 + Vec_IntSize(vLevel) / IF_PAR_NODE_MIN );
+        for ( k = 0; k < nTasks; k++ )
+        {
+            pTasks[k].pCopy       = pPar->pCopies[k];
+            pTasks[k].vLevel      = vLevel;
+            pTasks[k].iStart      = (int)((word)Vec_IntSize(vLevel) * k / nTasks);
+            pTasks[k].iStop       = (int)((word)Vec_IntSize(vLevel) * (k+1) / nTasks);
+            pTasks[k].Mode        = Mode;
+            pTasks[k].fPreprocess = fPreprocess;
+            pTasks[k].fFirst      = fFirst;
+            if ( nTasks == 1 )
+                If_ManParWorkerTask( pTasks + k );
+            else
+                Util_JobSubmit( pJob, If_ManParWorkerTask, pTasks + k );
+        }
+        Util_JobWaitAll( pJob );
+        // reference the new selected cuts of the level
+        if ( Mode )
+            If_ManParDerefLevel( p, vLevel, 0 );
+    }
+    Util_JobStop( pJob );
+    for ( k = 0; k < pPar->nProcs; k++ )
+        If_ManParCopyCollect( p, pPar->pCopies[k] );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
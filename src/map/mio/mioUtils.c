@@ -25,8 +25,24 @@
 #include "misc/util/utilNam.h"
 #include "map/scl/sclLib.h"
 #include "map/scl/sclCon.h"
-
-ABC_NAMESPACE_IMPL_START
+
+#if defined(LIN) || defined(LIN64)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define MIO_MATCH_USE_MMAP
+#endif
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#include <process.h>
+#define Mio_GetPid _getpid
+#else
+#include <unistd.h>
+#define Mio_GetPid getpid
+#endif
+
+ABC_NAMESPACE_IMPL_START
 
 
 ////////////////////////////////////////////////////////////////////////
@@ -1666,9 +1682,184 @@ void Mio_LibraryMatchesStop( Mio_Library_t * pLib )
     Vec_MemFree( pLib->vTtMem );
     ABC_FREE( pLib->pCells );
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Saves and loads the match tables.]
+
+  Description [The match tables depend only on the library cells and 
+  the pin-matching flags. If the ABC variable "libcache" is set to 
+  a directory ("set libcache <dir>"), the tables are saved there after 
+  they are derived, in file "nf_<key>.bin", where the key is the hash of
+  the cells and the flags. Later runs with the same library map this file
+  instead of deriving the tables again. The file contains the magic 
+  number, the key, the number of truth tables and the number of match 
+  entries (three 64-bit words), followed by the truth tables, the sizes 
+  of the match arrays, and the match arrays, padded to a 64-bit word.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define MIO_MATCH_MAGIC  ABC_CONST(0x31544D464E434241)   // "ABCNFMT1"
+
+static inline word Mio_LibraryMatchesHashAdd( word Key, word Data )
+{
+    Key ^= Data;
+    Key *= ABC_CONST(0x100000001B3);
+    return Key ^ (Key >> 29);
+}
+static word Mio_LibraryMatchesKey( Mio_Cell2_t * pCells, int nCells, int fPinFilter, int fPinPerm, int fPinQuick )
+{
+    word Key = ABC_CONST(0xCBF29CE484222325);
+    int i, k; char * pName;
+    Key = Mio_LibraryMatchesHashAdd( Key, MIO_MATCH_MAGIC );
+    Key = Mio_LibraryMatchesHashAdd( Key, (word)(fPinFilter | (fPinPerm << 1) | (fPinQuick << 2)) );
+    Key = Mio_LibraryMatchesHashAdd( Key, (word)nCells );
+    for ( i = 0; i < nCells; i++ )
+    {
+        Key = Mio_LibraryMatchesHashAdd( Key, ((word)pCells[i].Id << 8) | pCells[i].nFanins );
+        Key = Mio_LibraryMatchesHashAdd( Key, pCells[i].uTruth );
+        Key = Mio_LibraryMatchesHashAdd( Key, (word)(unsigned)Abc_Float2Int(pCells[i].AreaF) );
+        for ( k = 0; k < (int)pCells[i].nFanins; k++ )
+            Key = Mio_LibraryMatchesHashAdd( Key, (word)(unsigned)pCells[i].iDelays[k] );
+        for ( pName = pCells[i].pName; pName && *pName; pName++ )
+            Key = Mio_LibraryMatchesHashAdd( Key, (word)(unsigned char)*pName );
+    }
+    return Key;
+}
+static char * Mio_LibraryMatchesFileName( char * pDirName, word Key )
+{
+    char * pFileName = ABC_ALLOC( char, strlen(pDirName) + 30 );
+    sprintf( pFileName, "%s/nf_%08x%08x.bin", pDirName, (unsigned)(Key >> 32), (unsigned)(Key & 0xFFFFFFFF) );
+    return pFileName;
+}
+static int Mio_LibraryMatchesParse( Mio_Library_t * pLib, word * pBuffer, int nWords, word Key )
+{
+    int i, nTruths, nInts, nTotal = 0, * pSizes, * pData;
+    if ( nWords < 3 || pBuffer[0] != MIO_MATCH_MAGIC || pBuffer[1] != Key )
+        return 0;
+    nTruths = (int)(pBuffer[2] >> 32);
+    nInts   = (int)(pBuffer[2] & 0x7FFFFFFF);
+    if ( nTruths < 2 || nWords != 3 + nTruths + (nTruths + nInts + 1) / 2 )
+        return 0;
+    pSizes = (int *)(pBuffer + 3 + nTruths);
+    pData  = pSizes + nTruths;
+    for ( i = 0; i < nTruths; i++ )
+    {
+        if ( pSizes[i] < 0 || pSizes[i] % 2 )
+            return 0;
+        nTotal += pSizes[i];
+    }
+    if ( nTotal != nInts )
+        return 0;
+    pLib->vTtMem    = Vec_MemAllocForTT( 6, 0 );
+    pLib->vTt2Match = Vec_WecStart( nTruths );
+    for ( i = 0; i < nTruths; i++ )
+    {
+        if ( Vec_MemHashInsert(pLib->vTtMem, pBuffer + 3 + i) != i )
+        {
+            Vec_WecFree( pLib->vTt2Match );
+            Vec_MemHashFree( pLib->vTtMem );
+            Vec_MemFree( pLib->vTtMem );
+            pLib->vTt2Match = NULL;
+            pLib->vTtMem = NULL;
+            return 0;
+        }
+        Vec_IntPushArray( Vec_WecEntry(pLib->vTt2Match, i), pData, pSizes[i] );
+        pData += pSizes[i];
+    }
+    return 1;
+}
+static int Mio_LibraryMatchesRead( Mio_Library_t * pLib, char * pFileName, word Key )
+{
+    int RetValue = 0;
+#ifdef MIO_MATCH_USE_MMAP
+    struct stat Stat;
+    word * pBuffer;
+    int File = open( pFileName, O_RDONLY );
+    if ( File == -1 )
+        return 0;
+    if ( fstat( File, &Stat ) == -1 || Stat.st_size == 0 || Stat.st_size % 8 || Stat.st_size / 8 > 0x7FFFFFFF )
+    {
+        close( File );
+        return 0;
+    }
+    pBuffer = (word *)mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, File, 0 );
+    close( File );
+    if ( pBuffer == (word *)MAP_FAILED )
+        return 0;
+    RetValue = Mio_LibraryMatchesParse( pLib, pBuffer, (int)(Stat.st_size / 8), Key );
+    munmap( pBuffer, (size_t)Stat.st_size );
+#else
+    word * pBuffer;
+    long nBytes;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    fseek( pFile, 0, SEEK_END );
+    nBytes = ftell( pFile );
+    rewind( pFile );
+    if ( nBytes > 0 && nBytes % 8 == 0 )
+    {
+        pBuffer = ABC_ALLOC( word, nBytes / 8 );
+        if ( fread( pBuffer, 1, (size_t)nBytes, pFile ) == (size_t)nBytes )
+            RetValue = Mio_LibraryMatchesParse( pLib, pBuffer, (int)(nBytes / 8), Key );
+        ABC_FREE( pBuffer );
+    }
+    fclose( pFile );
+#endif
+    return RetValue;
+}
+static void Mio_LibraryMatchesWrite( Mio_Library_t * pLib, char * pFileName, word Key )
+{
+    Vec_Int_t * vArray;
+    int i, Pad = 0, nTruths = Vec_WecSize(pLib->vTt2Match);
+    int nInts = Vec_WecSizeSize(pLib->vTt2Match), RetValue = 1;
+    word Header[3] = { MIO_MATCH_MAGIC, Key, ((word)nTruths << 32) | (word)nInts };
+    char * pFileTemp = ABC_ALLOC( char, strlen(pFileName) + 20 );
+    FILE * pFile;
+    assert( nTruths == Vec_MemEntryNum(pLib->vTtMem) );
+    // write into a temporary file and rename it, so that concurrent runs never see a partial file
+    sprintf( pFileTemp, "%s.%d", pFileName, (int)Mio_GetPid() );
+    pFile = fopen( pFileTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        ABC_FREE( pFileTemp );
+        return;
+    }
+    RetValue &= fwrite( Header, sizeof(word), 3, pFile ) == 3;
+    for ( i = 0; i < nTruths; i++ )
+        RetValue &= fwrite( Vec_MemReadEntry(pLib->vTtMem, i), sizeof(word), 1, pFile ) == 1;
+    Vec_WecForEachLevel( pLib->vTt2Match, vArray, i )
+        RetValue &= fwrite( &vArray->nSize, sizeof(int), 1, pFile ) == 1;
+    Vec_WecForEachLevel( pLib->vTt2Match, vArray, i )
+        RetValue &= fwrite( Vec_IntArray(vArray), sizeof(int), (size_t)Vec_IntSize(vArray), pFile ) == (size_t)Vec_IntSize(vArray);
+    if ( (nTruths + nInts) % 2 )
+        RetValue &= fwrite( &Pad, sizeof(int), 1, pFile ) == 1;
+    RetValue &= fclose( pFile ) == 0;
+    if ( !RetValue || rename( pFileTemp, pFileName ) != 0 )
+        remove( pFileTemp );
+    ABC_FREE( pFileTemp );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the match tables of the library.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 void Mio_LibraryMatchesStart( Mio_Library_t * pLib, int fPinFilter, int fPinPerm, int fPinQuick )
 {
-    extern Mio_Cell2_t * Nf_StoDeriveMatches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, int * pnCells, int fPinFilter, int fPinPerm, int fPinQuick );
+    extern void Nf_StoDeriveMatches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, Mio_Cell2_t * pCells, int nCells, int fPinFilter, int fPinPerm, int fPinQuick );
+    char * pCacheDir = Abc_FrameReadFlag( "libcache" ), * pFileName = NULL;
+    word Key = 0;
     if ( pLib->vTtMem && pLib->fPinFilter == fPinFilter && pLib->fPinPerm == fPinPerm && pLib->fPinQuick == fPinQuick )
         return;
     if ( pLib->vTtMem )
@@ -1676,12 +1867,26 @@ void Mio_LibraryMatchesStart( Mio_Library_t * pLib, int fPinFilter, int fPinPerm
     pLib->fPinFilter = fPinFilter;  // pin filtering
     pLib->fPinPerm   = fPinPerm;    // pin permutation
     pLib->fPinQuick  = fPinQuick;   // pin permutation
+    pLib->pCells     = Mio_CollectRootsNewDefault2( 6, &pLib->nCells, 0 );
+    if ( pCacheDir && *pCacheDir )
+    {
+        Key = Mio_LibraryMatchesKey( pLib->pCells, pLib->nCells, fPinFilter, fPinPerm, fPinQuick );
+        pFileName = Mio_LibraryMatchesFileName( pCacheDir, Key );
+        if ( Mio_LibraryMatchesRead( pLib, pFileName, Key ) )
+        {
+            ABC_FREE( pFileName );
+            return;
+        }
+    }
     pLib->vTtMem     = Vec_MemAllocForTT( 6, 0 );          
     pLib->vTt2Match  = Vec_WecAlloc( 1000 ); 
     Vec_WecPushLevel( pLib->vTt2Match );
     Vec_WecPushLevel( pLib->vTt2Match );
     assert( Vec_WecSize(pLib->vTt2Match) == Vec_MemEntryNum(pLib->vTtMem) );
-    pLib->pCells = Nf_StoDeriveMatches( pLib->vTtMem, pLib->vTt2Match, &pLib->nCells, fPinFilter, fPinPerm, fPinQuick );
+    Nf_StoDeriveMatches( pLib->vTtMem, pLib->vTt2Match, pLib->pCells, pLib->nCells, fPinFilter, fPinPerm, fPinQuick );
+    if ( pFileName )
+        Mio_LibraryMatchesWrite( pLib, pFileName, Key );
+    ABC_FREE( pFileName );
 }
 void Mio_LibraryMatchesFetch( Mio_Library_t * pLib, Vec_Mem_t ** pvTtMem, Vec_Wec_t ** pvTt2Match, Mio_Cell2_t ** ppCells, int * pnCells, int fPinFilter, int fPinPerm, int fPinQuick )
 {
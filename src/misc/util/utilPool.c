@@ -0,0 +1,568 @@
+/**CFile****************************************************************
+
+  FileName    [utilPool.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Shared thread pool.]
+
+  Synopsis    [Work-stealing thread pool used by parallel engines.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilPool.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+#include "utilPool.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Util_PoolTask_t_ Util_PoolTask_t;
+struct Util_PoolTask_t_
+{
+    Util_PoolFunc_t  pFunc;       // the task procedure
+    void *           pArg;        // the task argument
+    Util_Job_t *     pJob;        // the job of this task
+};
+
+// circular array of tasks; the owner works at the tail, thieves at the head
+typedef struct Util_PoolDeque_t_ Util_PoolDeque_t;
+struct Util_PoolDeque_t_
+{
+    Util_PoolTask_t * pTasks;     // tasks
+    int              nCap;        // the number of allocated entries
+    int              nSize;       // the number of tasks
+    int              iHead;       // the oldest task
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;
+#endif
+};
+
+typedef struct Util_PoolWorker_t_ Util_PoolWorker_t;
+struct Util_PoolWorker_t_
+{
+    Util_Pool_t *    pPool;       // the pool
+    int              iThread;     // the worker number
+#ifdef ABC_USE_PTHREADS
+    pthread_t        Thread;
+#endif
+};
+
+struct Util_Pool_t_
+{
+    int              nThreads;    // the number of workers
+    Util_PoolWorker_t * pWorkers; // workers
+    Util_PoolDeque_t * pDeques;   // task deques (one for each worker)
+    int              nQueued;     // the number of tasks in the deques
+    int              iNext;       // the deque for the next external task
+    int              fStop;       // the workers should quit
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;       // protects the counters and the jobs
+    pthread_cond_t   Cond;        // signals submitted tasks to idle workers
+#endif
+};
+
+struct Util_Job_t_
+{
+    Util_Pool_t *    pPool;       // the pool
+    int              nPending;    // submitted tasks not yet returned to the user
+    void **          pDone;       // finished tasks (circular array)
+    int              nDoneCap;    // the number of allocated entries
+    int              nDone;       // the number of finished tasks
+    int              iDoneHead;   // the oldest finished task
+    int              nWaiters;    // the number of threads sleeping in this job
+#ifdef ABC_USE_PTHREADS
+    pthread_cond_t   Cond;        // signals finished tasks of this job
+#endif
+};
+
+static Util_Pool_t * s_pPoolGlobal   = NULL;
+static int           s_nPoolThreads  = 0;
+
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_PoolMutex   = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t  s_PoolKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t   s_PoolKey;
+static void Util_PoolKeyCreate() { pthread_key_create( &s_PoolKey, NULL ); }
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of available processors.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_PoolCpuNum()
+{
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    SYSTEM_INFO Info;
+    GetSystemInfo( &Info );
+    return Abc_MaxInt( 1, (int)Info.dwNumberOfProcessors );
+#else
+    return Abc_MaxInt( 1, (int)sysconf(_SC_NPROCESSORS_ONLN) );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Global thread pool.]
+
+  Description [The number of threads is the number of processors,
+  unless it is set by the user. Changing the number of threads stops
+  the current global pool; a new one is started when it is needed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_PoolSetThreadNum( int nThreads )
+{
+    if ( nThreads == s_nPoolThreads )
+        return;
+    Util_PoolStopGlobal();
+    s_nPoolThreads = Abc_MaxInt( 0, nThreads );
+}
+int Util_PoolThreadNum()
+{
+    return s_nPoolThreads > 0 ? s_nPoolThreads : Util_PoolCpuNum();
+}
+Util_Pool_t * Util_PoolGlobal()
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &s_PoolMutex );
+#endif
+    if ( s_pPoolGlobal == NULL )
+        s_pPoolGlobal = Util_PoolStart( Util_PoolThreadNum() );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &s_PoolMutex );
+#endif
+    return s_pPoolGlobal;
+}
+void Util_PoolStopGlobal()
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &s_PoolMutex );
+#endif
+    if ( s_pPoolGlobal )
+        Util_PoolStop( s_pPoolGlobal );
+    s_pPoolGlobal = NULL;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &s_PoolMutex );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deque operations.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Util_PoolDequePush( Util_PoolDeque_t * q, Util_PoolTask_t * pTask )
+{
+    if ( q->nSize == q->nCap )
+    {
+        int i, nCapNew = Abc_MaxInt( 16, 2 * q->nCap );
+        Util_PoolTask_t * pTasks = ABC_ALLOC( Util_PoolTask_t, nCapNew );
+        for ( i = 0; i < q->nSize; i++ )
+            pTasks[i] = q->pTasks[(q->iHead + i) % q->nCap];
+        ABC_FREE( q->pTasks );
+        q->pTasks = pTasks;
+        q->nCap   = nCapNew;
+        q->iHead  = 0;
+    }
+    q->pTasks[(q->iHead + q->nSize++) % q->nCap] = *pTask;
+}
+static int Util_PoolDequePopTail( Util_PoolDeque_t * q, Util_PoolTask_t * pTask )
+{
+    if ( q->nSize == 0 )
+        return 0;
+    *pTask = q->pTasks[(q->iHead + --q->nSize) % q->nCap];
+    return 1;
+}
+static int Util_PoolDequePopHead( Util_PoolDeque_t * q, Util_PoolTask_t * pTask )
+{
+    if ( q->nSize == 0 )
+        return 0;
+    *pTask = q->pTasks[q->iHead];
+    q->iHead = (q->iHead + 1) % q->nCap;
+    q->nSize--;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Takes a task from the own deque or steals one.]
+
+  Description [Returns 0 if there are no tasks.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+static int Util_PoolGetTask( Util_Pool_t * p, int iThread, Util_PoolTask_t * pTask )
+{
+    Util_PoolDeque_t * q;
+    int i, fFound = 0;
+    if ( iThread >= 0 )
+    {
+        q = p->pDeques + iThread;
+        pthread_mutex_lock( &q->Mutex );
+        fFound = Util_PoolDequePopTail( q, pTask );
+        pthread_mutex_unlock( &q->Mutex );
+    }
+    for ( i = 1; !fFound && i <= p->nThreads; i++ )
+    {
+        q = p->pDeques + (Abc_MaxInt(iThread, 0) + i) % p->nThreads;
+        pthread_mutex_lock( &q->Mutex );
+        fFound = Util_PoolDequePopHead( q, pTask );
+        pthread_mutex_unlock( &q->Mutex );
+    }
+    if ( !fFound )
+        return 0;
+    pthread_mutex_lock( &p->Mutex );
+    p->nQueued--;
+    pthread_mutex_unlock( &p->Mutex );
+    return 1;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the task and reports it to the job.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Util_PoolRunTask( Util_Pool_t * p, Util_PoolTask_t * pTask )
+{
+    Util_Job_t * pJob = pTask->pJob;
+    pTask->pFunc( pTask->pArg );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    if ( pJob->nDone == pJob->nDoneCap )
+    {
+        int i, nCapNew = Abc_MaxInt( 16, 2 * pJob->nDoneCap );
+        void ** pDone = ABC_ALLOC( void *, nCapNew );
+        for ( i = 0; i < pJob->nDone; i++ )
+            pDone[i] = pJob->pDone[(pJob->iDoneHead + i) % pJob->nDoneCap];
+        ABC_FREE( pJob->pDone );
+        pJob->pDone     = pDone;
+        pJob->nDoneCap  = nCapNew;
+        pJob->iDoneHead = 0;
+    }
+    pJob->pDone[(pJob->iDoneHead + pJob->nDone++) % pJob->nDoneCap] = pTask->pArg;
+#ifdef ABC_USE_PTHREADS
+    if ( pJob->nWaiters > 0 )
+        pthread_cond_signal( &pJob->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+static void * Util_PoolWorkerThread( void * pArg )
+{
+    Util_PoolWorker_t * pWorker = (Util_PoolWorker_t *)pArg;
+    Util_Pool_t * p = pWorker->pPool;
+    Util_PoolTask_t Task;
+    int fStop;
+    pthread_setspecific( s_PoolKey, pWorker );
+    while ( 1 )
+    {
+        if ( Util_PoolGetTask( p, pWorker->iThread, &Task ) )
+        {
+            Util_PoolRunTask( p, &Task );
+            continue;
+        }
+        // sleep until there is something to do
+        pthread_mutex_lock( &p->Mutex );
+        while ( p->nQueued <= 0 && !p->fStop )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        fStop = p->fStop && p->nQueued <= 0;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( fStop )
+            break;
+    }
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the pool.]
+
+  Description [Without pthreads, tasks are executed when submitted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Util_Pool_t * Util_PoolStart( int nThreads )
+{
+    Util_Pool_t * p = ABC_CALLOC( Util_Pool_t, 1 );
+#ifdef ABC_USE_PTHREADS
+    int i, status;
+    assert( nThreads > 0 );
+    pthread_once( &s_PoolKeyOnce, Util_PoolKeyCreate );
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->Cond, NULL );
+    p->nThreads = nThreads;
+    p->pDeques  = ABC_CALLOC( Util_PoolDeque_t, nThreads );
+    p->pWorkers = ABC_CALLOC( Util_PoolWorker_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+        pthread_mutex_init( &p->pDeques[i].Mutex, NULL );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        p->pWorkers[i].pPool   = p;
+        p->pWorkers[i].iThread = i;
+        status = pthread_create( &p->pWorkers[i].Thread, NULL, Util_PoolWorkerThread, (void *)(p->pWorkers + i) );  assert( status == 0 );
+    }
+#endif
+    return p;
+}
+void Util_PoolStop( Util_Pool_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int i;
+    pthread_mutex_lock( &p->Mutex );
+    p->fStop = 1;
+    pthread_cond_broadcast( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+    for ( i = 0; i < p->nThreads; i++ )
+        pthread_join( p->pWorkers[i].Thread, NULL );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        assert( p->pDeques[i].nSize == 0 );
+        pthread_mutex_destroy( &p->pDeques[i].Mutex );
+        ABC_FREE( p->pDeques[i].pTasks );
+    }
+    pthread_cond_destroy( &p->Cond );
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    ABC_FREE( p->pDeques );
+    ABC_FREE( p->pWorkers );
+    ABC_FREE( p );
+}
+int Util_PoolSize( Util_Pool_t * p )
+{
+    return Abc_MaxInt( 1, p->nThreads );
+}
+// returns the number of the calling worker, or -1 if it is not a worker of this pool
+int Util_PoolWorkerId( Util_Pool_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    Util_PoolWorker_t * pWorker;
+    pthread_once( &s_PoolKeyOnce, Util_PoolKeyCreate );
+    pWorker = (Util_PoolWorker_t *)pthread_getspecific( s_PoolKey );
+    if ( pWorker && pWorker->pPool == p )
+        return pWorker->iThread;
+#endif
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the job.]
+
+  Description [Stopping the job waits for all of its tasks.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Util_Job_t * Util_JobStart( Util_Pool_t * p )
+{
+    Util_Job_t * pJob = ABC_CALLOC( Util_Job_t, 1 );
+    pJob->pPool = p;
+#ifdef ABC_USE_PTHREADS
+    pthread_cond_init( &pJob->Cond, NULL );
+#endif
+    return pJob;
+}
+void Util_JobStop( Util_Job_t * pJob )
+{
+    Util_JobWaitAll( pJob );
+#ifdef ABC_USE_PTHREADS
+    pthread_cond_destroy( &pJob->Cond );
+#endif
+    ABC_FREE( pJob->pDone );
+    ABC_FREE( pJob );
+}
+int Util_JobPending( Util_Job_t * pJob )
+{
+    return pJob->nPending;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Submits a task.]
+
+  Description [A task submitted from a worker goes to its own deque.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_JobSubmit( Util_Job_t * pJob, Util_PoolFunc_t pFunc, void * pArg )
+{
+    Util_Pool_t * p = pJob->pPool;
+    Util_PoolTask_t Task;
+    Task.pFunc = pFunc;
+    Task.pArg  = pArg;
+    Task.pJob  = pJob;
+#ifdef ABC_USE_PTHREADS
+    {
+        int iThread = Util_PoolWorkerId( p );
+        Util_PoolDeque_t * q;
+        pthread_mutex_lock( &p->Mutex );
+        pJob->nPending++;
+        if ( iThread == -1 )
+            iThread = p->iNext++ % p->nThreads;
+        pthread_mutex_unlock( &p->Mutex );
+        q = p->pDeques + iThread;
+        pthread_mutex_lock( &q->Mutex );
+        Util_PoolDequePush( q, &Task );
+        pthread_mutex_unlock( &q->Mutex );
+        pthread_mutex_lock( &p->Mutex );
+        p->nQueued++;
+        pthread_cond_signal( &p->Cond );
+        // a worker waiting for this job may execute the task
+        if ( pJob->nWaiters > 0 )
+            pthread_cond_signal( &pJob->Cond );
+        pthread_mutex_unlock( &p->Mutex );
+    }
+#else
+    pJob->nPending++;
+    Util_PoolRunTask( p, &Task );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Waits for the next finished task of the job.]
+
+  Description [Returns the argument of the finished task, or NULL if
+  the job has no pending tasks. Finished tasks are returned in the order
+  of completion. When called by a worker (for nested parallelism), the
+  worker executes other tasks while waiting; otherwise, the calling thread
+  sleeps until a task is finished. A finished task wakes up only the
+  threads waiting for its job.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Util_JobWaitNext( Util_Job_t * pJob )
+{
+    void * pArg;
+#ifdef ABC_USE_PTHREADS
+    Util_Pool_t * p = pJob->pPool;
+    Util_PoolTask_t Task;
+    int iThread = Util_PoolWorkerId( p );
+    pthread_mutex_lock( &p->Mutex );
+    while ( pJob->nDone == 0 && pJob->nPending > 0 )
+    {
+        if ( iThread >= 0 && p->nQueued > 0 )
+        {
+            pthread_mutex_unlock( &p->Mutex );
+            if ( Util_PoolGetTask( p, iThread, &Task ) )
+                Util_PoolRunTask( p, &Task );
+            pthread_mutex_lock( &p->Mutex );
+            continue;
+        }
+        pJob->nWaiters++;
+        pthread_cond_wait( &pJob->Cond, &p->Mutex );
+        pJob->nWaiters--;
+    }
+#endif
+    if ( pJob->nDone == 0 )
+        pArg = NULL;
+    else
+    {
+        pArg = pJob->pDone[pJob->iDoneHead];
+        pJob->iDoneHead = (pJob->iDoneHead + 1) % pJob->nDoneCap;
+        pJob->nDone--;
+        pJob->nPending--;
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+    return pArg;
+}
+void Util_JobWaitAll( Util_Job_t * pJob )
+{
+    while ( pJob->nPending > 0 )
+        Util_JobWaitNext( pJob );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,81 @@
+/**CFile****************************************************************
+
+  FileName    [utilPool.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Shared thread pool.]
+
+  Synopsis    [Work-stealing thread pool used by parallel engines.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilPool.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilPool_h
+#define ABC__misc__util__utilPool_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "abc_global.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The pool owns a fixed number of worker threads, each with its own task
+// deque. Tasks submitted by a worker go to its own deque and are executed
+// in LIFO order, while idle workers steal the oldest tasks from others.
+// Tasks are grouped into jobs; the thread that submitted the tasks of a job
+// blocks (rather than spins) until they finish. Parallel engines share one
+// global pool, whose size is controlled by "set threads <num>". Engines
+// whose tasks race each other (and therefore must all run at the same time)
+// start a pool of their own with one worker for each racing task.
+
+typedef struct Util_Pool_t_  Util_Pool_t;    // thread pool
+typedef struct Util_Job_t_   Util_Job_t;     // group of tasks
+typedef void (*Util_PoolFunc_t)( void * pArg );
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilPool.c ==========================================================*/
+
+extern int           Util_PoolCpuNum();
+extern void          Util_PoolSetThreadNum( int nThreads );
+extern int           Util_PoolThreadNum();
+extern Util_Pool_t * Util_PoolGlobal();
+extern void          Util_PoolStopGlobal();
+extern Util_Pool_t * Util_PoolStart( int nThreads );
+extern void          Util_PoolStop( Util_Pool_t * p );
+extern int           Util_PoolSize( Util_Pool_t * p );
+extern int           Util_PoolWorkerId( Util_Pool_t * p );
+extern Util_Job_t *  Util_JobStart( Util_Pool_t * p );
+extern void          Util_JobStop( Util_Job_t * pJob );
+extern void          Util_JobSubmit( Util_Job_t * pJob, Util_PoolFunc_t pFunc, void * pArg );
+extern void *        Util_JobWaitNext( Util_Job_t * pJob );
+extern void          Util_JobWaitAll( Util_Job_t * pJob );
+extern int           Util_JobPending( Util_Job_t * pJob );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,484 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Vectorized kernels for bit-parallel simulation.]
+
+  Synopsis    [AND/XOR/MUX/copy, comparison and hashing of simulation info.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilSimd.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utilSimd.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ABC_SIMD_X86
+#include <immintrin.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the primes used to hash simulation info; the first 16 entries are
+// repeated at the end, so that a vector of primes can be loaded at any offset
+unsigned Abc_SimdPrimes[128 + 16] = {
+    1009, 1049, 1093, 1151, 1201, 1249, 1297, 1361, 1427, 1459,
+    1499, 1559, 1607, 1657, 1709, 1759, 1823, 1877, 1933, 1997,
+    2039, 2089, 2141, 2213, 2269, 2311, 2371, 2411, 2467, 2543,
+    2609, 2663, 2699, 2741, 2797, 2851, 2909, 2969, 3037, 3089,
+    3169, 3221, 3299, 3331, 3389, 3461, 3517, 3557, 3613, 3671,
+    3719, 3779, 3847, 3907, 3943, 4013, 4073, 4129, 4201, 4243,
+    4289, 4363, 4441, 4493, 4549, 4621, 4663, 4729, 4793, 4871,
+    4933, 4973, 5021, 5087, 5153, 5227, 5281, 5351, 5417, 5471,
+    5519, 5573, 5651, 5693, 5749, 5821, 5861, 5923, 6011, 6073,
+    6131, 6199, 6257, 6301, 6353, 6397, 6481, 6563, 6619, 6689,
+    6737, 6803, 6863, 6917, 6977, 7027, 7109, 7187, 7237, 7309,
+    7393, 7477, 7523, 7561, 7607, 7681, 7727, 7817, 7877, 7933,
+    8011, 8039, 8059, 8081, 8093, 8111, 8123, 8147,
+    1009, 1049, 1093, 1151, 1201, 1249, 1297, 1361, 1427, 1459,
+    1499, 1559, 1607, 1657, 1709, 1759
+};
+
+static Abc_SimdFuncs_t * s_pSimdFuncs = NULL;
+
+// the kernels are selected by the first thread calling Abc_SimdFuncs()
+#if defined(__GNUC__)
+static inline Abc_SimdFuncs_t * Abc_SimdFuncsLoad()                        { return __atomic_load_n( &s_pSimdFuncs, __ATOMIC_ACQUIRE );  }
+static inline void              Abc_SimdFuncsStore( Abc_SimdFuncs_t * p ) { __atomic_store_n( &s_pSimdFuncs, p, __ATOMIC_RELEASE );     }
+static inline int               Abc_SimdArchLoad( int * p )               { return __atomic_load_n( p, __ATOMIC_ACQUIRE );              }
+static inline void              Abc_SimdArchStore( int * p, int Arch )    { __atomic_store_n( p, Arch, __ATOMIC_RELEASE );               }
+#else
+static inline Abc_SimdFuncs_t * Abc_SimdFuncsLoad()                        { return s_pSimdFuncs;                                        }
+static inline void              Abc_SimdFuncsStore( Abc_SimdFuncs_t * p ) { s_pSimdFuncs = p;                                           }
+static inline int               Abc_SimdArchLoad( int * p )               { return *p;                                                  }
+static inline void              Abc_SimdArchStore( int * p, int Arch )    { *p = Arch;                                                  }
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Scalar kernels.]
+
+  Description [Used when the CPU does not support vector extensions.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SimdAndScalar( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pIn0, Abc_SimdUnit_t * pIn1, int fCompl0, int fCompl1, int fComplOut, int nUnits )
+{
+    unsigned m0 = fCompl0 ? ~0 : 0, m1 = fCompl1 ? ~0 : 0, m = fComplOut ? ~0 : 0;
+    int w;
+    for ( w = 0; w < nUnits; w++ )
+        pOut[w] = ((pIn0[w] ^ m0) & (pIn1[w] ^ m1)) ^ m;
+}
+static void Abc_SimdXorScalar( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pIn0, Abc_SimdUnit_t * pIn1, int fComplOut, int nUnits )
+{
+    unsigned m = fComplOut ? ~0 : 0;
+    int w;
+    for ( w = 0; w < nUnits; w++ )
+        pOut[w] = pIn0[w] ^ pIn1[w] ^ m;
+}
+static void Abc_SimdMuxScalar( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pCtrl, Abc_SimdUnit_t * pIn1, Abc_SimdUnit_t * pIn0, int nUnits )
+{
+    int w;
+    for ( w = 0; w < nUnits; w++ )
+        pOut[w] = (pCtrl[w] & pIn1[w]) | (~pCtrl[w] & pIn0[w]);
+}
+static void Abc_SimdCopyScalar( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pIn, int fCompl, int nUnits )
+{
+    unsigned m = fCompl ? ~0 : 0;
+    int w;
+    for ( w = 0; w < nUnits; w++ )
+        pOut[w] = pIn[w] ^ m;
+}
+static int Abc_SimdEqualScalar( Abc_SimdUnit_t * pIn0, Abc_SimdUnit_t * pIn1, int fCompl, int nUnits )
+{
+    unsigned m = fCompl ? ~0 : 0;
+    int w;
+    for ( w = 0; w < nUnits; w++ )
+        if ( pIn0[w] ^ pIn1[w] ^ m )
+            return 0;
+    return 1;
+}
+static int Abc_SimdIsConstScalar( Abc_SimdUnit_t * pIn, int fConst1, int nUnits )
+{
+    unsigned m = fConst1 ? ~0 : 0;
+    int w;
+    for ( w = 0; w < nUnits; w++ )
+        if ( pIn[w] ^ m )
+            return 0;
+    return 1;
+}
+static unsigned Abc_SimdHashScalar( Abc_SimdUnit_t * pIn, int iStart, int nUnits )
+{
+    unsigned uHash = 0;
+    int w;
+    for ( w = 0; w < nUnits; w++ )
+        uHash ^= pIn[w] * Abc_SimdPrimes[(iStart + w) & 0x7F];
+    return uHash;
+}
+
+#ifdef ABC_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 kernels.]
+
+  Description [Process 8 units at a time; the tail is done by the scalar code.
+  Compiled for AVX2 regardless of the build flags and only called after
+  the CPU was checked to support it.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx2")))
+static void Abc_SimdAndAvx2( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pIn0, Abc_SimdUnit_t * pIn1, int fCompl0, int fCompl1, int fComplOut, int nUnits )
+{
+    __m256i m0 = _mm256_set1_epi32( fCompl0 ? -1 : 0 );
+    __m256i m1 = _mm256_set1_epi32( fCompl1 ? -1 : 0 );
+    __m256i m  = _mm256_set1_epi32( fComplOut ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 8 <= nUnits; w += 8 )
+    {
+        __m256i a = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn0 + w)), m0 );
+        __m256i b = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn1 + w)), m1 );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_and_si256(a, b), m) );
+    }
+    Abc_SimdAndScalar( pOut + w, pIn0 + w, pIn1 + w, fCompl0, fCompl1, fComplOut, nUnits - w );
+}
+__attribute__((target("avx2")))
+static void Abc_SimdXorAvx2( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pIn0, Abc_SimdUnit_t * pIn1, int fComplOut, int nUnits )
+{
+    __m256i m = _mm256_set1_epi32( fComplOut ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 8 <= nUnits; w += 8 )
+    {
+        __m256i a = _mm256_loadu_si256( (__m256i *)(pIn0 + w) );
+        __m256i b = _mm256_loadu_si256( (__m256i *)(pIn1 + w) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_xor_si256(a, b), m) );
+    }
+    Abc_SimdXorScalar( pOut + w, pIn0 + w, pIn1 + w, fComplOut, nUnits - w );
+}
+__attribute__((target("avx2")))
+static void Abc_SimdMuxAvx2( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pCtrl, Abc_SimdUnit_t * pIn1, Abc_SimdUnit_t * pIn0, int nUnits )
+{
+    int w;
+    for ( w = 0; w + 8 <= nUnits; w += 8 )
+    {
+        __m256i c = _mm256_loadu_si256( (__m256i *)(pCtrl + w) );
+        __m256i a = _mm256_loadu_si256( (__m256i *)(pIn1 + w) );
+        __m256i b = _mm256_loadu_si256( (__m256i *)(pIn0 + w) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_or_si256(_mm256_and_si256(c, a), _mm256_andnot_si256(c, b)) );
+    }
+    Abc_SimdMuxScalar( pOut + w, pCtrl + w, pIn1 + w, pIn0 + w, nUnits - w );
+}
+__attribute__((target("avx2")))
+static void Abc_SimdCopyAvx2( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pIn, int fCompl, int nUnits )
+{
+    __m256i m = _mm256_set1_epi32( fCompl ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 8 <= nUnits; w += 8 )
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(pIn + w)), m) );
+    Abc_SimdCopyScalar( pOut + w, pIn + w, fCompl, nUnits - w );
+}
+__attribute__((target("avx2")))
+static int Abc_SimdEqualAvx2( Abc_SimdUnit_t * pIn0, Abc_SimdUnit_t * pIn1, int fCompl, int nUnits )
+{
+    __m256i m = _mm256_set1_epi32( fCompl ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 8 <= nUnits; w += 8 )
+    {
+        __m256i a = _mm256_loadu_si256( (__m256i *)(pIn0 + w) );
+        __m256i b = _mm256_loadu_si256( (__m256i *)(pIn1 + w) );
+        __m256i d = _mm256_xor_si256( _mm256_xor_si256(a, b), m );
+        if ( !_mm256_testz_si256(d, d) )
+            return 0;
+    }
+    return Abc_SimdEqualScalar( pIn0 + w, pIn1 + w, fCompl, nUnits - w );
+}
+__attribute__((target("avx2")))
+static int Abc_SimdIsConstAvx2( Abc_SimdUnit_t * pIn, int fConst1, int nUnits )
+{
+    __m256i m = _mm256_set1_epi32( fConst1 ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 8 <= nUnits; w += 8 )
+    {
+        __m256i d = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn + w)), m );
+        if ( !_mm256_testz_si256(d, d) )
+            return 0;
+    }
+    return Abc_SimdIsConstScalar( pIn + w, fConst1, nUnits - w );
+}
+__attribute__((target("avx2")))
+static unsigned Abc_SimdHashAvx2( Abc_SimdUnit_t * pIn, int iStart, int nUnits )
+{
+    __m256i h = _mm256_setzero_si256();
+    unsigned Res[8], uHash;
+    int w, i;
+    for ( w = 0; w + 8 <= nUnits; w += 8 )
+    {
+        __m256i a = _mm256_loadu_si256( (__m256i *)(pIn + w) );
+        __m256i p = _mm256_loadu_si256( (__m256i *)(Abc_SimdPrimes + ((iStart + w) & 0x7F)) );
+        h = _mm256_xor_si256( h, _mm256_mullo_epi32(a, p) );
+    }
+    _mm256_storeu_si256( (__m256i *)Res, h );
+    uHash = Abc_SimdHashScalar( pIn + w, iStart + w, nUnits - w );
+    for ( i = 0; i < 8; i++ )
+        uHash ^= Res[i];
+    return uHash;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX-512 kernels.]
+
+  Description [Process 16 units at a time; the tail is done by the scalar code.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx512f")))
+static void Abc_SimdAndAvx512( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pIn0, Abc_SimdUnit_t * pIn1, int fCompl0, int fCompl1, int fComplOut, int nUnits )
+{
+    __m512i m0 = _mm512_set1_epi32( fCompl0 ? -1 : 0 );
+    __m512i m1 = _mm512_set1_epi32( fCompl1 ? -1 : 0 );
+    __m512i m  = _mm512_set1_epi32( fComplOut ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 16 <= nUnits; w += 16 )
+    {
+        __m512i a = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn0 + w)), m0 );
+        __m512i b = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn1 + w)), m1 );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512(_mm512_and_si512(a, b), m) );
+    }
+    Abc_SimdAndScalar( pOut + w, pIn0 + w, pIn1 + w, fCompl0, fCompl1, fComplOut, nUnits - w );
+}
+__attribute__((target("avx512f")))
+static void Abc_SimdXorAvx512( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pIn0, Abc_SimdUnit_t * pIn1, int fComplOut, int nUnits )
+{
+    __m512i m = _mm512_set1_epi32( fComplOut ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 16 <= nUnits; w += 16 )
+    {
+        __m512i a = _mm512_loadu_si512( (void *)(pIn0 + w) );
+        __m512i b = _mm512_loadu_si512( (void *)(pIn1 + w) );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512(_mm512_xor_si512(a, b), m) );
+    }
+    Abc_SimdXorScalar( pOut + w, pIn0 + w, pIn1 + w, fComplOut, nUnits - w );
+}
+__attribute__((target("avx512f")))
+static void Abc_SimdMuxAvx512( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pCtrl, Abc_SimdUnit_t * pIn1, Abc_SimdUnit_t * pIn0, int nUnits )
+{
+    int w;
+    for ( w = 0; w + 16 <= nUnits; w += 16 )
+    {
+        __m512i c = _mm512_loadu_si512( (void *)(pCtrl + w) );
+        __m512i a = _mm512_loadu_si512( (void *)(pIn1 + w) );
+        __m512i b = _mm512_loadu_si512( (void *)(pIn0 + w) );
+        // 0xCA is the truth table of (c & a) | (~c & b)
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_ternarylogic_epi32(c, a, b, 0xCA) );
+    }
+    Abc_SimdMuxScalar( pOut + w, pCtrl + w, pIn1 + w, pIn0 + w, nUnits - w );
+}
+__attribute__((target("avx512f")))
+static void Abc_SimdCopyAvx512( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pIn, int fCompl, int nUnits )
+{
+    __m512i m = _mm512_set1_epi32( fCompl ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 16 <= nUnits; w += 16 )
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512(_mm512_loadu_si512((void *)(pIn + w)), m) );
+    Abc_SimdCopyScalar( pOut + w, pIn + w, fCompl, nUnits - w );
+}
+__attribute__((target("avx512f")))
+static int Abc_SimdEqualAvx512( Abc_SimdUnit_t * pIn0, Abc_SimdUnit_t * pIn1, int fCompl, int nUnits )
+{
+    __m512i m = _mm512_set1_epi32( fCompl ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 16 <= nUnits; w += 16 )
+    {
+        __m512i a = _mm512_loadu_si512( (void *)(pIn0 + w) );
+        __m512i b = _mm512_loadu_si512( (void *)(pIn1 + w) );
+        __m512i d = _mm512_xor_si512( _mm512_xor_si512(a, b), m );
+        if ( _mm512_test_epi32_mask(d, d) )
+            return 0;
+    }
+    return Abc_SimdEqualScalar( pIn0 + w, pIn1 + w, fCompl, nUnits - w );
+}
+__attribute__((target("avx512f")))
+static int Abc_SimdIsConstAvx512( Abc_SimdUnit_t * pIn, int fConst1, int nUnits )
+{
+    __m512i m = _mm512_set1_epi32( fConst1 ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 16 <= nUnits; w += 16 )
+    {
+        __m512i d = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn + w)), m );
+        if ( _mm512_test_epi32_mask(d, d) )
+            return 0;
+    }
+    return Abc_SimdIsConstScalar( pIn + w, fConst1, nUnits - w );
+}
+__attribute__((target("avx512f")))
+static unsigned Abc_SimdHashAvx512( Abc_SimdUnit_t * pIn, int iStart, int nUnits )
+{
+    __m512i h = _mm512_setzero_si512();
+    unsigned Res[16], uHash;
+    int w, i;
+    for ( w = 0; w + 16 <= nUnits; w += 16 )
+    {
+        __m512i a = _mm512_loadu_si512( (void *)(pIn + w) );
+        __m512i p = _mm512_loadu_si512( (void *)(Abc_SimdPrimes + ((iStart + w) & 0x7F)) );
+        h = _mm512_xor_si512( h, _mm512_mullo_epi32(a, p) );
+    }
+    _mm512_storeu_si512( (void *)Res, h );
+    uHash = Abc_SimdHashScalar( pIn + w, iStart + w, nUnits - w );
+    for ( i = 0; i < 16; i++ )
+        uHash ^= Res[i];
+    return uHash;
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Tables of kernels.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_SimdFuncs_t s_SimdScalar = {
+    ABC_SIMD_SCALAR, "scalar",
+    Abc_SimdAndScalar, Abc_SimdXorScalar, Abc_SimdMuxScalar, Abc_SimdCopyScalar,
+    Abc_SimdEqualScalar, Abc_SimdIsConstScalar, Abc_SimdHashScalar
+};
+#ifdef ABC_SIMD_X86
+static Abc_SimdFuncs_t s_SimdAvx2 = {
+    ABC_SIMD_AVX2, "AVX2",
+    Abc_SimdAndAvx2, Abc_SimdXorAvx2, Abc_SimdMuxAvx2, Abc_SimdCopyAvx2,
+    Abc_SimdEqualAvx2, Abc_SimdIsConstAvx2, Abc_SimdHashAvx2
+};
+static Abc_SimdFuncs_t s_SimdAvx512 = {
+    ABC_SIMD_AVX512, "AVX-512",
+    Abc_SimdAndAvx512, Abc_SimdXorAvx512, Abc_SimdMuxAvx512, Abc_SimdCopyAvx512,
+    Abc_SimdEqualAvx512, Abc_SimdIsConstAvx512, Abc_SimdHashAvx512
+};
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the best instruction set supported by the CPU.]
+
+  Description [Setting ABC_SIMD=scalar (or avx2) in the environment
+  limits the choice, which is useful when comparing the kernels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SimdArchBest()
+{
+    static int s_Arch = -1;
+    int Arch = Abc_SimdArchLoad( &s_Arch );
+    if ( Arch == -1 )
+    {
+        char * pEnv = getenv( "ABC_SIMD" );
+        Arch = ABC_SIMD_SCALAR;
+#ifdef ABC_SIMD_X86
+        __builtin_cpu_init();
+        if ( __builtin_cpu_supports("avx512f") )
+            Arch = ABC_SIMD_AVX512;
+        else if ( __builtin_cpu_supports("avx2") )
+            Arch = ABC_SIMD_AVX2;
+#endif
+        if ( pEnv && !strcmp(pEnv, "scalar") )
+            Arch = ABC_SIMD_SCALAR;
+        else if ( pEnv && !strcmp(pEnv, "avx2") && Arch > ABC_SIMD_AVX2 )
+            Arch = ABC_SIMD_AVX2;
+        Abc_SimdArchStore( &s_Arch, Arch );
+    }
+    return Arch;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the kernels.]
+
+  Description [The requested instruction set is lowered to the best one
+  supported by the CPU. Returns the instruction set selected.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SimdSetArch( int Arch )
+{
+    Abc_SimdFuncs_t * pFuncs = &s_SimdScalar;
+    Arch = Abc_MinInt( Arch, Abc_SimdArchBest() );
+#ifdef ABC_SIMD_X86
+    if ( Arch == ABC_SIMD_AVX512 )
+        pFuncs = &s_SimdAvx512;
+    else if ( Arch == ABC_SIMD_AVX2 )
+        pFuncs = &s_SimdAvx2;
+#endif
+    Abc_SimdFuncsStore( pFuncs );
+    return pFuncs->Arch;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the kernels for the current CPU.]
+
+  Description [The first call detects the CPU features. The selected
+  table is published atomically, so concurrent first calls only repeat
+  the detection and store the same table.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_SimdFuncs_t * Abc_SimdFuncs()
+{
+    Abc_SimdFuncs_t * pFuncs = Abc_SimdFuncsLoad();
+    if ( pFuncs == NULL )
+    {
+        Abc_SimdSetArch( ABC_SIMD_AVX512 );
+        pFuncs = Abc_SimdFuncsLoad();
+    }
+    return pFuncs;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,187 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Vectorized kernels for bit-parallel simulation.]
+
+  Synopsis    [AND/XOR/MUX/copy, comparison and hashing of simulation info.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilSimd.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilSimd_h
+#define ABC__misc__util__utilSimd_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "abc_global.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// the simulation info of a node is an array of 32-bit units
+// (the 64-bit words used by some engines are passed as pairs of units);
+// shorter arrays are processed by the inline code below, longer ones by
+// the kernel selected at runtime (AVX-512, AVX2 or scalar)
+#define ABC_SIMD_UNITS_MIN   16
+
+// the instruction sets
+#define ABC_SIMD_SCALAR       0
+#define ABC_SIMD_AVX2         1
+#define ABC_SIMD_AVX512       2
+
+// the unit type may alias other types, so that engines storing simulation
+// info in 64-bit words can pass it to the kernels without breaking the
+// strict aliasing rules
+#if defined(__GNUC__) || defined(__clang__)
+typedef unsigned __attribute__((__may_alias__)) Abc_SimdUnit_t;
+#else
+typedef unsigned Abc_SimdUnit_t;
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Abc_SimdFuncs_t_ Abc_SimdFuncs_t;
+struct Abc_SimdFuncs_t_
+{
+    int        Arch;                  // the instruction set
+    char *     pName;                 // its name
+    void       (*pAnd)     ( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pIn0, Abc_SimdUnit_t * pIn1, int fCompl0, int fCompl1, int fComplOut, int nUnits );
+    void       (*pXor)     ( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pIn0, Abc_SimdUnit_t * pIn1, int fComplOut, int nUnits );
+    void       (*pMux)     ( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pCtrl, Abc_SimdUnit_t * pIn1, Abc_SimdUnit_t * pIn0, int nUnits );
+    void       (*pCopy)    ( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pIn, int fCompl, int nUnits );
+    int        (*pEqual)   ( Abc_SimdUnit_t * pIn0, Abc_SimdUnit_t * pIn1, int fCompl, int nUnits );
+    int        (*pIsConst) ( Abc_SimdUnit_t * pIn, int fConst1, int nUnits );
+    unsigned   (*pHash)    ( Abc_SimdUnit_t * pIn, int iStart, int nUnits );
+};
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilSimd.c ==========================================================*/
+
+extern Abc_SimdFuncs_t * Abc_SimdFuncs();
+extern int               Abc_SimdSetArch( int Arch );
+extern int               Abc_SimdArchBest();
+extern unsigned          Abc_SimdPrimes[128 + 16];
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+// pOut = (pIn0 ^ fCompl0) & (pIn1 ^ fCompl1) ^ fComplOut
+static inline void Abc_SimdAnd( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pIn0, Abc_SimdUnit_t * pIn1, int fCompl0, int fCompl1, int fComplOut, int nUnits )
+{
+    unsigned m0 = fCompl0 ? ~0 : 0, m1 = fCompl1 ? ~0 : 0, m = fComplOut ? ~0 : 0;
+    int w;
+    if ( nUnits > ABC_SIMD_UNITS_MIN )
+    {
+        Abc_SimdFuncs()->pAnd( pOut, pIn0, pIn1, fCompl0, fCompl1, fComplOut, nUnits );
+        return;
+    }
+    for ( w = 0; w < nUnits; w++ )
+        pOut[w] = ((pIn0[w] ^ m0) & (pIn1[w] ^ m1)) ^ m;
+}
+// pOut = pIn0 ^ pIn1 ^ fComplOut
+static inline void Abc_SimdXor( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pIn0, Abc_SimdUnit_t * pIn1, int fComplOut, int nUnits )
+{
+    unsigned m = fComplOut ? ~0 : 0;
+    int w;
+    if ( nUnits > ABC_SIMD_UNITS_MIN )
+    {
+        Abc_SimdFuncs()->pXor( pOut, pIn0, pIn1, fComplOut, nUnits );
+        return;
+    }
+    for ( w = 0; w < nUnits; w++ )
+        pOut[w] = pIn0[w] ^ pIn1[w] ^ m;
+}
+// pOut = pCtrl ? pIn1 : pIn0
+static inline void Abc_SimdMux( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pCtrl, Abc_SimdUnit_t * pIn1, Abc_SimdUnit_t * pIn0, int nUnits )
+{
+    int w;
+    if ( nUnits > ABC_SIMD_UNITS_MIN )
+    {
+        Abc_SimdFuncs()->pMux( pOut, pCtrl, pIn1, pIn0, nUnits );
+        return;
+    }
+    for ( w = 0; w < nUnits; w++ )
+        pOut[w] = (pCtrl[w] & pIn1[w]) | (~pCtrl[w] & pIn0[w]);
+}
+// pOut = pIn ^ fCompl (used for CIs, COs and register transfer)
+static inline void Abc_SimdCopy( Abc_SimdUnit_t * pOut, Abc_SimdUnit_t * pIn, int fCompl, int nUnits )
+{
+    unsigned m = fCompl ? ~0 : 0;
+    int w;
+    if ( nUnits > ABC_SIMD_UNITS_MIN )
+    {
+        Abc_SimdFuncs()->pCopy( pOut, pIn, fCompl, nUnits );
+        return;
+    }
+    for ( w = 0; w < nUnits; w++ )
+        pOut[w] = pIn[w] ^ m;
+}
+// returns 1 if pIn0 == pIn1 ^ fCompl
+static inline int Abc_SimdEqual( Abc_SimdUnit_t * pIn0, Abc_SimdUnit_t * pIn1, int fCompl, int nUnits )
+{
+    unsigned m = fCompl ? ~0 : 0;
+    int w;
+    if ( nUnits > 0 && (pIn0[0] ^ pIn1[0] ^ m) )
+        return 0;
+    if ( nUnits > ABC_SIMD_UNITS_MIN )
+        return Abc_SimdFuncs()->pEqual( pIn0, pIn1, fCompl, nUnits );
+    for ( w = 1; w < nUnits; w++ )
+        if ( pIn0[w] ^ pIn1[w] ^ m )
+            return 0;
+    return 1;
+}
+// returns 1 if all bits of pIn are equal to fConst1
+static inline int Abc_SimdIsConst( Abc_SimdUnit_t * pIn, int fConst1, int nUnits )
+{
+    unsigned m = fConst1 ? ~0 : 0;
+    int w;
+    if ( nUnits > 0 && (pIn[0] ^ m) )
+        return 0;
+    if ( nUnits > ABC_SIMD_UNITS_MIN )
+        return Abc_SimdFuncs()->pIsConst( pIn, fConst1, nUnits );
+    for ( w = 1; w < nUnits; w++ )
+        if ( pIn[w] ^ m )
+            return 0;
+    return 1;
+}
+// returns XOR of pIn[w] * Prime(iStart + w) for all units
+static inline unsigned Abc_SimdHash( Abc_SimdUnit_t * pIn, int iStart, int nUnits )
+{
+    unsigned uHash = 0;
+    int w;
+    if ( nUnits > ABC_SIMD_UNITS_MIN )
+        return Abc_SimdFuncs()->pHash( pIn, iStart, nUnits );
+    for ( w = 0; w < nUnits; w++ )
+        uHash ^= pIn[w] * Abc_SimdPrimes[(iStart + w) & 0x7F];
+    return uHash;
+}
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
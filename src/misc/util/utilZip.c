@@ -0,0 +1,446 @@
+/**CFile****************************************************************
+
+  FileName    [utilZip.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Streaming decompression of input files.]
+
+  Synopsis    [Chunked reader for plain, gzip and bzip2 files.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilZip.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "zlib.h"
+#include "bzlib.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+#include "utilZip.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the decoder keeps two chunks: one is being parsed by the reader
+// while the other one is being filled by the decompression thread
+typedef struct Abc_ZipMan_t_ Abc_ZipMan_t;
+struct Abc_ZipMan_t_
+{
+    gzFile           pGz;         // gzip or plain file
+    FILE *           pFile;       // the underlying file of bzip2 decoder
+    BZFILE *         pBz;         // bzip2 decoder
+    int              fBzEnd;      // bzip2 decoder reached the end of stream
+    int              fEof;        // the end of stream is reached
+    int              fError;      // decoding error is detected
+    unsigned char *  pBufs[2];    // decompressed chunks
+    int              nBufs[2];    // the number of bytes in each chunk
+    int              iBuf;        // the chunk to be consumed next
+    int              iUsed;       // the chunk being consumed (-1 if none)
+#ifdef ABC_USE_PTHREADS
+    int              fThread;     // decompression is done by a separate thread
+    int              fStop;       // the thread should quit
+    int              fFull[2];    // the chunk is ready to be consumed
+    pthread_t        Thread;
+    pthread_mutex_t  Mutex;
+    pthread_cond_t   Cond;
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Detects the compression format using the magic number.]
+
+  Description [Returns 1 for gzip, 2 for bzip2, 3 for zstd, 0 otherwise.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_ZipFormat( char * pFileName )
+{
+    unsigned char Magic[4] = {0};
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return -1;
+    if ( fread( Magic, 1, 4, pFile ) ) {}
+    fclose( pFile );
+    if ( Magic[0] == 0x1f && Magic[1] == 0x8b )
+        return 1;
+    if ( Magic[0] == 'B' && Magic[1] == 'Z' && Magic[2] == 'h' )
+        return 2;
+    if ( Magic[0] == 0x28 && Magic[1] == 0xb5 && Magic[2] == 0x2f && Magic[3] == 0xfd )
+        return 3;
+    return 0;
+}
+int Abc_ZipIsCompressed( char * pFileName )
+{
+    return Abc_ZipFormat( pFileName ) > 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decompresses the next chunk.]
+
+  Description [Returns the number of bytes, 0 at the end, -1 on error.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_ZipDecode( Abc_ZipMan_t * p, unsigned char * pBuf )
+{
+    int nBytes = 0, nRead, bzError = BZ_OK;
+    while ( nBytes < ABC_ZIP_CHUNK )
+    {
+        if ( p->pBz )
+        {
+            if ( p->fBzEnd )
+                break;
+            nRead = BZ2_bzRead( &bzError, p->pBz, pBuf + nBytes, ABC_ZIP_CHUNK - nBytes );
+            if ( bzError != BZ_OK && bzError != BZ_STREAM_END )
+                return -1;
+            p->fBzEnd = (bzError == BZ_STREAM_END);
+        }
+        else
+        {
+            nRead = gzread( p->pGz, pBuf + nBytes, ABC_ZIP_CHUNK - nBytes );
+            if ( nRead < 0 )
+                return -1;
+        }
+        nBytes += nRead;
+        if ( nRead == 0 || bzError == BZ_STREAM_END )
+            break;
+    }
+    return nBytes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decompression thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+static void * Abc_ZipWorkerThread( void * pArg )
+{
+    Abc_ZipMan_t * p = (Abc_ZipMan_t *)pArg;
+    int k = 0, nBytes;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        while ( p->fFull[k] && !p->fStop )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        if ( p->fStop )
+        {
+            pthread_mutex_unlock( &p->Mutex );
+            break;
+        }
+        pthread_mutex_unlock( &p->Mutex );
+        nBytes = Abc_ZipDecode( p, p->pBufs[k] );
+        pthread_mutex_lock( &p->Mutex );
+        p->nBufs[k] = nBytes;
+        p->fFull[k] = 1;
+        pthread_cond_broadcast( &p->Cond );
+        pthread_mutex_unlock( &p->Mutex );
+        if ( nBytes <= 0 )
+            break;
+        k ^= 1;
+    }
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Opens the stream.]
+
+  Description [Recognizes gzip and bzip2 files by their magic numbers;
+  other files are read as is. If fThread is set, decompression of the
+  next chunk overlaps with parsing of the current one.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Zip_t * Abc_ZipOpen( char * pFileName, int fThread )
+{
+    Abc_Zip_t * pZip;
+    Abc_ZipMan_t * p;
+    int bzError, Format = Abc_ZipFormat( pFileName );
+    if ( Format == -1 )
+    {
+        printf( "Abc_ZipOpen(): The file \"%s\" is unavailable (absent or open).\n", pFileName );
+        return NULL;
+    }
+    if ( Format == 3 )
+    {
+        printf( "Abc_ZipOpen(): The file \"%s\" is compressed by zstd, which is not supported.\n", pFileName );
+        return NULL;
+    }
+    p = ABC_CALLOC( Abc_ZipMan_t, 1 );
+    if ( Format == 2 )
+    {
+        p->pFile = fopen( pFileName, "rb" );
+        p->pBz   = p->pFile ? BZ2_bzReadOpen( &bzError, p->pFile, 0, 0, NULL, 0 ) : NULL;
+        if ( p->pBz == NULL || bzError != BZ_OK )
+        {
+            printf( "Abc_ZipOpen(): BZ2_bzReadOpen() failed for file \"%s\".\n", pFileName );
+            if ( p->pFile ) fclose( p->pFile );
+            ABC_FREE( p );
+            return NULL;
+        }
+    }
+    else
+    {
+        // gzopen() reads files without gzip header as is
+        p->pGz = gzopen( pFileName, "rb" );
+        if ( p->pGz == NULL )
+        {
+            printf( "Abc_ZipOpen(): gzopen() failed for file \"%s\".\n", pFileName );
+            ABC_FREE( p );
+            return NULL;
+        }
+    }
+    p->pBufs[0] = ABC_ALLOC( unsigned char, ABC_ZIP_CHUNK );
+    p->pBufs[1] = fThread ? ABC_ALLOC( unsigned char, ABC_ZIP_CHUNK ) : NULL;
+    p->iUsed    = -1;
+#ifdef ABC_USE_PTHREADS
+    if ( fThread )
+    {
+        int status;
+        p->fThread = 1;
+        pthread_mutex_init( &p->Mutex, NULL );
+        pthread_cond_init( &p->Cond, NULL );
+        status = pthread_create( &p->Thread, NULL, Abc_ZipWorkerThread, (void *)p );  assert( status == 0 );
+    }
+#endif
+    pZip = ABC_CALLOC( Abc_Zip_t, 1 );
+    pZip->pData = p;
+    return pZip;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Closes the stream.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_ZipClose( Abc_Zip_t * pZip )
+{
+    Abc_ZipMan_t * p = (Abc_ZipMan_t *)pZip->pData;
+    int bzError;
+#ifdef ABC_USE_PTHREADS
+    if ( p->fThread )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        p->fStop = 1;
+        pthread_cond_broadcast( &p->Cond );
+        pthread_mutex_unlock( &p->Mutex );
+        pthread_join( p->Thread, NULL );
+        pthread_cond_destroy( &p->Cond );
+        pthread_mutex_destroy( &p->Mutex );
+    }
+#endif
+    if ( p->pBz )
+        BZ2_bzReadClose( &bzError, p->pBz );
+    if ( p->pFile )
+        fclose( p->pFile );
+    if ( p->pGz )
+        gzclose( p->pGz );
+    ABC_FREE( p->pBufs[0] );
+    ABC_FREE( p->pBufs[1] );
+    ABC_FREE( p );
+    ABC_FREE( pZip );
+}
+int Abc_ZipIsError( Abc_Zip_t * pZip )
+{
+    return ((Abc_ZipMan_t *)pZip->pData)->fError;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Makes the next chunk available to the reader.]
+
+  Description [Returns 0 if the stream is exhausted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_ZipRefill( Abc_Zip_t * pZip )
+{
+    Abc_ZipMan_t * p = (Abc_ZipMan_t *)pZip->pData;
+    int nBytes;
+    assert( pZip->pCur == pZip->pEnd );
+    if ( p->fEof )
+        return 0;
+#ifdef ABC_USE_PTHREADS
+    if ( p->fThread )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        // return the consumed chunk to the decompression thread
+        if ( p->iUsed >= 0 )
+        {
+            p->fFull[p->iUsed] = 0;
+            pthread_cond_broadcast( &p->Cond );
+        }
+        while ( !p->fFull[p->iBuf] )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        nBytes = p->nBufs[p->iBuf];
+        pthread_mutex_unlock( &p->Mutex );
+        p->iUsed = p->iBuf;
+        p->iBuf ^= 1;
+    }
+    else
+#endif
+    {
+        nBytes = Abc_ZipDecode( p, p->pBufs[0] );
+        p->iUsed = 0;
+    }
+    if ( nBytes <= 0 )
+    {
+        p->fEof = 1;
+        p->fError = (nBytes < 0);
+        return 0;
+    }
+    pZip->pCur = p->pBufs[p->iUsed];
+    pZip->pEnd = pZip->pCur + nBytes;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads one line including the new-line character.]
+
+  Description [Returns the number of characters read, or -1 if the
+  stream is exhausted. The line is truncated if it does not fit.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_ZipReadLine( Abc_Zip_t * p, char * pBuffer, int nSize )
+{
+    int ch, nChars = 0;
+    assert( nSize > 1 );
+    while ( (ch = Abc_ZipGetc(p)) != -1 )
+    {
+        if ( nChars < nSize - 1 )
+            pBuffer[nChars++] = (char)ch;
+        if ( ch == '\n' )
+            break;
+    }
+    pBuffer[nChars] = 0;
+    return (ch == -1 && nChars == 0) ? -1 : nChars;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the remaining part of the stream into memory.]
+
+  Description [The resulting buffer starts with nPrefix bytes of pPrefix
+  and ends with nExtra zero bytes, which are not counted in *pnSize.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Abc_ZipReadRest( Abc_Zip_t * p, char * pPrefix, int nPrefix, int nExtra, int * pnSize )
+{
+    int nSize = nPrefix, nCap = nPrefix + ABC_ZIP_CHUNK + nExtra;
+    char * pBuffer = ABC_ALLOC( char, nCap );
+    if ( nPrefix )
+        memcpy( pBuffer, pPrefix, nPrefix );
+    while ( p->pCur < p->pEnd || Abc_ZipRefill(p) )
+    {
+        int nBytes = (int)(p->pEnd - p->pCur);
+        if ( nSize + nBytes + nExtra > nCap )
+        {
+            while ( nSize + nBytes + nExtra > nCap )
+                nCap *= 2;
+            pBuffer = ABC_REALLOC( char, pBuffer, nCap );
+        }
+        memcpy( pBuffer + nSize, p->pCur, nBytes );
+        nSize += nBytes;
+        p->pCur = p->pEnd;
+    }
+    memset( pBuffer + nSize, 0, nExtra );
+    *pnSize = nSize;
+    return pBuffer;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the (possibly compressed) file into memory.]
+
+  Description [Returns NULL if the file cannot be read.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Abc_ZipReadFile( char * pFileName, int nExtra, int * pnSize )
+{
+    char * pBuffer;
+    Abc_Zip_t * p = Abc_ZipOpen( pFileName, 1 );
+    if ( p == NULL )
+        return NULL;
+    pBuffer = Abc_ZipReadRest( p, NULL, 0, nExtra, pnSize );
+    if ( Abc_ZipIsError(p) )
+    {
+        printf( "Abc_ZipReadFile(): Decompression of file \"%s\" has failed.\n", pFileName );
+        ABC_FREE( pBuffer );
+    }
+    Abc_ZipClose( p );
+    return pBuffer;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,94 @@
+/**CFile****************************************************************
+
+  FileName    [utilZip.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Streaming decompression of input files.]
+
+  Synopsis    [Chunked reader for plain, gzip and bzip2 files.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilZip.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilZip_h
+#define ABC__misc__util__utilZip_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "abc_global.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// the size of one decompressed chunk
+#define ABC_ZIP_CHUNK     (1 << 20)
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Abc_Zip_t_ Abc_Zip_t;
+struct Abc_Zip_t_
+{
+    unsigned char *  pCur;        // the current position in the chunk
+    unsigned char *  pEnd;        // the end of the chunk
+    void *           pData;       // decoder state (private)
+};
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+extern int           Abc_ZipRefill( Abc_Zip_t * p );
+
+// returns the next byte of the decompressed stream or -1 at the end
+static inline int Abc_ZipGetc( Abc_Zip_t * p )
+{
+    if ( p->pCur == p->pEnd && !Abc_ZipRefill(p) )
+        return -1;
+    return *p->pCur++;
+}
+// reads one 7-bit encoded number (as used by binary AIGER)
+static inline unsigned Abc_ZipReadUnsigned( Abc_Zip_t * p )
+{
+    unsigned x = 0, i = 0;
+    int ch;
+    while ( (ch = Abc_ZipGetc(p)) > 0x7f )
+        x |= (ch & 0x7f) << (7 * i++);
+    return ch < 0 ? x : x | (ch << (7 * i));
+}
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilZip.c ==========================================================*/
+
+extern int           Abc_ZipIsCompressed( char * pFileName );
+extern Abc_Zip_t *   Abc_ZipOpen( char * pFileName, int fThread );
+extern void          Abc_ZipClose( Abc_Zip_t * p );
+extern int           Abc_ZipIsError( Abc_Zip_t * p );
+extern int           Abc_ZipReadLine( Abc_Zip_t * p, char * pBuffer, int nSize );
+extern char *        Abc_ZipReadRest( Abc_Zip_t * p, char * pPrefix, int nPrefix, int nExtra, int * pnSize );
+extern char *        Abc_ZipReadFile( char * pFileName, int nExtra, int * pnSize );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
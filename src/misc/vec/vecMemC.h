@@ -0,0 +1,453 @@
+/**CFile****************************************************************
+
+  FileName    [vecMemC.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Resizable arrays.]
+
+  Synopsis    [Concurrent array of memory pieces with hashing.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - July 20, 2012.]
+
+  Revision    [$Id: vecMemC.h,v 1.00 2012/07/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__vec__vecMemC_h
+#define ABC__misc__vec__vecMemC_h
+
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_HEADER_START
+
+/*
+   This is the concurrent version of Vec_Mem_t with hashing. It stores
+   pieces of memory of the given size (such as truth tables) under
+   consecutive IDs, while several threads insert and read the entries.
+
+   The entries are stored in pages, which are never moved. The array of
+   page pointers is allocated once for the pages of all non-negative IDs,
+   so it never overflows and reading an entry by its ID does not need
+   synchronization. The ID of a
+   new entry is taken by incrementing the atomic entry counter, and the
+   page is allocated by the first thread that needs it.
+
+   The hash table is divided into shards selected by the lower bits of
+   the hash key. Each shard is a chained table with its own lock, which
+   is resized independently of the other shards. Lookup and insertion
+   lock one shard, and the batched insertion locks each shard once.
+
+   The set of stored entries does not depend on the order of insertions,
+   but the IDs of the entries do, when they are inserted concurrently.
+*/
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+#define VEC_MEMC_SHARD_LOG  6            // log2 of the number of shards
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Vec_MemCShard_t_ Vec_MemCShard_t;
+struct Vec_MemCShard_t_
+{
+    Vec_Int_t *      vTable;      // hash table (first local index in each bin)
+    Vec_Int_t *      vIds;        // the entry IDs in this shard
+    Vec_Int_t *      vNexts;      // next pointers (local indexes)
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;       // the lock of this shard
+#endif
+};
+
+typedef struct Vec_MemC_t_      Vec_MemC_t;
+struct Vec_MemC_t_
+{
+    int              nEntrySize;  // entry size (in terms of 8-byte words)
+    int              nEntries;    // number of entries (updated atomically)
+    int              LogPageSze;  // log2 of page size (in terms of entries)
+    int              PageMask;    // page mask
+    int              nPagesMax;   // the number of page pointers
+    word **          ppPages;     // memory pages
+    Vec_MemCShard_t  pShards[1 << VEC_MEMC_SHARD_LOG]; // hash table shards
+};
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+#define Vec_MemCForEachEntry( p, pEntry, i )                                              \
+    for ( i = 0; (i < Vec_MemCEntryNum(p)) && ((pEntry) = Vec_MemCReadEntry(p, i)); i++ )
+
+#if defined(ABC_USE_PTHREADS) && defined(__GNUC__)
+static inline int      Vec_MemCAtomicLoadInt( int * p )                       { return __atomic_load_n( p, __ATOMIC_ACQUIRE );                                   }
+static inline int      Vec_MemCAtomicAddInt( int * p, int Value )             { return __atomic_fetch_add( p, Value, __ATOMIC_ACQ_REL );                         }
+static inline word *   Vec_MemCAtomicLoadPtr( word ** p )                     { return __atomic_load_n( p, __ATOMIC_ACQUIRE );                                   }
+static inline int      Vec_MemCAtomicCasPtr( word ** p, word * pNew )         { word * pOld = NULL; return __atomic_compare_exchange_n( p, &pOld, pNew, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ); }
+#else
+// without atomic operations the array can be used by one thread only
+static inline int      Vec_MemCAtomicLoadInt( int * p )                       { return *p;                                                                       }
+static inline int      Vec_MemCAtomicAddInt( int * p, int Value )             { int Old = *p; *p += Value; return Old;                                           }
+static inline word *   Vec_MemCAtomicLoadPtr( word ** p )                     { return *p;                                                                       }
+static inline int      Vec_MemCAtomicCasPtr( word ** p, word * pNew )         { if ( *p ) return 0; *p = pNew; return 1;                                         }
+#endif
+
+static inline void     Vec_MemCLock( Vec_MemCShard_t * p )                    {
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+}
+static inline void     Vec_MemCUnlock( Vec_MemCShard_t * p )                  {
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates the concurrent memory vector.]
+
+  Description [Entry size is in terms of 8-byte words. Page size is log2
+  of the number of entries on one page. The table size is the initial
+  number of bins in all shards.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Vec_MemC_t * Vec_MemCAlloc( int nEntrySize, int LogPageSze, int nTableSize )
+{
+    Vec_MemC_t * p = ABC_CALLOC( Vec_MemC_t, 1 );
+    int i, nShardSize = Abc_MaxInt( nTableSize >> VEC_MEMC_SHARD_LOG, 16 );
+    assert( LogPageSze > 0 && LogPageSze < 31 );
+    p->nEntrySize = nEntrySize;
+    p->LogPageSze = LogPageSze;
+    p->PageMask   = (1 << p->LogPageSze) - 1;
+    p->nPagesMax  = 1 << (31 - p->LogPageSze);
+    p->ppPages    = ABC_CALLOC( word *, p->nPagesMax );
+    for ( i = 0; i < (1 << VEC_MEMC_SHARD_LOG); i++ )
+    {
+        p->pShards[i].vTable = Vec_IntStartFull( Abc_PrimeCudd(nShardSize) );
+        p->pShards[i].vIds   = Vec_IntAlloc( nShardSize );
+        p->pShards[i].vNexts = Vec_IntAlloc( nShardSize );
+#ifdef ABC_USE_PTHREADS
+        pthread_mutex_init( &p->pShards[i].Mutex, NULL );
+#endif
+    }
+    return p;
+}
+static inline void Vec_MemCFree( Vec_MemC_t * p )
+{
+    int i, nPages = (int)(((word)p->nEntries + p->PageMask) >> p->LogPageSze);
+    for ( i = 0; i < nPages; i++ )
+        ABC_FREE( p->ppPages[i] );
+    ABC_FREE( p->ppPages );
+    for ( i = 0; i < (1 << VEC_MEMC_SHARD_LOG); i++ )
+    {
+        Vec_IntFree( p->pShards[i].vTable );
+        Vec_IntFree( p->pShards[i].vIds );
+        Vec_IntFree( p->pShards[i].vNexts );
+#ifdef ABC_USE_PTHREADS
+        pthread_mutex_destroy( &p->pShards[i].Mutex );
+#endif
+    }
+    ABC_FREE( p );
+}
+static inline void Vec_MemCFreeP( Vec_MemC_t ** p )
+{
+    if ( *p == NULL )
+        return;
+    Vec_MemCFree( *p );
+    *p = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description [The number of entries is exact when no insertion is
+  in progress.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Vec_MemCEntrySize( Vec_MemC_t * p )
+{
+    return p->nEntrySize;
+}
+static inline int Vec_MemCEntryNum( Vec_MemC_t * p )
+{
+    return Vec_MemCAtomicLoadInt( &p->nEntries );
+}
+static inline double Vec_MemCMemory( Vec_MemC_t * p )
+{
+    double Mem = (double)sizeof(Vec_MemC_t) + (double)sizeof(word *) * p->nPagesMax;
+    int i, nPages = (int)(((word)Vec_MemCEntryNum(p) + p->PageMask) >> p->LogPageSze);
+    Mem += (double)sizeof(word) * p->nEntrySize * (1 << p->LogPageSze) * nPages;
+    for ( i = 0; i < (1 << VEC_MEMC_SHARD_LOG); i++ )
+        Mem += Vec_IntMemory(p->pShards[i].vTable) + Vec_IntMemory(p->pShards[i].vIds) + Vec_IntMemory(p->pShards[i].vNexts);
+    return Mem;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the entry.]
+
+  Description [Can be called concurrently with insertions, for the IDs
+  returned by the insertion procedures.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word * Vec_MemCReadEntry( Vec_MemC_t * p, int i )
+{
+    assert( i >= 0 );
+    return p->ppPages[i >> p->LogPageSze] + p->nEntrySize * (i & p->PageMask);
+}
+static inline word * Vec_MemCFetchEntry( Vec_MemC_t * p, int i )
+{
+    word ** ppPage = p->ppPages + (i >> p->LogPageSze);
+    assert( i >= 0 );
+    if ( Vec_MemCAtomicLoadPtr(ppPage) == NULL )
+    {
+        word * pPage = ABC_ALLOC( word, p->nEntrySize * (1 << p->LogPageSze) );
+        if ( !Vec_MemCAtomicCasPtr(ppPage, pPage) )
+            ABC_FREE( pPage );
+    }
+    return Vec_MemCReadEntry( p, i );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Hashing entries in the concurrent memory vector.]
+
+  Description [The procedures with the underscore work with a locked
+  shard.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Vec_MemCHashKey( Vec_MemC_t * p, word * pEntry )
+{
+    static int s_Primes[8] = { 1699, 4177, 5147, 5647, 6343, 7103, 7873, 8147 };
+    int i, nData = 2 * p->nEntrySize;
+    unsigned * pData = (unsigned *)pEntry;
+    unsigned uHash = 0;
+    for ( i = 0; i < nData; i++ )
+        uHash += pData[i] * s_Primes[i & 0x7];
+    return uHash ^ (uHash >> 16);
+}
+static inline Vec_MemCShard_t * Vec_MemCHashShard( Vec_MemC_t * p, unsigned uHash )
+{
+    return p->pShards + (uHash & ((1 << VEC_MEMC_SHARD_LOG) - 1));
+}
+static int * Vec_MemCHashLookup_( Vec_MemC_t * p, Vec_MemCShard_t * pShard, word * pEntry, unsigned uHash )
+{
+    int * pSpot = Vec_IntEntryP( pShard->vTable, (uHash >> VEC_MEMC_SHARD_LOG) % Vec_IntSize(pShard->vTable) );
+    for ( ; *pSpot != -1; pSpot = Vec_IntEntryP(pShard->vNexts, *pSpot) )
+        if ( !memcmp( Vec_MemCReadEntry(p, Vec_IntEntry(pShard->vIds, *pSpot)), pEntry, sizeof(word) * p->nEntrySize ) ) // equal
+            return pSpot;
+    return pSpot;
+}
+static void Vec_MemCHashResize_( Vec_MemC_t * p, Vec_MemCShard_t * pShard )
+{
+    int i, Id, * pSpot;
+    Vec_IntFill( pShard->vTable, Abc_PrimeCudd(2 * Vec_IntSize(pShard->vTable)), -1 );
+    Vec_IntForEachEntry( pShard->vIds, Id, i )
+    {
+        word * pEntry = Vec_MemCReadEntry( p, Id );
+        pSpot = Vec_MemCHashLookup_( p, pShard, pEntry, Vec_MemCHashKey(p, pEntry) );
+        assert( *pSpot == -1 );
+        *pSpot = i;
+        Vec_IntWriteEntry( pShard->vNexts, i, -1 );
+    }
+}
+static int Vec_MemCHashInsert_( Vec_MemC_t * p, Vec_MemCShard_t * pShard, word * pEntry, unsigned uHash )
+{
+    int * pSpot, Id;
+    if ( Vec_IntSize(pShard->vIds) > Vec_IntSize(pShard->vTable) )
+        Vec_MemCHashResize_( p, pShard );
+    pSpot = Vec_MemCHashLookup_( p, pShard, pEntry, uHash );
+    if ( *pSpot != -1 )
+        return Vec_IntEntry( pShard->vIds, *pSpot );
+    Id = Vec_MemCAtomicAddInt( &p->nEntries, 1 );
+    if ( Id < 0 || Id == 0x7FFFFFFF )
+        printf( "Hard limit on the number of entries (2^31-1) is reached. Quitting...\n" ), exit(1);
+    memcpy( Vec_MemCFetchEntry(p, Id), pEntry, sizeof(word) * p->nEntrySize );
+    *pSpot = Vec_IntSize(pShard->vIds);
+    Vec_IntPush( pShard->vIds, Id );
+    Vec_IntPush( pShard->vNexts, -1 );
+    return Id;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds or adds the entry.]
+
+  Description [Returns the ID of the entry or -1 if the entry is not
+  found by the lookup.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Vec_MemCHashInsert( Vec_MemC_t * p, word * pEntry )
+{
+    unsigned uHash = Vec_MemCHashKey( p, pEntry );
+    Vec_MemCShard_t * pShard = Vec_MemCHashShard( p, uHash );
+    int Id;
+    Vec_MemCLock( pShard );
+    Id = Vec_MemCHashInsert_( p, pShard, pEntry, uHash );
+    Vec_MemCUnlock( pShard );
+    return Id;
+}
+static inline int Vec_MemCHashLookup( Vec_MemC_t * p, word * pEntry )
+{
+    unsigned uHash = Vec_MemCHashKey( p, pEntry );
+    Vec_MemCShard_t * pShard = Vec_MemCHashShard( p, uHash );
+    int * pSpot, Id;
+    Vec_MemCLock( pShard );
+    pSpot = Vec_MemCHashLookup_( p, pShard, pEntry, uHash );
+    Id = *pSpot == -1 ? -1 : Vec_IntEntry( pShard->vIds, *pSpot );
+    Vec_MemCUnlock( pShard );
+    return Id;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds or adds several entries.]
+
+  Description [The entries are given one after another in the array.
+  The entries falling into the same shard are inserted while the shard
+  is locked once. The new entries of one shard are added in the order
+  of their appearance in the array. The IDs are written into pIds.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Vec_MemCHashInsertArray( Vec_MemC_t * p, word * pEntries, int nEntries, int * pIds )
+{
+    int pStarts[(1 << VEC_MEMC_SHARD_LOG) + 1] = {0};
+    unsigned * pHashes = ABC_ALLOC( unsigned, nEntries );
+    int * pOrder = ABC_ALLOC( int, nEntries );
+    int i, k, s;
+    for ( i = 0; i < nEntries; i++ )
+    {
+        pHashes[i] = Vec_MemCHashKey( p, pEntries + i * p->nEntrySize );
+        pStarts[(pHashes[i] & ((1 << VEC_MEMC_SHARD_LOG) - 1)) + 1]++;
+    }
+    for ( s = 0; s < (1 << VEC_MEMC_SHARD_LOG); s++ )
+        pStarts[s+1] += pStarts[s];
+    for ( i = 0; i < nEntries; i++ )
+        pOrder[pStarts[pHashes[i] & ((1 << VEC_MEMC_SHARD_LOG) - 1)]++] = i;
+    for ( k = s = 0; s < (1 << VEC_MEMC_SHARD_LOG); s++ )
+    {
+        Vec_MemCShard_t * pShard = p->pShards + s;
+        if ( k == pStarts[s] )
+            continue;
+        Vec_MemCLock( pShard );
+        for ( ; k < pStarts[s]; k++ )
+        {
+            i = pOrder[k];
+            pIds[i] = Vec_MemCHashInsert_( p, pShard, pEntries + i * p->nEntrySize, pHashes[i] );
+        }
+        Vec_MemCUnlock( pShard );
+    }
+    ABC_FREE( pHashes );
+    ABC_FREE( pOrder );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates memory vector for storing truth tables.]
+
+  Description [The constant 0 and the elementary variable get IDs 0 and 1.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Vec_MemC_t * Vec_MemCAllocForTT( int nVars, int fCompl )
+{
+    int Value, nWords = (nVars <= 6 ? 1 : (1 << (nVars - 6)));
+    word * uTruth = ABC_ALLOC( word, nWords );
+    Vec_MemC_t * vTtMem = Vec_MemCAlloc( nWords, 12, 10000 );
+    memset( uTruth, 0x00, sizeof(word) * nWords );
+    Value = Vec_MemCHashInsert( vTtMem, uTruth ); assert( Value == 0 );
+    if ( fCompl )
+        memset( uTruth, 0x55, sizeof(word) * nWords );
+    else
+        memset( uTruth, 0xAA, sizeof(word) * nWords );
+    Value = Vec_MemCHashInsert( vTtMem, uTruth ); assert( Value == 1 );
+    ABC_FREE( uTruth );
+    return vTtMem;
+}
+static inline void Vec_MemCDumpTruthTables( Vec_MemC_t * p, char * pName, int nLutSize )
+{
+    FILE * pFile;
+    char pFileName[1000];
+    word * pEntry;
+    int i, w, d;
+    sprintf( pFileName, "tt_%s_%02d.txt", pName ? pName : NULL, nLutSize );
+    pFile = pName ? fopen( pFileName, "wb" ) : stdout;
+    if ( pFile == stdout )
+        printf( "Memory vector has %d entries: \n", Vec_MemCEntryNum(p) );
+    Vec_MemCForEachEntry( p, pEntry, i )
+    {
+        for ( w = p->nEntrySize - 1; w >= 0; w-- )
+            for ( d = 15; d >= 0; d-- )
+                Vec_MemDumpDigit( pFile, (int)(pEntry[w] >> (d<<2)) & 15 );
+        fprintf( pFile, "\n" );
+    }
+    if ( pFile != stdout )
+        fclose( pFile );
+    printf( "Dumped %d %d-var truth tables into file \"%s\" (%.2f MB).\n",
+        Vec_MemCEntryNum(p), nLutSize, pName ? pFileName : "stdout",
+        8.0 * Vec_MemCEntryNum(p) * Vec_MemCEntrySize(p) / (1 << 20) );
+}
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
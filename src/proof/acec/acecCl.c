@@ -409,7 +409,10 @@ Gia_Man_t * Acec_RewriteReplace( Gia_Man_t * p, Vec_Int_t * vRes )
     Gia_ManSetPhase( pNew );
     Gia_ManForEachCo( pNew, pObj, i )
         if ( Gia_ObjPhase(pObj) != Gia_ObjPhase(Gia_ManCo(p, i)) )
+        {
             Gia_ObjFlipFaninC0( pObj );
+            Gia_ManSoaUpdateCo( pNew, pObj );
+        }
     // remove dangling nodes
     pNew = Gia_ManCleanup( pTemp = pNew );
     Gia_ManStop( pTemp );
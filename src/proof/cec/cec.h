@@ -69,6 +69,7 @@ struct Cec_ParSim_t_
     int              fSeqSimulate;  // performs sequential simulation
     int              fLatchCorr;    // consider only latch outputs
     int              fConstCorr;    // consider only constants
+    int              nProcs;        // the number of threads for pre-simulation
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
 };
@@ -99,6 +100,7 @@ struct Cec_ParFra_t_
     int              nItersMax;     // the maximum number of iterations of SAT sweeping
     int              nBTLimit;      // conflict limit at a node
     int              TimeLimit;     // the runtime limit in seconds
+    int              SolverType;    // the SAT solver of the Glucose-based engine (Bmc_SolverType_t)
     int              nLevelMax;     // restriction on the level nodes to be swept
     int              nDepthMax;     // the depth in terms of steps of speculative reduction
     int              fRewriting;    // enables AIG rewriting
@@ -110,9 +112,10 @@ struct Cec_ParFra_t_
     int              fRunCSat;      // enable another solver
     int              fUseCones;     // use cones
     int              fUseOrigIds;   // enable recording of original IDs
-    int              fVeryVerbose;  // verbose stats
-    int              fVerbose;      // verbose stats
-    int              iOutFail;      // the failed output
+    int              nProcs;        // the number of threads
+    int              fVeryVerbose;  // verbose stats
+    int              fVerbose;      // verbose stats
+    int              iOutFail;      // the failed output
 };
 
 // combinational equivalence checking parameters
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "cecInt.h"
+#include "sat/bmc/bmc.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -80,6 +81,7 @@ void Cec_ManSimSetDefaultParams( Cec_ParSim_t * p )
     p->fDualOut       =       0;  // miter with separate outputs
     p->fConstCorr     =       0;  // consider only constants
     p->fSeqSimulate   =       0;  // performs sequential simulation
+    p->nProcs         =       1;  // the number of threads for pre-simulation
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
 } 
@@ -130,6 +132,7 @@ void Cec_ManFraSetDefaultParams( Cec_ParFra_t * p )
     p->TimeLimit      =       0;  // the runtime limit in seconds
     p->nItersMax      =      10;  // the maximum number of iterations of SAT sweeping
     p->nBTLimit       =     100;  // conflict limit at a node
+    p->SolverType     = BMC_SOLVER_GLUCOSE; // the SAT solver of the Glucose-based engine
     p->nLevelMax      =       0;  // restriction on the level of nodes to be swept
     p->nDepthMax      =       1;  // the depth in terms of steps of speculative reduction
     p->fRewriting     =       0;  // enables AIG rewriting
@@ -139,6 +142,7 @@ void Cec_ManFraSetDefaultParams( Cec_ParFra_t * p )
     p->fColorDiff     =       0;  // miter with separate outputs
     p->fSatSweeping   =       0;  // enable SAT sweeping
     p->fUseCones      =       0;  // use cones
+    p->nProcs         =       1;  // the number of threads
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
     p->iOutFail       =      -1;  // the failed output
@@ -271,11 +275,39 @@ int Cec_ManSimulationOne( Gia_Man_t * pAig, Cec_ParSim_t * pPars )
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded random simulation of the miter.]
+
+  Description [Looks for an asserted output using the frontier-based 
+  simulator with the simulation words divided among the threads. 
+  Returns 1 if an output is asserted; the counter-example is saved 
+  in pAig->pCexSeq.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManSimulationMiter( Gia_Man_t * pAig, Cec_ParSim_t * pPars )
+{
+    Gia_ParSim_t ParsSim, * pParsSim = &ParsSim;
+    Gia_ManSimSetDefaultParams( pParsSim );
+    pParsSim->nWords      = pPars->nWords;
+    pParsSim->nIters      = pPars->fSeqSimulate ? pPars->nFrames : 1;
+    pParsSim->TimeLimit   = pPars->TimeLimit;
+    pParsSim->fCheckMiter = 1;
+    pParsSim->fVerbose    = pPars->fVerbose;
+    pParsSim->nProcs      = pPars->nProcs;
+    return Gia_ManSimSimulate( pAig, pParsSim );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Core procedure for simulation.]
 
-  Description []
+  Description [When several threads are given, a miter without candidate
+  equivalences is first simulated in parallel to detect asserted outputs.]
                
   SideEffects []
 
@@ -285,6 +317,14 @@ int Cec_ManSimulationOne( Gia_Man_t * pAig, Cec_ParSim_t * pPars )
 void Cec_ManSimulation( Gia_Man_t * pAig, Cec_ParSim_t * pPars )
 {
     int r, nLitsOld, nLitsNew, nCountNoRef = 0, fStop = 0;
+    if ( pPars->nProcs > 1 && pPars->fCheckMiter && !pPars->fDualOut && pAig->pReprs == NULL )
+    {
+        if ( Cec_ManSimulationMiter( pAig, pPars ) )
+        {
+            Abc_Print( 1, "Random simulation is stopped after the miter output %d was asserted.\n", pAig->pCexSeq->iPo );
+            return;
+        }
+    }
     Gia_ManRandom( 1 );
     if ( pPars->fSeqSimulate )
         Abc_Print( 1, "Performing rounds of random simulation of %d frames with %d words.\n", 
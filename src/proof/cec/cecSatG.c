@@ -20,7 +20,10 @@
 
 #include "aig/gia/gia.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilSimd.h"
 #include "sat/glucose/AbcGlucose.h"
+#include "sat/bmc/bmc.h"
+#include "misc/util/utilPool.h"
 #include "cec.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -29,6 +32,9 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define CEC3_PROC_MAX     64        // the max number of threads
+#define CEC3_BATCH_SIZE   64        // the number of pairs per thread solved in one batch
+
 // sweeping manager
 typedef struct Cec3_Par_t_ Cec3_Par_t;
 struct Cec3_Par_t_
@@ -37,8 +43,10 @@ struct Cec3_Par_t_
     int              nSimRounds;    // simulation rounds
     int              nItersMax;     // max number of iterations
     int              nConfLimit;    // SAT solver conflict limit
+    int              SolverType;    // SAT solver (Bmc_SolverType_t)
     int              fIsMiter;      // this is a miter
     int              fUseCones;     // use logic cones
+    int              nProcs;        // the number of threads
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
 };
@@ -51,7 +59,7 @@ struct Cec3_Man_t_
     Gia_Man_t *      pAig;           // user's AIG
     Gia_Man_t *      pNew;           // internal AIG
     // SAT solving
-    bmcg_sat_solver* pSat;           // SAT solver
+    Bmc_Solver_t *   pSat;           // SAT solver
     Vec_Ptr_t *      vFrontier;      // CNF construction
     Vec_Ptr_t *      vFanins;        // CNF construction
     Vec_Wrd_t *      vSims;          // CI simulation info
@@ -59,6 +67,14 @@ struct Cec3_Man_t_
     Vec_Int_t *      vSatVars;       // nodes
     Vec_Int_t *      vObjSatPairs;   // nodes
     Vec_Int_t *      vCexTriples;    // nodes
+    Vec_Int_t *      vSatIds;        // SAT variables of the nodes of pNew
+    Vec_Int_t *      vTravIds;       // traversal IDs of the nodes of pNew
+    int              nTravIds;       // the current traversal ID
+    // parallel solving
+    Cec3_Man_t **    pWorkers;       // solving managers of the threads
+    Vec_Int_t *      vBatch;         // nodes waiting to be solved
+    Vec_Int_t *      vStatus;        // the solver status for each node
+    Vec_Wec_t *      vCexes;         // the CI values for each disproved node
     // statistics
     int              nPatterns;
     int              nSatSat;
@@ -73,12 +89,27 @@ struct Cec3_Man_t_
     abctime          timeStart;
 };
 
-static inline int    Cec3_ObjSatId( Gia_Man_t * p, Gia_Obj_t * pObj )             { return Gia_ObjCopy2Array(p, Gia_ObjId(p, pObj));                                                     }
-static inline int    Cec3_ObjSetSatId( Gia_Man_t * p, Gia_Obj_t * pObj, int Num ) { assert(Cec3_ObjSatId(p, pObj) == -1); Gia_ObjSetCopy2Array(p, Gia_ObjId(p, pObj), Num); return Num;  }
-static inline void   Cec3_ObjCleanSatId( Gia_Man_t * p, Gia_Obj_t * pObj )        { assert(Cec3_ObjSatId(p, pObj) != -1); Gia_ObjSetCopy2Array(p, Gia_ObjId(p, pObj), -1);               }
+// SAT solving task
+typedef struct Cec3_Task_t_ Cec3_Task_t;
+struct Cec3_Task_t_
+{
+    Cec3_Man_t *     pMan;           // main manager
+    Cec3_Man_t *     pWorker;        // solving manager of the thread
+    int              iEntry;         // the pair in the batch
+};
+
+// the SAT variables and traversal IDs are kept by each solving manager, 
+// so that several managers can work on the shared AIG pNew in parallel
+static inline int    Cec3_ObjSatId( Cec3_Man_t * p, Gia_Obj_t * pObj )             { return Vec_IntEntry(p->vSatIds, Gia_ObjId(p->pNew, pObj));                                                       }
+static inline int    Cec3_ObjSetSatId( Cec3_Man_t * p, Gia_Obj_t * pObj, int Num ) { assert(Cec3_ObjSatId(p, pObj) == -1); Vec_IntWriteEntry(p->vSatIds, Gia_ObjId(p->pNew, pObj), Num); return Num;  }
+static inline void   Cec3_ObjCleanSatId( Cec3_Man_t * p, Gia_Obj_t * pObj )        { assert(Cec3_ObjSatId(p, pObj) != -1); Vec_IntWriteEntry(p->vSatIds, Gia_ObjId(p->pNew, pObj), -1);               }
+
+static inline void   Cec3_ManIncrementTravId( Cec3_Man_t * p )                     { p->nTravIds++;                                                 }
+static inline int    Cec3_ObjIsTravIdCurrentId( Cec3_Man_t * p, int iObj )         { return Vec_IntEntry(p->vTravIds, iObj) == p->nTravIds;         }
+static inline void   Cec3_ObjSetTravIdCurrentId( Cec3_Man_t * p, int iObj )        { Vec_IntWriteEntry(p->vTravIds, iObj, p->nTravIds);             }
 
-static inline void   satoko_mark_cone( bmcg_sat_solver * p, int * pVars, int nVars )   {}
-static inline void   satoko_unmark_cone( bmcg_sat_solver * p, int * pVars, int nVars ) {}
+static inline void   satoko_mark_cone( Bmc_Solver_t * p, int * pVars, int nVars )   {}
+static inline void   satoko_unmark_cone( Bmc_Solver_t * p, int * pVars, int nVars ) {}
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -102,8 +133,10 @@ void Cec3_SetDefaultParams( Cec3_Par_t * p )
     p->nSimRounds     =       4;    // simulation rounds
     p->nItersMax      =      10;    // max number of iterations
     p->nConfLimit     =    1000;    // conflict limit at a node
+    p->SolverType     = BMC_SOLVER_GLUCOSE; // SAT solver
     p->fIsMiter       =       0;    // this is a miter
     p->fUseCones      =       0;    // use logic cones
+    p->nProcs         =       1;    // the number of threads
     p->fVeryVerbose   =       0;    // verbose stats
     p->fVerbose       =       0;    // verbose stats
 }  
@@ -119,7 +152,7 @@ void Cec3_SetDefaultParams( Cec3_Par_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSat )
+void Cec3_AddClausesMux( Cec3_Man_t * p, Gia_Obj_t * pNode, Bmc_Solver_t * pSat )
 {
     int fPolarFlip = 0;
     Gia_Obj_t * pNodeI, * pNodeT, * pNodeE;
@@ -155,7 +188,7 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeT)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Bmc_SolverAddClause( pSat, pLits, 3 );
     assert( RetValue );
     pLits[0] = Abc_Var2Lit(VarI, 1);
     pLits[1] = Abc_Var2Lit(VarT, 0^fCompT);
@@ -166,7 +199,7 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeT)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Bmc_SolverAddClause( pSat, pLits, 3 );
     assert( RetValue );
     pLits[0] = Abc_Var2Lit(VarI, 0);
     pLits[1] = Abc_Var2Lit(VarE, 1^fCompE);
@@ -177,7 +210,7 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Bmc_SolverAddClause( pSat, pLits, 3 );
     assert( RetValue );
     pLits[0] = Abc_Var2Lit(VarI, 0);
     pLits[1] = Abc_Var2Lit(VarE, 0^fCompE);
@@ -188,7 +221,7 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Bmc_SolverAddClause( pSat, pLits, 3 );
     assert( RetValue );
 
     // two additional clauses
@@ -213,7 +246,7 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Bmc_SolverAddClause( pSat, pLits, 3 );
     assert( RetValue );
     pLits[0] = Abc_Var2Lit(VarT, 1^fCompT);
     pLits[1] = Abc_Var2Lit(VarE, 1^fCompE);
@@ -224,10 +257,10 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Bmc_SolverAddClause( pSat, pLits, 3 );
     assert( RetValue );
 }
-void Cec3_AddClausesSuper( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper, bmcg_sat_solver * pSat )
+void Cec3_AddClausesSuper( Cec3_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper, Bmc_Solver_t * pSat )
 {
     int fPolarFlip = 0;
     Gia_Obj_t * pFanin;
@@ -248,7 +281,7 @@ void Cec3_AddClausesSuper( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper,
             if ( Gia_Regular(pFanin)->fPhase )  pLits[0] = Abc_LitNot( pLits[0] );
             if ( pNode->fPhase )                pLits[1] = Abc_LitNot( pLits[1] );
         }
-        RetValue = bmcg_sat_solver_addclause( pSat, pLits, 2 );
+        RetValue = Bmc_SolverAddClause( pSat, pLits, 2 );
         assert( RetValue );
     }
     // add A & B => C   or   !A + !B + C
@@ -265,7 +298,7 @@ void Cec3_AddClausesSuper( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper,
     {
         if ( pNode->fPhase )  pLits[nLits-1] = Abc_LitNot( pLits[nLits-1] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, nLits );
+    RetValue = Bmc_SolverAddClause( pSat, pLits, nLits );
     assert( RetValue );
     ABC_FREE( pLits );
 }
@@ -302,14 +335,14 @@ void Cec3_CollectSuper( Gia_Obj_t * pObj, int fUseMuxes, Vec_Ptr_t * vSuper )
     Vec_PtrClear( vSuper );
     Cec3_CollectSuper_rec( pObj, vSuper, 1, fUseMuxes );
 }
-void Cec3_ObjAddToFrontier( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Ptr_t * vFrontier, bmcg_sat_solver * pSat )
+void Cec3_ObjAddToFrontier( Cec3_Man_t * p, Gia_Obj_t * pObj, Vec_Ptr_t * vFrontier, Bmc_Solver_t * pSat )
 {
     assert( !Gia_IsComplement(pObj) );
     assert( !Gia_ObjIsConst0(pObj) );
     if ( Cec3_ObjSatId(p, pObj) >= 0 )
         return;
     assert( Cec3_ObjSatId(p, pObj) == -1 );
-    Cec3_ObjSetSatId( p, pObj, bmcg_sat_solver_addvar(pSat) );
+    Cec3_ObjSetSatId( p, pObj, Bmc_SolverAddVar(pSat) );
     if ( Gia_ObjIsAnd(pObj) )
         Vec_PtrPush( vFrontier, pObj );
 }
@@ -319,20 +352,20 @@ int Cec3_ObjGetCnfVar( Cec3_Man_t * p, int iObj )
     Gia_Obj_t * pObj = Gia_ManObj(p->pNew, iObj);
     int i, k, fUseMuxes = 1;
     // quit if CNF is ready
-    if ( Cec3_ObjSatId(p->pNew,pObj) >= 0 )
-        return Cec3_ObjSatId(p->pNew,pObj);
+    if ( Cec3_ObjSatId(p,pObj) >= 0 )
+        return Cec3_ObjSatId(p,pObj);
     assert( iObj > 0 );
     if ( Gia_ObjIsCi(pObj) )
-        return Cec3_ObjSetSatId( p->pNew, pObj, bmcg_sat_solver_addvar(p->pSat) );
+        return Cec3_ObjSetSatId( p, pObj, Bmc_SolverAddVar(p->pSat) );
     assert( Gia_ObjIsAnd(pObj) );
     // start the frontier
     Vec_PtrClear( p->vFrontier );
-    Cec3_ObjAddToFrontier( p->pNew, pObj, p->vFrontier, p->pSat );
+    Cec3_ObjAddToFrontier( p, pObj, p->vFrontier, p->pSat );
     // explore nodes in the frontier
     Vec_PtrForEachEntry( Gia_Obj_t *, p->vFrontier, pNode, i )
     {
         // create the supergate
-        assert( Cec3_ObjSatId(p->pNew,pNode) >= 0 );
+        assert( Cec3_ObjSatId(p,pNode) >= 0 );
         if ( fUseMuxes && pNode->fMark0 )
         {
             Vec_PtrClear( p->vFanins );
@@ -341,19 +374,19 @@ int Cec3_ObjGetCnfVar( Cec3_Man_t * p, int iObj )
             Vec_PtrPushUnique( p->vFanins, Gia_ObjFanin1( Gia_ObjFanin0(pNode) ) );
             Vec_PtrPushUnique( p->vFanins, Gia_ObjFanin1( Gia_ObjFanin1(pNode) ) );
             Vec_PtrForEachEntry( Gia_Obj_t *, p->vFanins, pFanin, k )
-                Cec3_ObjAddToFrontier( p->pNew, Gia_Regular(pFanin), p->vFrontier, p->pSat );
-            Cec3_AddClausesMux( p->pNew, pNode, p->pSat );
+                Cec3_ObjAddToFrontier( p, Gia_Regular(pFanin), p->vFrontier, p->pSat );
+            Cec3_AddClausesMux( p, pNode, p->pSat );
         }
         else
         {
             Cec3_CollectSuper( pNode, fUseMuxes, p->vFanins );
             Vec_PtrForEachEntry( Gia_Obj_t *, p->vFanins, pFanin, k )
-                Cec3_ObjAddToFrontier( p->pNew, Gia_Regular(pFanin), p->vFrontier, p->pSat );
-            Cec3_AddClausesSuper( p->pNew, pNode, p->vFanins, p->pSat );
+                Cec3_ObjAddToFrontier( p, Gia_Regular(pFanin), p->vFrontier, p->pSat );
+            Cec3_AddClausesSuper( p, pNode, p->vFanins, p->pSat );
         }
         assert( Vec_PtrSize(p->vFanins) > 1 );
     }
-    return Cec3_ObjSatId(p->pNew,pObj);
+    return Cec3_ObjSatId(p,pObj);
 }
 
 
@@ -381,64 +414,31 @@ static inline void Cec3_ObjSimSetInputBit( Gia_Man_t * p, int iObj, int Bit )
 }
 static inline void Cec3_ObjSimRo( Gia_Man_t * p, int iObj )
 {
-    int w;
     word * pSimRo = Cec3_ObjSim( p, iObj );
     word * pSimRi = Cec3_ObjSim( p, Gia_ObjRoToRiId(p, iObj) );
-    for ( w = 0; w < p->nSimWords; w++ )
-        pSimRo[w] = pSimRi[w];
+    Abc_SimdCopy( (Abc_SimdUnit_t *)pSimRo, (Abc_SimdUnit_t *)pSimRi, 0, 2 * p->nSimWords );
 }
 static inline void Cec3_ObjSimCo( Gia_Man_t * p, int iObj )
 {
-    int w;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
     word * pSimCo  = Cec3_ObjSim( p, iObj );
     word * pSimDri = Cec3_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSimCo[w] = ~pSimDri[w];
-    else
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSimCo[w] =  pSimDri[w];
+    Abc_SimdCopy( (Abc_SimdUnit_t *)pSimCo, (Abc_SimdUnit_t *)pSimDri, Gia_ObjFaninC0(pObj), 2 * p->nSimWords );
 }
 static inline void Cec3_ObjSimAnd( Gia_Man_t * p, int iObj )
 {
-    int w;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
     word * pSim  = Cec3_ObjSim( p, iObj );
     word * pSim0 = Cec3_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec3_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = ~pSim0[w] & ~pSim1[w];
-    else if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = ~pSim0[w] & pSim1[w];
-    else if ( !Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = pSim0[w] & ~pSim1[w];
-    else
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = pSim0[w] & pSim1[w];
+    Abc_SimdAnd( (Abc_SimdUnit_t *)pSim, (Abc_SimdUnit_t *)pSim0, (Abc_SimdUnit_t *)pSim1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), 0, 2 * p->nSimWords );
 }
 static inline int Cec3_ObjSimEqual( Gia_Man_t * p, int iObj0, int iObj1 )
 {
-    int w;
     word * pSim0 = Cec3_ObjSim( p, iObj0 );
     word * pSim1 = Cec3_ObjSim( p, iObj1 );
-    if ( (pSim0[0] & 1) == (pSim1[0] & 1) )
-    {
-        for ( w = 0; w < p->nSimWords; w++ )
-            if ( pSim0[w] != pSim1[w] )
-                return 0;
-        return 1;
-    }
-    else
-    {
-        for ( w = 0; w < p->nSimWords; w++ )
-            if ( pSim0[w] != ~pSim1[w] )
-                return 0;
-        return 1;
-    }
+    int fCompl = (pSim0[0] & 1) != (pSim1[0] & 1);
+    return Abc_SimdEqual( (Abc_SimdUnit_t *)pSim0, (Abc_SimdUnit_t *)pSim1, fCompl, 2 * p->nSimWords );
 }
 static inline void Cec3_ObjSimCi( Gia_Man_t * p, int iObj )
 {
@@ -510,7 +510,7 @@ int Cec3_ManSimulate( Gia_Man_t * p, Vec_Int_t * vTriples, Cec3_Man_t * pMan )
             word * pSim1 = Cec3_ObjSim( p, iObj );
             int iPat     = Abc_Lit2Var(Entry);
             int fPhase   = Abc_LitIsCompl(Entry);
-            if ( (fPhase ^ Abc_InfoHasBit((unsigned *)pSim0, iPat)) == Abc_InfoHasBit((unsigned *)pSim1, iPat) )
+            if ( (fPhase ^ Abc_InfoHasBit((Abc_SimdUnit_t *)pSim0, iPat)) == Abc_InfoHasBit((Abc_SimdUnit_t *)pSim1, iPat) )
             {
                 //printf( "ERROR:  Pattern %d did not disprove pair %d and %d.\n", iPat, iRepr, iObj );
                 Count++;
@@ -549,7 +549,7 @@ int Cec3_ManSimHashKey( word * pSim, int nSims, int nTableSize )
     static int s_Primes[16] = { 
         1291, 1699, 1999, 2357, 2953, 3313, 3907, 4177, 
         4831, 5147, 5647, 6343, 6899, 7103, 7873, 8147 };
-    unsigned uHash = 0, * pSimU = (unsigned *)pSim;
+    unsigned uHash = 0, * pSimU = (Abc_SimdUnit_t *)pSim;
     int i, nSimsU = 2 * nSims;
     if ( pSimU[0] & 1 )
         for ( i = 0; i < nSimsU; i++ )
@@ -647,6 +647,49 @@ void Cec3_ManCreateClasses( Gia_Man_t * p, Cec3_Man_t * pMan )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Solving managers used by the threads.]
+
+  Description [A worker shares the AIGs and the parameters with the main
+  manager but has its own SAT solver, CNF variables and traversal IDs.
+  The workers run only while the main manager waits for them, so the 
+  shared AIGs do not change while they are read.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cec3_Man_t * Cec3_ManCreateWorker( Cec3_Man_t * pMan )
+{
+    Cec3_Man_t * p = ABC_CALLOC( Cec3_Man_t, 1 );
+    p->pPars        = pMan->pPars;
+    p->pAig         = pMan->pAig;
+    p->pNew         = pMan->pNew;
+    p->pSat         = Bmc_SolverStart( p->pPars->SolverType );
+    p->vFrontier    = Vec_PtrAlloc( 1000 );
+    p->vFanins      = Vec_PtrAlloc( 100 );
+    p->vNodesNew    = Vec_IntAlloc( 100 );
+    p->vSatVars     = Vec_IntAlloc( 100 );
+    p->vObjSatPairs = Vec_IntAlloc( 100 );
+    p->vSatIds      = Vec_IntStartFull( Gia_ManObjNum(p->pNew) );
+    p->vTravIds     = Vec_IntStart( Gia_ManObjNum(p->pNew) );
+    return p;
+}
+void Cec3_ManStopWorker( Cec3_Man_t * p )
+{
+    Bmc_SolverStop( p->pSat );
+    Vec_PtrFreeP( &p->vFrontier );
+    Vec_PtrFreeP( &p->vFanins );
+    Vec_IntFreeP( &p->vNodesNew );
+    Vec_IntFreeP( &p->vSatVars );
+    Vec_IntFreeP( &p->vObjSatPairs );
+    Vec_IntFreeP( &p->vSatIds );
+    Vec_IntFreeP( &p->vTravIds );
+    ABC_FREE( p );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -676,24 +719,51 @@ Cec3_Man_t * Cec3_ManCreate( Gia_Man_t * pAig, Cec3_Par_t * pPars )
     Gia_ManForEachCi( pAig, pObj, i )
         pObj->Value = Gia_ManAppendCi( p->pNew );
     Gia_ManHashAlloc( p->pNew );
-    Vec_IntFill( &p->pNew->vCopies2, Gia_ManObjNum(p->pNew), -1 );
     // SAT solving
     //memset( &Pars, 0, sizeof(satoko_opts_t) );
-    p->pSat         = bmcg_sat_solver_start();
+    p->pSat         = Bmc_SolverStart( p->pPars->SolverType );
     p->vFrontier    = Vec_PtrAlloc( 1000 );
     p->vFanins      = Vec_PtrAlloc( 100 );
     p->vNodesNew    = Vec_IntAlloc( 100 );
     p->vSatVars     = Vec_IntAlloc( 100 );
     p->vObjSatPairs = Vec_IntAlloc( 100 );
     p->vCexTriples  = Vec_IntAlloc( 100 );
+    p->vSatIds      = Vec_IntStartFull( Gia_ManObjNum(p->pNew) );
+    p->vTravIds     = Vec_IntStart( Gia_ManObjNum(p->pNew) );
     //Pars.conf_limit = pPars->nConfLimit;
     //satoko_configure(p->pSat, &Pars);
     // remember pointer to the solver in the AIG manager
     pAig->pData     = p->pSat;
+    // create solving managers for the threads (the incremental solver used with cones is not shared)
+    if ( pPars->nProcs > 1 && !pPars->fUseCones )
+    {
+        Gia_ManCleanMark1( pAig );
+        p->pWorkers = ABC_CALLOC( Cec3_Man_t *, pPars->nProcs );
+        for ( i = 0; i < pPars->nProcs; i++ )
+            p->pWorkers[i] = Cec3_ManCreateWorker( p );
+        p->vBatch   = Vec_IntAlloc( CEC3_BATCH_SIZE * pPars->nProcs );
+        p->vStatus  = Vec_IntAlloc( CEC3_BATCH_SIZE * pPars->nProcs );
+    }
+    p->vCexes       = Vec_WecStart( p->pWorkers ? CEC3_BATCH_SIZE * pPars->nProcs : 1 );
     return p;
 }
 void Cec3_ManDestroy( Cec3_Man_t * p )
 {
+    int i;
+    if ( p->pWorkers )
+    {
+        for ( i = 0; i < p->pPars->nProcs; i++ )
+        {
+            p->timeSatSat   += p->pWorkers[i]->timeSatSat;
+            p->timeSatUnsat += p->pWorkers[i]->timeSatUnsat;
+            p->timeSatUndec += p->pWorkers[i]->timeSatUndec;
+            p->timeExtra    += p->pWorkers[i]->timeExtra;
+            Cec3_ManStopWorker( p->pWorkers[i] );
+        }
+        ABC_FREE( p->pWorkers );
+        Vec_IntFreeP( &p->vBatch );
+        Vec_IntFreeP( &p->vStatus );
+    }
     if ( p->pPars->fVerbose ) 
     {
         abctime timeTotal = Abc_Clock() - p->timeStart;
@@ -715,7 +785,7 @@ void Cec3_ManDestroy( Cec3_Man_t * p )
     Vec_WrdFreeP( &p->pAig->vSims );
     //Vec_WrdFreeP( &p->pAig->vSimsPi );
     Gia_ManCleanMark01( p->pAig );
-    bmcg_sat_solver_stop( p->pSat );
+    Bmc_SolverStop( p->pSat );
     Gia_ManStopP( &p->pNew );
     Vec_PtrFreeP( &p->vFrontier );
     Vec_PtrFreeP( &p->vFanins );
@@ -723,10 +793,12 @@ void Cec3_ManDestroy( Cec3_Man_t * p )
     Vec_IntFreeP( &p->vSatVars );
     Vec_IntFreeP( &p->vObjSatPairs );
     Vec_IntFreeP( &p->vCexTriples );
+    Vec_IntFreeP( &p->vSatIds );
+    Vec_IntFreeP( &p->vTravIds );
+    Vec_WecFreeP( &p->vCexes );
     ABC_FREE( p );
 }
 
-
 /**Function*************************************************************
 
   Synopsis    [Verify counter-example.]
@@ -738,9 +810,10 @@ void Cec3_ManDestroy( Cec3_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-int Cec3_ManVerify_rec( Gia_Man_t * p, int iObj, bmcg_sat_solver * pSat )
+int Cec3_ManVerify_rec( Cec3_Man_t * pMan, int iObj )
 {
     int Value0, Value1;
+    Gia_Man_t * p = pMan->pNew;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
     if ( iObj == 0 ) return 0;
     if ( Gia_ObjIsTravIdCurrentId(p, iObj) )
@@ -748,20 +821,20 @@ int Cec3_ManVerify_rec( Gia_Man_t * p, int iObj, bmcg_sat_solver * pSat )
     Gia_ObjSetTravIdCurrentId(p, iObj);
     if ( Gia_ObjIsCi(pObj) )
 //        return pObj->fMark1 = satoko_var_polarity(pSat, Cec3_ObjSatId(p, pObj)) == SATOKO_LIT_TRUE;
-        return pObj->fMark1 = bmcg_sat_solver_read_cex_varvalue(pSat, Cec3_ObjSatId(p, pObj));
+        return pObj->fMark1 = Bmc_SolverVarValue(pMan->pSat, Cec3_ObjSatId(pMan, pObj));
     assert( Gia_ObjIsAnd(pObj) );
-    Value0 = Cec3_ManVerify_rec( p, Gia_ObjFaninId0(pObj, iObj), pSat ) ^ Gia_ObjFaninC0(pObj);
-    Value1 = Cec3_ManVerify_rec( p, Gia_ObjFaninId1(pObj, iObj), pSat ) ^ Gia_ObjFaninC1(pObj);
+    Value0 = Cec3_ManVerify_rec( pMan, Gia_ObjFaninId0(pObj, iObj) ) ^ Gia_ObjFaninC0(pObj);
+    Value1 = Cec3_ManVerify_rec( pMan, Gia_ObjFaninId1(pObj, iObj) ) ^ Gia_ObjFaninC1(pObj);
     return pObj->fMark1 = Value0 & Value1;
 }
-void Cec3_ManVerify( Gia_Man_t * p, int iObj0, int iObj1, int fPhase, bmcg_sat_solver * pSat )
+void Cec3_ManVerify( Cec3_Man_t * p, int iObj0, int iObj1, int fPhase )
 {
 //    int val0 = satoko_var_polarity(pSat, Cec3_ObjSatId(p, Gia_ManObj(p, iObj0))) == SATOKO_LIT_TRUE;
 //    int val1 = satoko_var_polarity(pSat, Cec3_ObjSatId(p, Gia_ManObj(p, iObj1))) == SATOKO_LIT_TRUE;
     int Value0, Value1;
-    Gia_ManIncrementTravId( p );
-    Value0 = Cec3_ManVerify_rec( p, iObj0, pSat );
-    Value1 = Cec3_ManVerify_rec( p, iObj1, pSat );
+    Gia_ManIncrementTravId( p->pNew );
+    Value0 = Cec3_ManVerify_rec( p, iObj0 );
+    Value1 = Cec3_ManVerify_rec( p, iObj1 );
     if ( (Value0 ^ Value1) == fPhase )
         printf( "CEX verification FAILED for obj %d and obj %d.\n", iObj0, iObj1 );
 //    else
@@ -782,14 +855,14 @@ void Cec3_ManVerify( Gia_Man_t * p, int iObj0, int iObj1, int fPhase, bmcg_sat_s
 void Cec3_ManCollect_rec( Cec3_Man_t * p, int iObj )
 {
     Gia_Obj_t * pObj;
-    if ( Gia_ObjIsTravIdCurrentId(p->pNew, iObj) )
+    if ( Cec3_ObjIsTravIdCurrentId(p, iObj) )
         return;
-    Gia_ObjSetTravIdCurrentId(p->pNew, iObj);
+    Cec3_ObjSetTravIdCurrentId(p, iObj);
     pObj = Gia_ManObj( p->pNew, iObj );
-    if ( Cec3_ObjSatId(p->pNew, pObj) >= 0 )
+    if ( Cec3_ObjSatId(p, pObj) >= 0 )
     {
         Vec_IntPush( p->vNodesNew, iObj );
-        Vec_IntPush( p->vSatVars, Cec3_ObjSatId(p->pNew, pObj) );
+        Vec_IntPush( p->vSatVars, Cec3_ObjSatId(p, pObj) );
     }
     if ( !iObj )
         return;
@@ -800,8 +873,8 @@ void Cec3_ManCollect_rec( Cec3_Man_t * p, int iObj )
     }
     else
     {
-        assert( Cec3_ObjSatId(p->pNew, pObj) >= 0 );
-        Vec_IntPushTwo( p->vObjSatPairs, Gia_ManCiIdToId(p->pAig, Gia_ObjCioId(pObj)), Cec3_ObjSatId(p->pNew, pObj) ); // SAT var
+        assert( Cec3_ObjSatId(p, pObj) >= 0 );
+        Vec_IntPushTwo( p->vObjSatPairs, Gia_ManCiIdToId(p->pAig, Gia_ObjCioId(pObj)), Cec3_ObjSatId(p, pObj) ); // SAT var
     }
 }
 int Cec3_ManSolveTwo( Cec3_Man_t * p, int iObj0, int iObj1, int fPhase )
@@ -811,16 +884,18 @@ int Cec3_ManSolveTwo( Cec3_Man_t * p, int iObj0, int iObj1, int fPhase )
 	if (iObj1 < iObj0) 
         iObj1 ^= iObj0, iObj0 ^= iObj1, iObj1 ^= iObj0;
     assert( iObj0 < iObj1 );
-    assert( p->pPars->fUseCones || bmcg_sat_solver_varnum(p->pSat) == 0 );
-    if ( !iObj0 && Cec3_ObjSatId(p->pNew, Gia_ManConst0(p->pNew)) == -1 )
-        Cec3_ObjSetSatId( p->pNew, Gia_ManConst0(p->pNew), bmcg_sat_solver_addvar(p->pSat) );
+    assert( p->pPars->fUseCones || Bmc_SolverVarNum(p->pSat) == 0 );
+    Vec_IntFillExtra( p->vSatIds, Gia_ManObjNum(p->pNew), -1 );
+    Vec_IntFillExtra( p->vTravIds, Gia_ManObjNum(p->pNew), 0 );
+    if ( !iObj0 && Cec3_ObjSatId(p, Gia_ManConst0(p->pNew)) == -1 )
+        Cec3_ObjSetSatId( p, Gia_ManConst0(p->pNew), Bmc_SolverAddVar(p->pSat) );
     iVar0 = Cec3_ObjGetCnfVar( p, iObj0 );
     iVar1 = Cec3_ObjGetCnfVar( p, iObj1 );
     // collect inputs and internal nodes
     Vec_IntClear( p->vNodesNew );
     Vec_IntClear( p->vSatVars );
     Vec_IntClear( p->vObjSatPairs );
-    Gia_ManIncrementTravId( p->pNew );
+    Cec3_ManIncrementTravId( p );
     Cec3_ManCollect_rec( p, iObj0 );
     Cec3_ManCollect_rec( p, iObj1 );
 //printf( "%d ", Vec_IntSize(p->vNodesNew) );
@@ -833,8 +908,8 @@ int Cec3_ManSolveTwo( Cec3_Man_t * p, int iObj0, int iObj1, int fPhase )
 //    satoko_assump_pop( p->pSat );
     Lits[0] = Abc_Var2Lit(iVar0, 1);
     Lits[1] = Abc_Var2Lit(iVar1, fPhase);
-    bmcg_sat_solver_set_conflict_budget( p->pSat, p->pPars->nConfLimit );
-    status = bmcg_sat_solver_solve( p->pSat, Lits, 2 );
+    Bmc_SolverSetConflictBudget( p->pSat, p->pPars->nConfLimit );
+    status = Bmc_SolverSolve( p->pSat, Lits, 2 );
     if ( status == GLUCOSE_UNSAT && iObj0 > 0 )
     {
         // solve reverse
@@ -845,62 +920,189 @@ int Cec3_ManSolveTwo( Cec3_Man_t * p, int iObj0, int iObj1, int fPhase )
 //        satoko_assump_pop( p->pSat );
         Lits[0] = Abc_Var2Lit(iVar0, 0);
         Lits[1] = Abc_Var2Lit(iVar1, !fPhase);
-        bmcg_sat_solver_set_conflict_budget( p->pSat, p->pPars->nConfLimit );
-        status = bmcg_sat_solver_solve( p->pSat, Lits, 2 );
+        Bmc_SolverSetConflictBudget( p->pSat, p->pPars->nConfLimit );
+        status = Bmc_SolverSolve( p->pSat, Lits, 2 );
     }
     if ( p->pPars->fUseCones )  satoko_unmark_cone( p->pSat, Vec_IntArray(p->vSatVars), Vec_IntSize(p->vSatVars) );
     //if ( status == SATOKO_SAT )
-    //    Cec3_ManVerify( p->pNew, iObj0, iObj1, fPhase, p->pSat );
+    //    Cec3_ManVerify( p, iObj0, iObj1, fPhase );
     if ( p->pPars->fUseCones )
         return status;
     Gia_ManForEachObjVec( p->vNodesNew, p->pNew, pObj, i )
-        Cec3_ObjCleanSatId( p->pNew, pObj );
+        Cec3_ObjCleanSatId( p, pObj );
     return status;
 }
 
-int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
+/**Function*************************************************************
+
+  Synopsis    [Solves one candidate pair.]
+
+  Description [Does not modify the AIGs, so that it can be called by 
+  several threads. The CI values of the counter-example are returned 
+  as pairs (AIG ID, value) in vCex.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec3_ManSweepNodeSolve( Cec3_Man_t * p, int iObj, Vec_Int_t * vCex )
 {
     abctime clk = Abc_Clock();
-    int i, IdAig, IdSat, status, RetValue = 1;
+    int i, IdAig, IdSat, status;
     Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
     Gia_Obj_t * pRepr = Gia_ObjReprObj( p->pAig, iObj );
     int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
     status = Cec3_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl );
+    Vec_IntClear( vCex );
+    if ( status == GLUCOSE_SAT )
+    {
+        Vec_IntForEachEntryDouble( p->vObjSatPairs, IdAig, IdSat, i )
+//            Vec_IntPushTwo( vCex, IdAig, satoko_var_polarity(p->pSat, IdSat) == SATOKO_LIT_TRUE );
+            Vec_IntPushTwo( vCex, IdAig, Bmc_SolverVarValue(p->pSat, IdSat) );
+        p->timeSatSat += Abc_Clock() - clk;
+    }
+    else if ( status == GLUCOSE_UNSAT )
+        p->timeSatUnsat += Abc_Clock() - clk;
+    else 
+        p->timeSatUndec += Abc_Clock() - clk;
+    if ( p->pPars->fUseCones )
+        return status;
+    clk = Abc_Clock();
+    Bmc_SolverReset( p->pSat );
+    p->timeExtra += Abc_Clock() - clk;
+//    satoko_stats(p->pSat)->n_conflicts = 0;
+    return status;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the result of solving one candidate pair.]
+
+  Description [Returns 0 if the pair is disproved, 1 if it is proved,
+  and 2 if the solver ran out of conflicts.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec3_ManSweepNodeApply( Cec3_Man_t * p, int iObj, int status, Vec_Int_t * vCex )
+{
+    int i, IdAig, Value;
+    Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
+    Gia_Obj_t * pRepr = Gia_ObjReprObj( p->pAig, iObj );
+    int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
     if ( status == GLUCOSE_SAT )
     {
         p->nSatSat++;
         p->nPatterns++;
         p->pAig->iPatsPi = (p->pAig->iPatsPi == 64 * p->pAig->nSimWords - 1) ? 1 : p->pAig->iPatsPi + 1;
         assert( p->pAig->iPatsPi > 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords );
-        Vec_IntForEachEntryDouble( p->vObjSatPairs, IdAig, IdSat, i )
-//            Cec3_ObjSimSetInputBit( p->pAig, IdAig, satoko_var_polarity(p->pSat, IdSat) == SATOKO_LIT_TRUE );
-            Cec3_ObjSimSetInputBit( p->pAig, IdAig, bmcg_sat_solver_read_cex_varvalue(p->pSat, IdSat) );
-        p->timeSatSat += Abc_Clock() - clk;
-        RetValue = 0;
+        Vec_IntForEachEntryDouble( vCex, IdAig, Value, i )
+            Cec3_ObjSimSetInputBit( p->pAig, IdAig, Value );
+        return 0;
     }
-    else if ( status == GLUCOSE_UNSAT )
+    if ( status == GLUCOSE_UNSAT )
     {
         p->nSatUnsat++;
         pObj->Value = Abc_LitNotCond( pRepr->Value, fCompl );
         Gia_ObjSetProved( p->pAig, iObj );
-        p->timeSatUnsat += Abc_Clock() - clk;
-        RetValue = 1;
+        return 1;
     }
-    else 
+    p->nSatUndec++;
+    assert( status == GLUCOSE_UNDEC );
+    Gia_ObjSetFailed( p->pAig, iObj );
+    return 2;
+}
+int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
+{
+    Vec_Int_t * vCex = Vec_WecEntry( p->vCexes, 0 );
+    int status = Cec3_ManSweepNodeSolve( p, iObj, vCex );
+    return Cec3_ManSweepNodeApply( p, iObj, status, vCex );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Updates the AIG after the pair is solved.]
+
+  Description [Returns 1 if the pair is disproved.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec3_ManSweepNodeFinish( Cec3_Man_t * p, int iObj, int RetValue )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
+    Gia_Obj_t * pRepr = Gia_ObjReprObj( p->pAig, iObj );
+    if ( RetValue )
     {
-        p->nSatUndec++;
-        assert( status == GLUCOSE_UNDEC );
-        Gia_ObjSetFailed( p->pAig, iObj );
-        p->timeSatUndec += Abc_Clock() - clk;
-        RetValue = 2;
+        if ( Gia_ObjProved(p->pAig, iObj) )
+            pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+        return 0;
     }
-    if ( p->pPars->fUseCones )
-        return RetValue;
-    clk = Abc_Clock();
-    bmcg_sat_solver_reset( p->pSat );
-    p->timeExtra += Abc_Clock() - clk;
-//    satoko_stats(p->pSat)->n_conflicts = 0;
-    return RetValue;
+    pObj->Value = ~0;
+    Vec_IntPushThree( p->vCexTriples, Gia_ObjId(p->pAig, pRepr), iObj, Abc_Var2Lit(p->pAig->iPatsPi, pObj->fPhase ^ pRepr->fPhase) );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the batch of candidate pairs using several threads.]
+
+  Description [The pairs are distributed dynamically among the solving
+  managers of the threads. The results are applied in the order of the
+  batch, so the outcome is the same as when the pairs are solved one by 
+  one. Returns 1 if at least one pair is disproved.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec3_ManSweepWorkerTask( void * pArg )
+{
+    Cec3_Task_t * pTask = (Cec3_Task_t *)pArg;
+    Cec3_Man_t * p = pTask->pMan;
+    int status = Cec3_ManSweepNodeSolve( pTask->pWorker, Vec_IntEntry(p->vBatch, pTask->iEntry), Vec_WecEntry(p->vCexes, pTask->iEntry) );
+    Vec_IntWriteEntry( p->vStatus, pTask->iEntry, status );
+}
+int Cec3_ManSweepBatch( Cec3_Man_t * p )
+{
+    Cec3_Task_t Tasks[CEC3_PROC_MAX], * pTask;
+    Util_Job_t * pJob;
+    int i, iObj, iNext = 0, fDisproved = 0;
+    if ( Vec_IntSize(p->vBatch) == 0 )
+        return 0;
+    assert( Vec_IntSize(p->vBatch) <= Vec_WecSize(p->vCexes) );
+    Vec_IntFill( p->vStatus, Vec_IntSize(p->vBatch), GLUCOSE_UNDEC );
+    pJob = Util_JobStart( Util_PoolGlobal() );
+    for ( i = 0; i < p->pPars->nProcs && iNext < Vec_IntSize(p->vBatch); i++ )
+    {
+        Tasks[i].pMan    = p;
+        Tasks[i].pWorker = p->pWorkers[i];
+        Tasks[i].iEntry  = iNext++;
+        Util_JobSubmit( pJob, Cec3_ManSweepWorkerTask, Tasks + i );
+    }
+    while ( (pTask = (Cec3_Task_t *)Util_JobWaitNext(pJob)) )
+        if ( iNext < Vec_IntSize(p->vBatch) )
+        {
+            pTask->iEntry = iNext++;
+            Util_JobSubmit( pJob, Cec3_ManSweepWorkerTask, pTask );
+        }
+    Util_JobStop( pJob );
+    // apply the results in the original order
+    Vec_IntForEachEntry( p->vBatch, iObj, i )
+    {
+        Vec_Int_t * vCex = Vec_WecEntry( p->vCexes, i );
+        int RetValue = Cec3_ManSweepNodeApply( p, iObj, Vec_IntEntry(p->vStatus, i), vCex );
+        fDisproved |= Cec3_ManSweepNodeFinish( p, iObj, RetValue );
+        Gia_ManObj( p->pAig, iObj )->fMark1 = 0;
+    }
+    Vec_IntClear( p->vBatch );
+    return fDisproved;
 }
 void Cec3_ManPrintStats( Gia_Man_t * p, Cec3_Par_t * pPars, Cec3_Man_t * pMan )
 {
@@ -915,7 +1117,7 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
 {
     Cec3_Man_t * pMan = Cec3_ManCreate( p, pPars ); 
     Gia_Obj_t * pObj, * pRepr, * pObjNew; 
-    int i, Iter, fDisproved = 1;
+    int i, Iter, nObjsNew, fDisproved = 1;
 
     // check if any output trivially fails under all-0 pattern
     Gia_ManRandomW( 1 );
@@ -960,20 +1162,22 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
         {
             if ( ~pObj->Value || Gia_ObjFailed(p, i) ) // skip swept nodes and failed nodes
                 continue;
+            pRepr = Gia_ObjReprObj( p, i );
+            // the fanins (or the representative) are still being solved
+            if ( pMan->pWorkers && (Gia_ObjFanin0(pObj)->fMark1 || Gia_ObjFanin1(pObj)->fMark1 || (pRepr && pRepr->fMark1)) )
+                fDisproved |= Cec3_ManSweepBatch( pMan );
             if ( !~Gia_ObjFanin0(pObj)->Value || !~Gia_ObjFanin1(pObj)->Value ) // skip fanouts of non-swept nodes
                 continue;
             assert( !Gia_ObjProved(p, i) && !Gia_ObjFailed(p, i) );
             // duplicate the node
+            nObjsNew = Gia_ManObjNum( pMan->pNew );
             pObj->Value = Gia_ManHashAnd( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
-            if ( Vec_IntSize(&pMan->pNew->vCopies2) == Abc_Lit2Var(pObj->Value) )
+            if ( nObjsNew < Gia_ManObjNum(pMan->pNew) )
             {
                 pObjNew = Gia_ManObj( pMan->pNew, Abc_Lit2Var(pObj->Value) );
                 pObjNew->fMark0 = Gia_ObjIsMuxType( pObjNew );
                 Gia_ObjSetPhase( pMan->pNew, pObjNew );
-                Vec_IntPush( &pMan->pNew->vCopies2, -1 );
             }
-            assert( Vec_IntSize(&pMan->pNew->vCopies2) == Gia_ManObjNum(pMan->pNew) );
-            pRepr = Gia_ObjReprObj( p, i );
             if ( pRepr == NULL || !~pRepr->Value )
                 continue;
             if ( Abc_Lit2Var(pObj->Value) == Abc_Lit2Var(pRepr->Value) )
@@ -982,16 +1186,19 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
                 Gia_ObjSetProved( p, i );
                 continue;
             }
-            if ( Cec3_ManSweepNode(pMan, i) )
+            if ( pMan->pWorkers )
             {
-                if ( Gia_ObjProved(p, i) )
-                    pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+                // postpone solving until the batch is full
+                pObj->fMark1 = 1;
+                Vec_IntPush( pMan->vBatch, i );
+                if ( Vec_IntSize(pMan->vBatch) == Vec_WecSize(pMan->vCexes) )
+                    fDisproved |= Cec3_ManSweepBatch( pMan );
                 continue;
             }
-            pObj->Value = ~0;
-            Vec_IntPushThree( pMan->vCexTriples, Gia_ObjId(p, pRepr), i, Abc_Var2Lit(p->iPatsPi, pObj->fPhase ^ pRepr->fPhase) );
-            fDisproved = 1;
+            fDisproved |= Cec3_ManSweepNodeFinish( pMan, i, Cec3_ManSweepNode(pMan, i) );
         }
+        if ( pMan->pWorkers )
+            fDisproved |= Cec3_ManSweepBatch( pMan );
         if ( fDisproved )
         {
             int Fails = Cec3_ManSimulate( p, pMan->vCexTriples, pMan );
@@ -1030,7 +1237,9 @@ Gia_Man_t * Cec3_ManSimulateTest( Gia_Man_t * p, Cec_ParFra_t * pPars0 )
 //    pPars->nSimRounds = pPars0->nRounds;    // simulation rounds
 //    pPars->nItersMax  = pPars0->nItersMax;  // max number of iterations
     pPars->nConfLimit = pPars0->nBTLimit;   // conflict limit at a node
+    pPars->SolverType = pPars0->SolverType; // SAT solver
     pPars->fUseCones  = pPars0->fUseCones;
+    pPars->nProcs     = Abc_MinInt( pPars0->nProcs, CEC3_PROC_MAX );
     pPars->fVerbose   = pPars0->fVerbose;
 //    Gia_ManComputeGiaEquivs( p, 100000, 0 );
 //    Gia_ManEquivPrintClasses( p, 1, 0 );
@@ -24,6 +24,7 @@
 #include "sat/cnf/cnf.h"
 #include "sat/bsat/satSolver.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilPool.h"
 //#include "bdd/cudd/cuddInt.h"
 
 #ifdef ABC_USE_PTHREADS
@@ -528,7 +529,64 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Data structures of the parallel split prover.]
+
+  Description [Each node of the cofactoring tree is a subproblem solved
+  as one task of the shared thread pool. The worker derives the CNF, runs
+  the SAT solver and, if the subproblem is undecided, chooses the splitting
+  variable and derives both cofactors. The manager thread only schedules
+  the subproblems and sleeps while the workers are busy.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cec_SplitMan_t_ Cec_SplitMan_t;
+struct Cec_SplitMan_t_
+{
+    Util_Pool_t *    pPool;      // the thread pool
+    pthread_mutex_t  Mutex;      // protects the CNF manager, which is shared
+    int              nTimeOut;   // the runtime limit per subproblem (in seconds)
+    int              LookAhead;  // the look-ahead used to choose the splitting variable
+};
+typedef struct Cec_SplitProb_t_ Cec_SplitProb_t;
+struct Cec_SplitProb_t_
+{
+    Cec_SplitMan_t * pMan;       // the manager
+    Gia_Man_t *      p;          // the subproblem
+    Gia_Man_t *      pCofs[2];   // the cofactors if the subproblem is undecided
+    int              Id;         // the number of this subproblem
+    int              Parent;     // the number of the parent subproblem (-1 for the root)
+    int              Depth;      // the number of cofactored variables
+    int              iWorker;    // the worker that solved the subproblem
+    int              Result;     // 0 = SAT; 1 = UNSAT; -1 = UNDECIDED
+    int              nVars;      // the number of SAT variables
+    int              nConfs;     // the number of conflicts
+    int              iVar;       // the splitting variable
+    int              nFanouts;   // the number of its fanouts
+    int              Cost;       // the cost of splitting
+    abctime          clkCnf;     // the runtime to derive the CNF
+    abctime          clkSat;     // the runtime of the SAT solver
+    abctime          clkSplit;   // the runtime to derive the cofactors
+};
+
+// returns wall-clock time (Abc_Clock() measures the time of the calling thread)
+static inline abctime Cec_GiaSplitClock()
+{
+#if (defined(LIN) || defined(LIN64)) && !(__APPLE__ & __MACH__) && !defined(__MINGW32__)
+    struct timespec ts;
+    if ( clock_gettime(CLOCK_MONOTONIC, &ts) < 0 ) 
+        return (abctime)-1;
+    return ((abctime)ts.tv_sec) * CLOCKS_PER_SEC + (((abctime)ts.tv_nsec) * CLOCKS_PER_SEC) / 1000000000;
+#else
+    return Abc_Clock();
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates and deletes one subproblem.]
 
   Description []
                
@@ -537,48 +595,176 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
   SeeAlso     []
 
 ***********************************************************************/
-#define PAR_THR_MAX 100
-typedef struct Par_ThData_t_
+Cec_SplitProb_t * Cec_GiaSplitProbAlloc( Cec_SplitMan_t * pMan, Vec_Ptr_t * vProbs, Gia_Man_t * p, int Parent )
+{
+    Cec_SplitProb_t * pProb = ABC_CALLOC( Cec_SplitProb_t, 1 );
+    pProb->pMan    = pMan;
+    pProb->p       = p;
+    pProb->Id      = Vec_PtrSize( vProbs );
+    pProb->Parent  = Parent;
+    pProb->Depth   = p->vCofVars ? Vec_IntSize(p->vCofVars) : 0;
+    pProb->iWorker = -1;
+    pProb->Result  = -2;
+    pProb->iVar    = -1;
+    Vec_PtrPush( vProbs, pProb );
+    return pProb;
+}
+void Cec_GiaSplitProbFree( Cec_SplitProb_t * pProb )
+{
+    Gia_ManStopP( &pProb->p );
+    Gia_ManStopP( &pProb->pCofs[0] );
+    Gia_ManStopP( &pProb->pCofs[1] );
+    ABC_FREE( pProb );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one subproblem and splits it if it is undecided.]
+
+  Description [This procedure is executed by a worker of the thread pool.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_GiaSplitSolveTask( void * pArg )
 {
-    Gia_Man_t * p;
+    Cec_SplitProb_t * pProb = (Cec_SplitProb_t *)pArg;
+    Cec_SplitMan_t * pMan = pProb->pMan;
     Cnf_Dat_t * pCnf;
-    int         iThread;
-    int         nTimeOut;
-    int         fWorking;
-    int         Result;
-    int         nVars;
-    int         nConfs;
-} Par_ThData_t;
-void * Cec_GiaSplitWorkerThread( void * pArg )
+    abctime clk = Abc_Clock();
+    int c;
+    pProb->iWorker = Util_PoolWorkerId( pMan->pPool );
+    // derive CNF
+    pthread_mutex_lock( &pMan->Mutex );
+    pCnf = Cec_GiaDeriveGiaRemapped( pProb->p );
+    pthread_mutex_unlock( &pMan->Mutex );
+    pProb->clkCnf = Abc_Clock() - clk;
+    // solve the problem
+    clk = Abc_Clock();
+    pProb->Result = Cnf_GiaSolveOne( pProb->p, pCnf, pMan->nTimeOut, &pProb->nVars, &pProb->nConfs );
+    pProb->clkSat = Abc_Clock() - clk;
+    Cnf_DataFree( pCnf );
+    if ( pProb->Result != -1 )
+        return;
+    // determine cofactoring variable
+    clk = Abc_Clock();
+    pProb->iVar = Gia_SplitCofVar( pProb->p, pMan->LookAhead, &pProb->nFanouts, &pProb->Cost );
+    // derive the cofactors
+    for ( c = 0; c < 2; c++ )
+    {
+        Gia_Man_t * pPart = Gia_ManDupCofactorVar( pProb->p, pProb->iVar, c );
+        pPart->vCofVars = Vec_IntAlloc( pProb->Depth + 1 );
+        if ( pProb->p->vCofVars )
+            Vec_IntAppend( pPart->vCofVars, pProb->p->vCofVars );
+        Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(pProb->iVar, !c) );
+        pProb->pCofs[c] = pPart;
+    }
+    pProb->clkSplit = Abc_Clock() - clk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics of the subproblems.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_GiaSplitPrintProb( Cec_SplitProb_t * pProb, double Prog, abctime clk )
 {
-    Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
-    while ( 1 )
+    printf( "%4d : ",             pProb->Id );
+    printf( "Parent =%4d  ",      pProb->Parent );
+    printf( "Depth =%3d  ",       pProb->Depth );
+    printf( "And =%7d  ",         Gia_ManAndNum(pProb->p) );
+    printf( "SatVar =%7d  ",      pProb->nVars );
+    printf( "SatConf =%7d   ",    pProb->nConfs );
+    printf( "%s   ",              pProb->Result ? (pProb->Result == 1 ? "UNSAT    " : "UNDECIDED") : "SAT      " );
+    printf( "Worker =%3d  ",      pProb->iWorker );
+    printf( "Solved %8.4f %%   ", 100*Prog );
+    Abc_PrintTime( 1, "Time", clk );
+    fflush( stdout );
+}
+void Cec_GiaSplitPrintStats( Vec_Ptr_t * vProbs, int nWorkers, abctime clkTotal )
+{
+    Cec_SplitProb_t * pProb;
+    abctime * pClkWorker = ABC_CALLOC( abctime, nWorkers + 1 );
+    int * pProbWorker = ABC_CALLOC( int, nWorkers + 1 );
+    int i, d, Depth = 0, nCounts[3] = {0};
+    Vec_PtrForEachEntry( Cec_SplitProb_t *, vProbs, pProb, i )
+        Depth = Abc_MaxInt( Depth, pProb->Depth );
+    printf( "Depth  Problems       SAT     UNSAT     UNDEC  Unsolved      Conflicts    Cnf(s)    Sat(s)  Split(s)\n" );
+    for ( d = 0; d <= Depth; d++ )
     {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->p == NULL )
+        int nProbs = 0, nRes[4] = {0};
+        word nConfs = 0;
+        abctime clkCnf = 0, clkSat = 0, clkSplit = 0;
+        Vec_PtrForEachEntry( Cec_SplitProb_t *, vProbs, pProb, i )
         {
-	        pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
+            if ( pProb->Depth != d )
+                continue;
+            nProbs++;
+            nRes[pProb->Result + 2]++;
+            nConfs   += pProb->nConfs;
+            clkCnf   += pProb->clkCnf;
+            clkSat   += pProb->clkSat;
+            clkSplit += pProb->clkSplit;
         }
-        pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, &pThData->nVars, &pThData->nConfs );
-        pThData->fWorking = 0;
+        printf( "%5d  %8d  %8d  %8d  %8d  %8d  %13.0f  %8.2f  %8.2f  %8.2f\n", d, nProbs, nRes[2], nRes[3], nRes[1], nRes[0], (double)nConfs, 
+            1.0*clkCnf/CLOCKS_PER_SEC, 1.0*clkSat/CLOCKS_PER_SEC, 1.0*clkSplit/CLOCKS_PER_SEC );
+    }
+    Vec_PtrForEachEntry( Cec_SplitProb_t *, vProbs, pProb, i )
+    {
+        if ( pProb->Result == -2 )
+            continue;
+        nCounts[pProb->Result + 1]++;
+        pProbWorker[pProb->iWorker + 1]++;
+        pClkWorker[pProb->iWorker + 1] += pProb->clkCnf + pProb->clkSat + pProb->clkSplit;
+    }
+    printf( "Solved %d subproblems (SAT = %d  UNSAT = %d  UNDEC = %d) using %d workers.  ", 
+        nCounts[0] + nCounts[1] + nCounts[2], nCounts[1], nCounts[2], nCounts[0], nWorkers );
+    Abc_PrintTime( 1, "Wall time", clkTotal );
+    for ( i = 0; i <= nWorkers; i++ )
+    {
+        if ( pProbWorker[i] == 0 )
+            continue;
+        if ( i == 0 )
+            printf( "Manager   : " );
+        else
+            printf( "Worker %2d : ", i - 1 );
+        printf( "Problems = %6d  Busy = %6.2f %%  ", pProbWorker[i], clkTotal ? 100.0 * pClkWorker[i] / clkTotal : 0.0 );
+        Abc_PrintTime( 1, "Time", pClkWorker[i] );
     }
-	assert( 0 );
-	return NULL;
+    ABC_FREE( pClkWorker );
+    ABC_FREE( pProbWorker );
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem by cofactoring using several threads.]
+
+  Description [Keeps at most nProcs subproblems in the thread pool. When
+  a subproblem is undecided, its cofactors are scheduled as soon as some
+  subproblem is finished, in the depth-first order.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
 {
-    abctime clkTotal = Abc_Clock();
-    Par_ThData_t ThData[PAR_THR_MAX];
-	pthread_t WorkerThread[PAR_THR_MAX];
-    Vec_Ptr_t * vStack;
-    Cnf_Dat_t * pCnf;
+    abctime clkTotal = Cec_GiaSplitClock();
+    Cec_SplitMan_t Man, * pMan = &Man;
+    Cec_SplitProb_t * pProb;
+    Util_Job_t * pJob;
+    Vec_Ptr_t * vStack, * vProbs;
     double Progress = 0;
-    int i, status, nSatVars, nSatConfs;
-    int nIter = 0, RetValue = -1, fWorkToDo = 1;
+    int i, nRunning = 0, nIter = 0, RetValue = -1;
     Abc_CexFreeP( &p->pCexComb );
     if ( fVerbose )
         printf( "Solving CEC problem by cofactoring with the following parameters:\n" );
@@ -587,152 +773,86 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
     fflush( stdout );
     if ( nProcs == 1 )
         return Cec_GiaSplitTest2( p, nProcs, nTimeOut, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
-    // subtract manager thread
-    nProcs--;
-    assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
-    // check the problem
-    pCnf = Cec_GiaDeriveGiaRemapped( p );
-    status = Cnf_GiaSolveOne( p, pCnf, nTimeOut, &nSatVars, &nSatConfs );
-    Cnf_DataFree( pCnf );
-    if ( fVerbose && status != -1 )
-        Cec_GiaSplitPrint( 0, 0, nSatVars, nSatConfs, status, Progress, Abc_Clock() - clkTotal );
-    if ( status == 0 )
-    {
-		if ( !fSilent )
-        printf( "The problem is SAT without cofactoring.\n" );
-        return 0;
-    }
-    if ( status == 1 )
-    {
-		if ( !fSilent )
-        printf( "The problem is UNSAT without cofactoring.\n" );
-        return 1;
-    }
-    assert( status == -1 );
-    // create local copy
+    assert( nProcs > 1 );
+    // start the manager
+    pMan->pPool     = Util_PoolGlobal();
+    pMan->nTimeOut  = nTimeOut;
+    pMan->LookAhead = LookAhead;
+    pthread_mutex_init( &pMan->Mutex, NULL );
+    // the root subproblem is solved by the pool, too
+    vProbs = Vec_PtrAlloc( 1000 );
     vStack = Vec_PtrAlloc( 1000 );
-    Vec_PtrPush( vStack, Gia_ManDup(p) );
-    // start threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        ThData[i].p        = NULL;
-        ThData[i].pCnf     = NULL;
-        ThData[i].iThread  = i;
-        ThData[i].nTimeOut = nTimeOut;
-        ThData[i].fWorking = 0;
-        ThData[i].Result   = -1;
-        ThData[i].nVars    = -1;
-        ThData[i].nConfs   = -1;
-        status = pthread_create( WorkerThread + i, NULL,Cec_GiaSplitWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
-    }
-    // look at the threads
-    while ( fWorkToDo )
+    Vec_PtrPush( vStack, Cec_GiaSplitProbAlloc(pMan, vProbs, Gia_ManDup(p), -1) );
+    pJob = Util_JobStart( pMan->pPool );
+    while ( 1 )
     {
-        fWorkToDo = (int)(Vec_PtrSize(vStack) > 0);
-        for ( i = 0; i < nProcs; i++ )
+        // schedule pending subproblems while there are free slots
+        while ( nRunning < nProcs && Vec_PtrSize(vStack) > 0 )
         {
-            // check if this thread is working
-            if ( ThData[i].fWorking )
-            {
-                fWorkToDo = 1;
-                continue;
-            }
-            // check if this thread has recently finished
-            if ( ThData[i].p != NULL )
-            {
-                Gia_Man_t * pLast = ThData[i].p;
-                int Depth = pLast->vCofVars ? Vec_IntSize(pLast->vCofVars) : 0;
-                if ( pLast->vCofVars == NULL )
-                    pLast->vCofVars = Vec_IntAlloc( 100 );
-                if ( fVerbose )
-                    Cec_GiaSplitPrint( i+1, Depth, ThData[i].nVars, ThData[i].nConfs, ThData[i].Result, Progress, Abc_Clock() - clkTotal );
-                if ( ThData[i].Result == 0 ) // SAT
-                {
-                    p->pCexComb = pLast->pCexComb;  pLast->pCexComb = NULL;
-                    RetValue = 0;
-                    goto finish;
-                }
-                if ( ThData[i].Result == -1 ) // UNDEC
-                {
-                    // determine cofactoring variable
-                    int nFanouts, Cost, iVar = Gia_SplitCofVar( pLast, LookAhead, &nFanouts, &Cost );
-                    // cofactor
-                    Gia_Man_t * pPart = Gia_ManDupCofactorVar( pLast, iVar, 0 );
-                    pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
-                    Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
-                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
-                    Vec_PtrPush( vStack, pPart );
-                    // print results
-                    if ( fVeryVerbose )
-                    {
-//                        Cec_GiaSplitPrintRefs( pLast );
-                        printf( "Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.  AndAfter = %6d.\n", 
-                            iVar, nFanouts, Cost, Gia_ManAndNum(pLast), Gia_ManAndNum(pPart) );
-//                        Cec_GiaSplitPrintRefs( pPart );
-                    }
-                    // cofactor
-                    pPart = Gia_ManDupCofactorVar( pLast, iVar, 1 );
-                    pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
-                    Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
-                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
-                    Vec_PtrPush( vStack, pPart );
-                    // keep working
-                    fWorkToDo = 1;
-                    nIter++;
-                }
-                else
-                    Progress += 1.0 / pow(2, Depth);
-                Gia_ManStopP( &ThData[i].p );
-                if ( ThData[i].pCnf == NULL )
-                    continue;
-                Cnf_DataFree( ThData[i].pCnf );
-                ThData[i].pCnf = NULL;
-            }
-            if ( Vec_PtrSize(vStack) == 0 )
-                continue;
-            // start a new thread
-            assert( ThData[i].p == NULL );
-            ThData[i].p = (Gia_Man_t*)Vec_PtrPop( vStack );
-            ThData[i].pCnf = Cec_GiaDeriveGiaRemapped( ThData[i].p );
-            ThData[i].fWorking = 1;
+            Util_JobSubmit( pJob, Cec_GiaSplitSolveTask, Vec_PtrPop(vStack) );
+            nRunning++;
+        }
+        if ( nRunning == 0 ) // all subproblems are UNSAT
+        {
+            RetValue = 1;
+            break;
+        }
+        // block until one of the subproblems is solved
+        pProb = (Cec_SplitProb_t *)Util_JobWaitNext( pJob );
+        nRunning--;
+        if ( pProb->Result == 1 )
+            Progress += 1.0 / pow(2, pProb->Depth);
+        if ( fVerbose )
+            Cec_GiaSplitPrintProb( pProb, Progress, Cec_GiaSplitClock() - clkTotal );
+        if ( pProb->Result == 0 ) // SAT
+        {
+            p->pCexComb = pProb->p->pCexComb;  pProb->p->pCexComb = NULL;
+            RetValue = 0;
+            break;
+        }
+        if ( pProb->Result == -1 ) // UNDEC
+        {
+            if ( fVeryVerbose )
+                printf( "Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.  AndAfter = %6d.\n", 
+                    pProb->iVar, pProb->nFanouts, pProb->Cost, Gia_ManAndNum(pProb->p), Gia_ManAndNum(pProb->pCofs[0]) );
+            // the cofactor with the negative literal is solved first
+            Vec_PtrPush( vStack, Cec_GiaSplitProbAlloc(pMan, vProbs, pProb->pCofs[1], pProb->Id) );
+            Vec_PtrPush( vStack, Cec_GiaSplitProbAlloc(pMan, vProbs, pProb->pCofs[0], pProb->Id) );
+            pProb->pCofs[0] = pProb->pCofs[1] = NULL;
+            nIter++;
         }
+        // keep the statistics but release the AIG
+        Gia_ManStopP( &pProb->p );
         if ( nIterMax && nIter >= nIterMax )
             break;
     }
-    if ( !fWorkToDo )
-        RetValue = 1;
-finish:
-    // wait till threads finish
-    for ( i = 0; i < nProcs; i++ )
-        if ( ThData[i].fWorking )
-            i = 0;
-    // stop threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        assert( !ThData[i].fWorking );
-        // cleanup
-        Gia_ManStopP( &ThData[i].p );
-        if ( ThData[i].pCnf == NULL )
-            continue;
-        Cnf_DataFree( ThData[i].pCnf );
-        ThData[i].pCnf = NULL;
-        // stop
-        ThData[i].p = NULL;
-        ThData[i].fWorking = 1;
-    }
+    // wait till the running subproblems are finished
+    Util_JobStop( pJob );
+    clkTotal = Cec_GiaSplitClock() - clkTotal;
+    if ( fVerbose )
+        Cec_GiaSplitPrintStats( vProbs, Util_PoolSize(pMan->pPool), clkTotal );
+    Vec_PtrForEachEntry( Cec_SplitProb_t *, vProbs, pProb, i )
+        Cec_GiaSplitProbFree( pProb );
+    Vec_PtrFree( vProbs );
+    Vec_PtrFree( vStack );
+    pthread_mutex_destroy( &pMan->Mutex );
     // finish
-    Cec_GiaSplitClean( vStack );
 	if ( !fSilent )
 	{
-		if ( RetValue == 0 )
-			printf( "Problem is SAT " );
-		else if ( RetValue == 1 )
-			printf( "Problem is UNSAT " );
-		else if ( RetValue == -1 )
-			printf( "Problem is UNDECIDED " );
-		else assert( 0 );
-		printf( "after %d case-splits.  ", nIter );
-		Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+		if ( nIter == 0 && RetValue != -1 )
+			printf( "The problem is %s without cofactoring.\n", RetValue ? "UNSAT" : "SAT" );
+		else
+		{
+			if ( RetValue == 0 )
+				printf( "Problem is SAT " );
+			else if ( RetValue == 1 )
+				printf( "Problem is UNSAT " );
+			else if ( RetValue == -1 )
+				printf( "Problem is UNDECIDED " );
+			else assert( 0 );
+			printf( "after %d case-splits.  ", nIter );
+			Abc_PrintTime( 1, "Time", clkTotal );
+		}
 		fflush( stdout );
 	}
     return RetValue;
@@ -750,7 +870,6 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
         if ( fVerbose )
             printf( "\nSolving output %d:\n", i );
         RetValue1 = Cec_GiaSplitTestInt( pOne, nProcs, nTimeOut, nIterMax, LookAhead,  fVerbose, fVeryVerbose, fSilent );
-        Gia_ManStop( pOne );
         // collect the result
         if ( RetValue1 == 0 && RetValue == -1 )
         {
@@ -758,6 +877,7 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
             pCex->iPo = i;
             RetValue = 0;
         }
+        Gia_ManStop( pOne );
         if ( RetValue1 == -1 )
             fOneUndef = 1;
     }
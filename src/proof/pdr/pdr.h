@@ -52,6 +52,7 @@ struct Pdr_Par_t_
     int nRandomSeed;      // value to seed the SAT solver with
     int fTwoRounds;       // use two rounds for generalization
     int fMonoCnf;         // monolythic CNF
+    int fShareSat;        // one SAT solver shared by all timeframes
     int fNewXSim;         // updated X-valued simulation
     int fFlopPrio;        // use structural flop priorities
     int fFlopOrder;       // order flops for 'analyze_final' during generalization
@@ -83,15 +83,22 @@ static inline int Pdr_ObjSatVar2FindOrAdd( Pdr_Man_t * p, int k, Aig_Obj_t * pOb
         assert( iVarNew > 0 );
         Vec_IntPush( vVar2Ids, Aig_ObjId(pObj) );
         Vec_IntWriteEntry( vId2Vars, k, iVarNew << 2 );
-        sat_solver_setnvars( pSat, iVarNew + 1 );
-        if ( k == 0 && Saig_ObjIsLo(p->pAig, pObj) ) // initialize the register output
-        {
-            int Lit = Abc_Var2Lit( iVarNew, 1 );
-            int RetValue = sat_solver_addclause( pSat, &Lit, &Lit + 1 );
+        sat_solver_setnvars( pSat, iVarNew + 1 );
+        if ( p->pPars->fShareSat && Saig_ObjIsLo(p->pAig, pObj) ) // initialize the register output in the first frame
+        {
+            int Lits[2] = { Abc_Var2Lit( iVarNew, 1 ), Abc_Var2Lit( Pdr_ManFrameAct(p, 0), 1 ) };
+            int RetValue = sat_solver_addclause( pSat, Lits, Lits + 2 );
+            assert( RetValue == 1 );
+            (void) RetValue;
+        }
+        else if ( k == 0 && Saig_ObjIsLo(p->pAig, pObj) ) // initialize the register output
+        {
+            int Lit = Abc_Var2Lit( iVarNew, 1 );
+            int RetValue = sat_solver_addclause( pSat, &Lit, &Lit + 1 );
             assert( RetValue == 1 );
-            (void) RetValue;
-            sat_solver_compress( pSat );
-        }
+            (void) RetValue;
+            sat_solver_compress( pSat );
+        }
     }
     return Vec_IntEntry( vId2Vars, k );
 }
@@ -185,7 +192,14 @@ static inline int Pdr_ObjSatVar2FindOrAdd( Pdr_Man_t * p, int k, Aig_Obj_t * pOb
         Vec_IntPush( vVar2Ids, Aig_ObjId(pObj) );
         Vec_IntWriteEntry( vId2Vars, k, iVarNew );
         sat_solver_setnvars( pSat, iVarNew + 1 );
-        if ( k == 0 && Saig_ObjIsLo(p->pAig, pObj) ) // initialize the register output
+        if ( p->pPars->fShareSat && Saig_ObjIsLo(p->pAig, pObj) ) // initialize the register output in the first frame
+        {
+            int Lits[2] = { Abc_Var2Lit( iVarNew, 1 ), Abc_Var2Lit( Pdr_ManFrameAct(p, 0), 1 ) };
+            int RetValue = sat_solver_addclause( pSat, Lits, Lits + 2 );
+            assert( RetValue == 1 );
+            (void) RetValue;
+        }
+        else if ( k == 0 && Saig_ObjIsLo(p->pAig, pObj) ) // initialize the register output
         {
             int Lit = Abc_Var2Lit( iVarNew, 1 );
             int RetValue = sat_solver_addclause( pSat, &Lit, &Lit + 1 );
@@ -240,6 +254,8 @@ int Pdr_ObjSatVar2( Pdr_Man_t * p, int k, Aig_Obj_t * pObj, int Level, int Pol )
 ***********************************************************************/
 int Pdr_ObjSatVar( Pdr_Man_t * p, int k, int Pol, Aig_Obj_t * pObj )
 {
+    if ( p->pPars->fShareSat ) // all timeframes use the same variables
+        k = 0;
     if ( p->pPars->fMonoCnf )
         return Pdr_ObjSatVar1( p, k, pObj );
     else
@@ -311,6 +327,8 @@ static inline int Pdr_ObjRegNum2( Pdr_Man_t * p, int k, int iSatVar )
 ***********************************************************************/
 int Pdr_ObjRegNum( Pdr_Man_t * p, int k, int iSatVar )
 {
+    if ( p->pPars->fShareSat )
+        k = 0;
     if ( p->pPars->fMonoCnf )
         return Pdr_ObjRegNum1( p, k, iSatVar );
     else
@@ -331,6 +349,8 @@ int Pdr_ObjRegNum( Pdr_Man_t * p, int k, int iSatVar )
 ***********************************************************************/
 int Pdr_ManFreeVar( Pdr_Man_t * p, int k )
 {
+    if ( p->pPars->fShareSat )
+        k = 0;
     if ( p->pPars->fMonoCnf )
         return sat_solver_nvars( Pdr_ManSolver(p, k) );
     else
@@ -416,9 +436,9 @@ static inline sat_solver * Pdr_ManNewSolver2( sat_solver * pSat, Pdr_Man_t * p,
     }
     Vec_IntClear( vVar2Ids );
     Vec_IntPush( vVar2Ids, -1 );
-    // start the SAT solver
+    // start the SAT solver (the shared one is rolled back to its variable count, so it does not reserve variables)
 //    pSat = sat_solver_new();
-    sat_solver_setnvars( pSat, 500 );
+    sat_solver_setnvars( pSat, p->pPars->fShareSat ? 1 : 500 );
     sat_solver_set_runtime_limit( pSat, p->timeToStop );
     sat_solver_set_runid( pSat, p->pPars->RunId );
     sat_solver_set_stop_func( pSat, p->pPars->pFuncStop );
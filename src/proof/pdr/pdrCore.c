@@ -61,6 +61,7 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
+    pPars->fShareSat      =       0;  // one SAT solver shared by all timeframes
     pPars->fNewXSim       =       0;  // updated X-valued simulation
     pPars->fFlopPrio      =       0;  // use structural flop priorities
     pPars->fFlopOrder     =       0;  // order flops for 'analyze_final' during generalization
@@ -389,7 +390,7 @@ int ZPdr_ManDown( Pdr_Man_t * p, int k, Pdr_Set_t ** ppCube, Pdr_Set_t * pPred,
             }
             if (*added == 0)
             {
-                for ( i = 1; i <= k; i++ )
+                for ( i = p->pPars->fShareSat ? k : 1; i <= k; i++ )
                     Pdr_ManSolverAddClause( p, i, pIndCube);
                 *added = 1;
             }
@@ -430,7 +431,7 @@ int ZPdr_ManDown( Pdr_Man_t * p, int k, Pdr_Set_t ** ppCube, Pdr_Set_t * pPred,
             Vec_VecPush( p->vClauses, l, pCubeMin );   // consume ref
             p->nCubes++;
             // add clause
-            for ( i = 1; i <= l; i++ )
+            for ( i = p->pPars->fShareSat ? l : 1; i <= l; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
             Pdr_SetDeref( pPred );
             RetValue = Pdr_ManCheckCube( p, k, *ppCube, &pPred, p->pPars->nConfLimit, 0, 1 );
@@ -737,11 +738,12 @@ int Pdr_ManGeneralize( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppP
         // assume the unminimized cube
         if ( p->pPars->fSimpleGeneral )
         {
-            sat_solver *  pSat = Pdr_ManFetchSolver( p, k );
-            Vec_Int_t * vLits1 = Pdr_ManCubeToLits( p, k, pCubeMin, 1, 0 );
-            int RetValue1 = sat_solver_addclause( pSat, Vec_IntArray(vLits1), Vec_IntArray(vLits1) + Vec_IntSize(vLits1) );
+            Vec_Int_t * vLits1;
+            int RetValue1;
+            Pdr_ManFetchSolver( p, k );
+            vLits1 = Pdr_ManCubeToLits( p, k, pCubeMin, 1, 0 );
+            RetValue1 = Pdr_ManAddClauseFrame( p, k, vLits1 );
             assert( RetValue1 == 1 );
-            sat_solver_compress( pSat );
         }
 
         // sort literals by their occurences
@@ -819,11 +821,12 @@ int Pdr_ManGeneralize( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppP
             // assume the minimized cube
             if ( p->pPars->fSimpleGeneral )
             {
-                sat_solver *  pSat = Pdr_ManFetchSolver( p, k );
-                Vec_Int_t * vLits1 = Pdr_ManCubeToLits( p, k, pCubeMin, 1, 0 );
-                int RetValue1 = sat_solver_addclause( pSat, Vec_IntArray(vLits1), Vec_IntArray(vLits1) + Vec_IntSize(vLits1) );
+                Vec_Int_t * vLits1;
+                int RetValue1;
+                Pdr_ManFetchSolver( p, k );
+                vLits1 = Pdr_ManCubeToLits( p, k, pCubeMin, 1, 0 );
+                RetValue1 = Pdr_ManAddClauseFrame( p, k, vLits1 );
                 assert( RetValue1 == 1 );
-                sat_solver_compress( pSat );
             }
 
             // get the ordering by decreasing priority
@@ -987,8 +990,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             }
             Vec_VecPush( p->vClauses, k, pCubeMin );   // consume ref
             p->nCubes++;
-            // add clause
-            for ( i = 1; i <= k; i++ )
+            // add clause (the shared solver activates lower frames through the chain)
+            for ( i = p->pPars->fShareSat ? k : 1; i <= k; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
             // schedule proof obligation
             if ( (k < kMax || p->pPars->fReuseProofOblig) && !p->pPars->fShortest )
@@ -1406,8 +1409,9 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->nFrameMax,
             pPars->nRestLimit,
             pPars->nTimeOut );
-        Abc_Print( 1, "MonoCNF = %s. SkipGen = %s. SolveAll = %s.\n",
+        Abc_Print( 1, "MonoCNF = %s. ShareSAT = %s. SkipGen = %s. SolveAll = %s.\n",
             pPars->fMonoCnf ?     "yes" : "no",
+            pPars->fShareSat ?    "yes" : "no",
             pPars->fSkipGeneral ? "yes" : "no",
             pPars->fSolveAll ?    "yes" : "no" );
     }
@@ -56,6 +56,9 @@
     #define sat_solver_set_runid             satoko_set_runid           
     #define sat_solver_set_stop_func         satoko_set_stop_func          
     #define sat_solver_compress(s)             
+    #define sat_solver_simplify              satoko_simplify
+    #define sat_solver_bookmark              satoko_bookmark
+    #define sat_solver_rollback              satoko_rollback
 #endif
 
 ABC_NAMESPACE_HEADER_START
@@ -117,6 +120,8 @@ struct Pdr_Man_t_
     Pdr_Obl_t * pQueue;    // proof obligations
     int *       pOrder;    // ordering of the lits
     Vec_Int_t * vActVars;  // the counter of activation variables
+    Vec_Int_t * vFrameActs;// activation variables of timeframes in the shared solver
+    int         nVarsBook; // the number of variables bookmarked in the shared solver
     int         iUseFrame; // the first used frame
     int         nAbsFlops; // the number of flops used
     Vec_Int_t * vAbsFlops; // flops currently used
@@ -191,6 +196,27 @@ static inline abctime      Pdr_ManTimeLimit( Pdr_Man_t * p )
     return p->timeToStopOne;
 }
 
+// with the shared solver, clauses of the k-th timeframe are conditioned on its activation variable;
+// frame activation variables form a chain (a_k => a_k+1), so that assuming a_k enables the frames above
+static inline int          Pdr_ManFrameAct( Pdr_Man_t * p, int k )  { return Vec_IntEntry(p->vFrameActs, k); }
+static inline void         Pdr_ManAssumeFrame( Pdr_Man_t * p, int k, Vec_Int_t * vLits )
+{
+    if ( p->pPars->fShareSat )
+        Vec_IntPush( vLits, Abc_Var2Lit(Pdr_ManFrameAct(p, k), 0) );
+}
+static inline int          Pdr_ManAddClauseFrame( Pdr_Man_t * p, int k, Vec_Int_t * vLits )
+{
+    sat_solver * pSat = Pdr_ManSolver(p, k);
+    int RetValue;
+    if ( p->pPars->fShareSat )
+        Vec_IntPush( vLits, Abc_Var2Lit(Pdr_ManFrameAct(p, k), 1) );
+    RetValue = sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits) );
+    if ( p->pPars->fShareSat )
+        Vec_IntPop( vLits );
+    sat_solver_compress( pSat );
+    return RetValue;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -517,14 +517,14 @@ void Pdr_ManVerifyInvariant( Pdr_Man_t * p )
     Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
     {
         vLits = Pdr_ManCubeToLits( p, kThis, pCube, 1, 0 );
-        RetValue = sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits) );
+        RetValue = Pdr_ManAddClauseFrame( p, kThis, vLits );
         assert( RetValue );
-        sat_solver_compress( pSat );
     }
     // check each clause
     Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
     {
         vLits = Pdr_ManCubeToLits( p, kThis, pCube, 0, 1 );
+        Pdr_ManAssumeFrame( p, kThis, vLits );
         RetValue = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits), 0, 0, 0, 0 );
         if ( RetValue != l_False )
         {
@@ -569,9 +569,8 @@ int Pdr_ManDeriveMarkNonInductive( Pdr_Man_t * p, Vec_Ptr_t * vCubes )
         if ( pCube->nRefs == -1 ) // skip non-inductive
             continue;
         vLits = Pdr_ManCubeToLits( p, kThis, pCube, 1, 0 );
-        RetValue = sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits) );
+        RetValue = Pdr_ManAddClauseFrame( p, kThis, vLits );
         assert( RetValue );
-        sat_solver_compress( pSat );
     }
     // check each clause
     Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
@@ -579,6 +578,7 @@ int Pdr_ManDeriveMarkNonInductive( Pdr_Man_t * p, Vec_Ptr_t * vCubes )
         if ( pCube->nRefs == -1 ) // skip non-inductive
             continue;
         vLits = Pdr_ManCubeToLits( p, kThis, pCube, 0, 1 );
+        Pdr_ManAssumeFrame( p, kThis, vLits );
         RetValue = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits), 0, 0, 0, 0 );
         if ( RetValue != l_False ) // mark as non-inductive
         {
@@ -257,6 +257,7 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
     p->pQueue   = NULL;
     p->pOrder   = ABC_ALLOC( int, Aig_ManRegNum(pAig) );
     p->vActVars = Vec_IntAlloc( 256 );
+    p->vFrameActs = Vec_IntAlloc( 256 );
     if ( !p->pPars->fMonoCnf )
         p->vVLits   = Vec_WecStart( 1+Abc_MaxInt(1, Aig_ManLevels(pAig)) );
     // internal use
@@ -339,6 +340,8 @@ void Pdr_ManStop( Pdr_Man_t * p )
         fflush( stdout );
     }
 //    Abc_Print( 1, "SS =%6d. SU =%6d. US =%6d. UU =%6d.\n", p->nCasesSS, p->nCasesSU, p->nCasesUS, p->nCasesUU );
+    if ( p->pPars->fShareSat && Vec_PtrSize(p->vSolvers) > 0 )
+        Vec_PtrShrink( p->vSolvers, 1 ); // the timeframes share one solver
     Vec_PtrForEachEntry( sat_solver *, p->vSolvers, pSat, i )
         sat_solver_delete( pSat );
     Vec_PtrFree( p->vSolvers );
@@ -348,6 +351,7 @@ void Pdr_ManStop( Pdr_Man_t * p )
     Pdr_QueueStop( p );
     ABC_FREE( p->pOrder );
     Vec_IntFree( p->vActVars );
+    Vec_IntFree( p->vFrameActs );
     // static CNF
     Cnf_DataFree( p->pCnf1 );
     Vec_IntFreeP( &p->vVar2Reg );
@@ -31,6 +31,146 @@ ABC_NAMESPACE_IMPL_START
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Adds the activation variable of the k-th timeframe.]
+
+  Description [The variable is chained to the one of the next timeframe.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Pdr_ManStartFrameShared( Pdr_Man_t * p, int k )
+{
+    sat_solver * pSat = Pdr_ManSolver(p, k);
+    int Lits[2], RetValue, iVar = Pdr_ManFreeVar( p, k );
+    sat_solver_setnvars( pSat, iVar + 1 );
+    Vec_IntWriteEntry( p->vFrameActs, k, iVar );
+    if ( k == 0 )
+        return;
+    Lits[0] = Abc_Var2Lit( Pdr_ManFrameAct(p, k-1), 1 );
+    Lits[1] = Abc_Var2Lit( Pdr_ManFrameAct(p, k), 0 );
+    RetValue = sat_solver_addclause( pSat, Lits, Lits + 2 );
+    assert( RetValue == 1 );
+    (void) RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates a timeframe in the SAT solver shared by all timeframes.]
+
+  Description [The first call creates the solver, loads the initial state
+  conditioned on the activation variable of frame 0 and bookmarks the solver.
+  The transition relation is loaded lazily, unless the CNF is monolithic.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static sat_solver * Pdr_ManCreateSolverShared( Pdr_Man_t * p, int k )
+{
+    sat_solver * pSat;
+    Aig_Obj_t * pObj;
+    int i;
+    if ( k == 0 )
+    {
+        pSat = zsat_solver_new_seed(p->pPars->nRandomSeed);
+        pSat = Pdr_ManNewSolver( pSat, p, k, 0 );
+    }
+    else
+        pSat = Pdr_ManSolver(p, 0);
+    Vec_PtrPush( p->vSolvers, pSat );
+    Vec_VecExpand( p->vClauses, k );
+    Vec_IntPush( p->vActVars, 0 );
+    Vec_IntPush( p->vFrameActs, -1 );
+    Pdr_ManStartFrameShared( p, k );
+    if ( k > 0 )
+        return pSat;
+    // the monolithic CNF is loaded at once
+    if ( p->pPars->fMonoCnf )
+    {
+        Saig_ManForEachLo( p->pAig, pObj, i )
+        {
+            int Lits[2] = { Abc_Var2Lit( Pdr_ObjSatVar(p, k, 3, pObj), 1 ), Abc_Var2Lit( Pdr_ManFrameAct(p, k), 1 ) };
+            int RetValue = sat_solver_addclause( pSat, Lits, Lits + 2 );
+            assert( RetValue == 1 );
+            (void) RetValue;
+        }
+    }
+    // add property cone
+    Saig_ManForEachPo( p->pAig, pObj, i )
+        Pdr_ObjSatVar( p, k, 1, pObj );
+    sat_solver_simplify( pSat );
+    sat_solver_bookmark( pSat );
+    p->nVarsBook = sat_solver_nvars( pSat );
+    return pSat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Recycles the SAT solver shared by all timeframes.]
+
+  Description [Rolls back the clauses added after the bookmark, including
+  the learned clauses and the temporary activation variables. The cones of
+  the transition relation loaded since then are reloaded and bookmarked, 
+  so that the next recycling keeps them. Finally, the timeframes and their 
+  clauses are restored.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Pdr_ManRecycleShared( Pdr_Man_t * p )
+{
+    sat_solver * pSat = Pdr_ManSolver(p, 0);
+    Vec_Int_t * vObjs = NULL;
+    Vec_Ptr_t * vArrayK;
+    Pdr_Set_t * pCube;
+    Aig_Obj_t * pObj;
+    int i, k, Entry, kMax = Vec_PtrSize(p->vSolvers) - 1;
+    p->nStarts++;
+    if ( !p->pPars->fMonoCnf )
+    {
+        // unmap the objects whose CNF was loaded after the bookmark
+        Vec_Int_t * vVar2Ids = (Vec_Int_t *)Vec_PtrEntry( &p->vVar2Ids, 0 );
+        assert( Vec_IntSize(vVar2Ids) >= p->nVarsBook );
+        vObjs = Vec_IntAlloc( Vec_IntSize(vVar2Ids) - p->nVarsBook );
+        Vec_IntForEachEntryStart( vVar2Ids, Entry, i, p->nVarsBook )
+        {
+            if ( Entry == -1 )
+                continue;
+            Vec_IntPush( vObjs, Entry );
+            Vec_IntWriteEntry( p->pvId2Vars + Entry, 0, 0 );
+        }
+        Vec_IntShrink( vVar2Ids, p->nVarsBook );
+    }
+    sat_solver_rollback( pSat );
+    assert( sat_solver_nvars(pSat) == p->nVarsBook );
+    if ( vObjs )
+    {
+        // reload these cones and move the bookmark
+        Aig_ManForEachObjVec( vObjs, p->pAig, pObj, i )
+            Pdr_ObjSatVar( p, 0, 3, pObj );
+        Vec_IntFree( vObjs );
+        sat_solver_simplify( pSat );
+        sat_solver_bookmark( pSat );
+        p->nVarsBook = sat_solver_nvars( pSat );
+    }
+    // restore the timeframes
+    for ( k = 1; k <= kMax; k++ )
+        Pdr_ManStartFrameShared( p, k );
+    if ( kMax > 0 )
+        Pdr_ManSetPropertyOutput( p, kMax-1 );
+    Vec_VecForEachLevel( p->vClauses, vArrayK, k )
+        Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCube, i )
+            Pdr_ManSolverAddClause( p, k, pCube );
+    Vec_IntFill( p->vActVars, Vec_IntSize(p->vActVars), 0 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Creates new SAT solver.]
@@ -50,6 +190,8 @@ sat_solver * Pdr_ManCreateSolver( Pdr_Man_t * p, int k )
     assert( Vec_PtrSize(p->vSolvers) == k );
     assert( Vec_VecSize(p->vClauses) == k );
     assert( Vec_IntSize(p->vActVars) == k );
+    if ( p->pPars->fShareSat )
+        return Pdr_ManCreateSolverShared( p, k );
     // create new solver
 //    pSat = sat_solver_new();
     pSat = zsat_solver_new_seed(p->pPars->nRandomSeed);
@@ -81,6 +223,12 @@ sat_solver * Pdr_ManFetchSolver( Pdr_Man_t * p, int k )
     Pdr_Set_t * pCube;
     int i, j;
     pSat = Pdr_ManSolver(p, k);
+    if ( p->pPars->fShareSat ) // the limit is shared by the timeframes
+    {
+        if ( Vec_IntSum(p->vActVars) >= p->pPars->nRecycle * Vec_IntSize(p->vActVars) )
+            Pdr_ManRecycleShared( p );
+        return pSat;
+    }
     if ( Vec_IntEntry(p->vActVars, k) < p->pPars->nRecycle )
         return pSat;
     assert( k < Vec_PtrSize(p->vSolvers) - 1 );
@@ -176,14 +324,12 @@ Vec_Int_t * Pdr_ManCubeToLits( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, int fCom
   SeeAlso     []
 
 ***********************************************************************/
-void Pdr_ManSetPropertyOutput( Pdr_Man_t * p, int k )
-{
-    sat_solver * pSat;
-    Aig_Obj_t * pObj;
+void Pdr_ManSetPropertyOutput( Pdr_Man_t * p, int k )
+{
+    Aig_Obj_t * pObj;
     int Lit, RetValue, i;
     if ( !p->pPars->fUsePropOut )
-        return;
-    pSat = Pdr_ManSolver(p, k);
+        return;
     Saig_ManForEachPo( p->pAig, pObj, i )
     {
         // skip solved outputs
@@ -193,10 +339,10 @@ void Pdr_ManSetPropertyOutput( Pdr_Man_t * p, int k )
         if ( p->pPars->vOutMap && Vec_IntEntry(p->pPars->vOutMap, i) == -1 )
             continue;
         Lit = Abc_Var2Lit( Pdr_ObjSatVar(p, k, 1, pObj), 1 ); // neg literal
-        RetValue = sat_solver_addclause( pSat, &Lit, &Lit + 1 );
+        Vec_IntFill( p->vLits, 1, Lit );
+        RetValue = Pdr_ManAddClauseFrame( p, k, p->vLits );
         assert( RetValue == 1 );
     }
-    sat_solver_compress( pSat );
 }
 
 /**Function*************************************************************
@@ -212,14 +358,12 @@ void Pdr_ManSetPropertyOutput( Pdr_Man_t * p, int k )
 ***********************************************************************/
 void Pdr_ManSolverAddClause( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
 {
-    sat_solver * pSat;
     Vec_Int_t * vLits;
     int RetValue;
-    pSat  = Pdr_ManSolver(p, k);
     vLits = Pdr_ManCubeToLits( p, k, pCube, 1, 0 );
-    RetValue = sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits) );
+    RetValue = Pdr_ManAddClauseFrame( p, k, vLits );
     assert( RetValue == 1 );
-    sat_solver_compress( pSat );
+    (void) RetValue;
 }
 
 /**Function*************************************************************
@@ -267,6 +411,7 @@ int Pdr_ManCheckCubeCs( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
     int RetValue;
     pSat = Pdr_ManFetchSolver( p, k );
     vLits = Pdr_ManCubeToLits( p, k, pCube, 0, 0 );
+    Pdr_ManAssumeFrame( p, k, vLits );
     Limit = sat_solver_set_runtime_limit( pSat, Pdr_ManTimeLimit(p) );
     RetValue = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits), 0, 0, 0, 0 );
     sat_solver_set_runtime_limit( pSat, Limit );
@@ -301,8 +446,11 @@ int Pdr_ManCheckCube( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppPr
     {
         clk = Abc_Clock();
         Lit = Abc_Var2Lit( Pdr_ObjSatVar(p, k, 2, Aig_ManCo(p->pAig, p->iOutCur)), 0 ); // pos literal (property fails)
+        vLits = p->vLits;
+        Vec_IntFill( vLits, 1, Lit );
+        Pdr_ManAssumeFrame( p, k, vLits );
         Limit = sat_solver_set_runtime_limit( pSat, Pdr_ManTimeLimit(p) );
-        RetValue = sat_solver_solve( pSat, &Lit, &Lit + 1, nConfLimit, 0, 0, 0 );
+        RetValue = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits), nConfLimit, 0, 0, 0 );
         sat_solver_set_runtime_limit( pSat, Limit );
         if ( RetValue == l_Undef )
             return -1;
@@ -329,12 +477,20 @@ int Pdr_ManCheckCube( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppPr
         }
         else
             vLits = Pdr_ManCubeToLits( p, k, pCube, 0, 1 );
+        Pdr_ManAssumeFrame( p, k, vLits );
 
         // solve 
         clk = Abc_Clock();
         Limit = sat_solver_set_runtime_limit( pSat, Pdr_ManTimeLimit(p) );
         RetValue = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits), fTryConf ? p->pPars->nConfGenLimit : nConfLimit, 0, 0, 0 );
         sat_solver_set_runtime_limit( pSat, Limit );
+        if ( fLitUsed && p->pPars->fShareSat ) // satisfy the temporary clause, which would be seen by all frames
+        {
+            int RetValue2 = sat_solver_addclause( pSat, &Lit, &Lit + 1 );
+            assert( RetValue2 == 1 );
+            (void) RetValue2;
+            sat_solver_compress( pSat );
+        }
         if ( RetValue == l_Undef )
         {
             if ( fTryConf && p->pPars->nConfGenLimit )
@@ -194,7 +194,7 @@ Pdr_Set_t * Txs3_ManTernarySim( Txs3_Man_t * p, int k, Pdr_Set_t * pCube )
     Pdr_Set_t * pRes;
     Gia_Obj_t * pObj;
     Vec_Int_t * vVar2Ids, * vLits;
-    int i, Lit, LitAux, Var, Value, RetValue, nCoreLits, * pCoreLits;//, nLits;
+    int i, Lit, LitAux, Var, Value, RetValue, nCoreLits, * pCoreLits, nFrameLits = 0;//, nLits;
 //    if ( k == 0 )
 //        fVerbose = 1;
     // collect CO objects
@@ -252,6 +252,7 @@ Abc_Print( 1, " in frame %d.\n", k );
     // collect assumptions 
     Vec_IntClear( p->vTemp );
     Vec_IntPush( p->vTemp, Abc_LitNot(LitAux) );
+    Pdr_ManAssumeFrame( p->pMan, k, p->vTemp );
     // iterate through the values of the CI variables
     Vec_IntForEachEntryTwo( p->vCiObjs, p->vCiVals, Var, Value, i )
     {
@@ -301,6 +302,12 @@ p->pMan->tAbs += Abc_Clock() - clk;
     for ( i = 0; i < nCoreLits; i++ )
         Vec_IntPush( p->vTemp, Abc_LitNot(pCoreLits[i]) );
     Vec_IntSelectSort( Vec_IntArray(p->vTemp), Vec_IntSize(p->vTemp) );
+    if ( p->pMan->pPars->fShareSat ) // satisfy the temporary clause
+    {
+        RetValue = sat_solver_addclause( pSat, &LitAux, &LitAux + 1 );
+        assert( RetValue == 1 );
+        sat_solver_compress( pSat );
+    }
 
     if ( fVerbose )
         Vec_IntPrint( p->vTemp );
@@ -308,10 +315,12 @@ p->pMan->tAbs += Abc_Clock() - clk;
     // collect the resulting sets
     Vec_IntClear( p->vPiLits );
     Vec_IntClear( p->vFfLits );
-    vVar2Ids = (Vec_Int_t *)Vec_PtrGetEntry( &p->pMan->vVar2Ids, k );
+    vVar2Ids = (Vec_Int_t *)Vec_PtrGetEntry( &p->pMan->vVar2Ids, p->pMan->pPars->fShareSat ? 0 : k );
     Vec_IntForEachEntry( p->vTemp, Lit, i )
     {
-        if ( Lit != Abc_LitNot(LitAux) )
+        if ( p->pMan->pPars->fShareSat && Lit == Abc_Var2Lit(Pdr_ManFrameAct(p->pMan, k), 0) )
+            nFrameLits++;
+        else if ( Lit != Abc_LitNot(LitAux) )
         {
             int Id = Vec_IntEntry( vVar2Ids, Abc_Lit2Var(Lit) );
             Aig_Obj_t * pObj = Aig_ManObj( p->pMan->pAig, Id );
@@ -322,7 +331,7 @@ p->pMan->tAbs += Abc_Clock() - clk;
                 Vec_IntPush( p->vFfLits, Abc_Var2Lit(Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pMan->pAig), Abc_LitIsCompl(Lit)) );
         }
     }
-    assert( Vec_IntSize(p->vTemp) == Vec_IntSize(p->vPiLits) + Vec_IntSize(p->vFfLits) + 1 );
+    assert( Vec_IntSize(p->vTemp) == Vec_IntSize(p->vPiLits) + Vec_IntSize(p->vFfLits) + nFrameLits + 1 );
 
     // move abstracted literals from flops to inputs
     if ( p->pMan->pPars->fUseAbs && p->pMan->vAbsFlops )
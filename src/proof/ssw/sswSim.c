@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "sswInt.h"
+#include "misc/util/utilSimd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -62,30 +63,10 @@ static inline unsigned   Ssw_ObjRandomSim()                   { return Aig_ManRa
 ***********************************************************************/
 unsigned Ssw_SmlObjHashWord( Ssw_Sml_t * p, Aig_Obj_t * pObj )
 {
-    static int s_SPrimes[128] = {
-        1009, 1049, 1093, 1151, 1201, 1249, 1297, 1361, 1427, 1459,
-        1499, 1559, 1607, 1657, 1709, 1759, 1823, 1877, 1933, 1997,
-        2039, 2089, 2141, 2213, 2269, 2311, 2371, 2411, 2467, 2543,
-        2609, 2663, 2699, 2741, 2797, 2851, 2909, 2969, 3037, 3089,
-        3169, 3221, 3299, 3331, 3389, 3461, 3517, 3557, 3613, 3671,
-        3719, 3779, 3847, 3907, 3943, 4013, 4073, 4129, 4201, 4243,
-        4289, 4363, 4441, 4493, 4549, 4621, 4663, 4729, 4793, 4871,
-        4933, 4973, 5021, 5087, 5153, 5227, 5281, 5351, 5417, 5471,
-        5519, 5573, 5651, 5693, 5749, 5821, 5861, 5923, 6011, 6073,
-        6131, 6199, 6257, 6301, 6353, 6397, 6481, 6563, 6619, 6689,
-        6737, 6803, 6863, 6917, 6977, 7027, 7109, 7187, 7237, 7309,
-        7393, 7477, 7523, 7561, 7607, 7681, 7727, 7817, 7877, 7933,
-        8011, 8039, 8059, 8081, 8093, 8111, 8123, 8147
-    };
     unsigned * pSims;
-    unsigned uHash;
-    int i;
 //    assert( p->nWordsTotal <= 128 );
-    uHash = 0;
     pSims = Ssw_ObjSim(p, pObj->Id);
-    for ( i = p->nWordsPref; i < p->nWordsTotal; i++ )
-        uHash ^= pSims[i] * s_SPrimes[i & 0x7F];
-    return uHash;
+    return Abc_SimdHash( pSims + p->nWordsPref, p->nWordsPref, p->nWordsTotal - p->nWordsPref );
 }
 
 /**Function*************************************************************
@@ -102,12 +83,8 @@ unsigned Ssw_SmlObjHashWord( Ssw_Sml_t * p, Aig_Obj_t * pObj )
 int Ssw_SmlObjIsConstWord( Ssw_Sml_t * p, Aig_Obj_t * pObj )
 {
     unsigned * pSims;
-    int i;
     pSims = Ssw_ObjSim(p, pObj->Id);
-    for ( i = p->nWordsPref; i < p->nWordsTotal; i++ )
-        if ( pSims[i] )
-            return 0;
-    return 1;
+    return Abc_SimdIsConst( pSims + p->nWordsPref, 0, p->nWordsTotal - p->nWordsPref );
 }
 
 /**Function*************************************************************
@@ -124,13 +101,9 @@ int Ssw_SmlObjIsConstWord( Ssw_Sml_t * p, Aig_Obj_t * pObj )
 int Ssw_SmlObjsAreEqualWord( Ssw_Sml_t * p, Aig_Obj_t * pObj0, Aig_Obj_t * pObj1 )
 {
     unsigned * pSims0, * pSims1;
-    int i;
     pSims0 = Ssw_ObjSim(p, pObj0->Id);
     pSims1 = Ssw_ObjSim(p, pObj1->Id);
-    for ( i = p->nWordsPref; i < p->nWordsTotal; i++ )
-        if ( pSims0[i] != pSims1[i] )
-            return 0;
-    return 1;
+    return Abc_SimdEqual( pSims0 + p->nWordsPref, pSims1 + p->nWordsPref, 0, p->nWordsTotal - p->nWordsPref );
 }
 
 /**Function*************************************************************
@@ -706,7 +679,7 @@ void Ssw_SmlAssignDist1Plus( Ssw_Sml_t * p, unsigned * pPat )
 void Ssw_SmlNodeSimulate( Ssw_Sml_t * p, Aig_Obj_t * pObj, int iFrame )
 {
     unsigned * pSims, * pSims0, * pSims1;
-    int fCompl, fCompl0, fCompl1, i;
+    int fCompl, fCompl0, fCompl1;
     assert( iFrame < p->nFrames );
     assert( !Aig_IsComplement(pObj) );
     assert( Aig_ObjIsNode(pObj) );
@@ -720,42 +693,7 @@ void Ssw_SmlNodeSimulate( Ssw_Sml_t * p, Aig_Obj_t * pObj, int iFrame )
     fCompl0 = Aig_ObjPhaseReal(Aig_ObjChild0(pObj));
     fCompl1 = Aig_ObjPhaseReal(Aig_ObjChild1(pObj));
     // simulate
-    if ( fCompl0 && fCompl1 )
-    {
-        if ( fCompl )
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (pSims0[i] | pSims1[i]);
-        else
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = ~(pSims0[i] | pSims1[i]);
-    }
-    else if ( fCompl0 && !fCompl1 )
-    {
-        if ( fCompl )
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (pSims0[i] | ~pSims1[i]);
-        else
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (~pSims0[i] & pSims1[i]);
-    }
-    else if ( !fCompl0 && fCompl1 )
-    {
-        if ( fCompl )
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (~pSims0[i] | pSims1[i]);
-        else
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (pSims0[i] & ~pSims1[i]);
-    }
-    else // if ( !fCompl0 && !fCompl1 )
-    {
-        if ( fCompl )
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = ~(pSims0[i] & pSims1[i]);
-        else
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (pSims0[i] & pSims1[i]);
-    }
+    Abc_SimdAnd( pSims, pSims0, pSims1, fCompl0, fCompl1, fCompl, p->nWordsFrame );
 }
 
 /**Function*************************************************************
@@ -772,7 +710,6 @@ void Ssw_SmlNodeSimulate( Ssw_Sml_t * p, Aig_Obj_t * pObj, int iFrame )
 int Ssw_SmlNodesCompareInFrame( Ssw_Sml_t * p, Aig_Obj_t * pObj0, Aig_Obj_t * pObj1, int iFrame0, int iFrame1 )
 {
     unsigned * pSims0, * pSims1;
-    int i;
     assert( iFrame0 < p->nFrames );
     assert( iFrame1 < p->nFrames );
     assert( !Aig_IsComplement(pObj0) );
@@ -783,10 +720,7 @@ int Ssw_SmlNodesCompareInFrame( Ssw_Sml_t * p, Aig_Obj_t * pObj0, Aig_Obj_t * pO
     pSims0  = Ssw_ObjSim(p, pObj0->Id) + p->nWordsFrame * iFrame0;
     pSims1  = Ssw_ObjSim(p, pObj1->Id) + p->nWordsFrame * iFrame1;
     // compare
-    for ( i = 0; i < p->nWordsFrame; i++ )
-        if ( pSims0[i] != pSims1[i] )
-            return 0;
-    return 1;
+    return Abc_SimdEqual( pSims0, pSims1, 0, p->nWordsFrame );
 }
 
 /**Function*************************************************************
@@ -803,7 +737,7 @@ int Ssw_SmlNodesCompareInFrame( Ssw_Sml_t * p, Aig_Obj_t * pObj0, Aig_Obj_t * pO
 void Ssw_SmlNodeCopyFanin( Ssw_Sml_t * p, Aig_Obj_t * pObj, int iFrame )
 {
     unsigned * pSims, * pSims0;
-    int fCompl, fCompl0, i;
+    int fCompl, fCompl0;
     assert( iFrame < p->nFrames );
     assert( !Aig_IsComplement(pObj) );
     assert( Aig_ObjIsCo(pObj) );
@@ -815,12 +749,7 @@ void Ssw_SmlNodeCopyFanin( Ssw_Sml_t * p, Aig_Obj_t * pObj, int iFrame )
     fCompl  = pObj->fPhase;
     fCompl0 = Aig_ObjPhaseReal(Aig_ObjChild0(pObj));
     // copy information as it is
-    if ( fCompl0 )
-        for ( i = 0; i < p->nWordsFrame; i++ )
-            pSims[i] = ~pSims0[i];
-    else
-        for ( i = 0; i < p->nWordsFrame; i++ )
-            pSims[i] = pSims0[i];
+    Abc_SimdCopy( pSims, pSims0, fCompl0, p->nWordsFrame );
 }
 
 /**Function*************************************************************
@@ -837,7 +766,6 @@ void Ssw_SmlNodeCopyFanin( Ssw_Sml_t * p, Aig_Obj_t * pObj, int iFrame )
 void Ssw_SmlNodeTransferNext( Ssw_Sml_t * p, Aig_Obj_t * pOut, Aig_Obj_t * pIn, int iFrame )
 {
     unsigned * pSims0, * pSims1;
-    int i;
     assert( iFrame < p->nFrames );
     assert( !Aig_IsComplement(pOut) );
     assert( !Aig_IsComplement(pIn) );
@@ -848,8 +776,7 @@ void Ssw_SmlNodeTransferNext( Ssw_Sml_t * p, Aig_Obj_t * pOut, Aig_Obj_t * pIn,
     pSims0 = Ssw_ObjSim(p, pOut->Id) + p->nWordsFrame * iFrame;
     pSims1 = Ssw_ObjSim(p, pIn->Id) + p->nWordsFrame * (iFrame+1);
     // copy information as it is
-    for ( i = 0; i < p->nWordsFrame; i++ )
-        pSims1[i] = pSims0[i];
+    Abc_SimdCopy( pSims1, pSims0, 0, p->nWordsFrame );
 }
 
 /**Function*************************************************************
@@ -41,6 +41,55 @@ ABC_NAMESPACE_HEADER_START
 
 // unrolling manager 
 typedef struct Unr_Man_t_ Unr_Man_t;
+
+// SAT solvers available through the common interface (bmcSolver.c)
+typedef enum { 
+    BMC_SOLVER_BSAT = 0,        // MiniSat-based solver (sat/bsat)
+    BMC_SOLVER_SATOKO,          // Satoko (sat/satoko)
+    BMC_SOLVER_GLUCOSE,         // Glucose 3.0 (sat/glucose)
+    BMC_SOLVER_XSAT,            // xSAT (sat/xsat)
+    BMC_SOLVER_NONE             // unused
+} Bmc_SolverType_t;
+
+// the procedure called for each learned clause (the literals, their number and the LBD)
+typedef void (*Bmc_SolverLearnt_f)( void * pMan, int * pLits, int nLits, int Lbd );
+
+// the procedures implemented by each solver
+typedef struct Bmc_SolverVt_t_ Bmc_SolverVt_t;
+struct Bmc_SolverVt_t_
+{
+    char *      pName;          // the name used in "-S <solver>"
+    void *   (* pFuncStart)      ( void );
+    void     (* pFuncStop)       ( void * pSat );
+    void     (* pFuncReset)      ( void * pSat );                                   // NULL if not supported
+    int      (* pFuncAddVar)     ( void * pSat );
+    int      (* pFuncAddClause)  ( void * pSat, int * pLits, int nLits );
+    int      (* pFuncSolve)      ( void * pSat, int * pLits, int nLits, int nConfLimit );
+    int      (* pFuncFinal)      ( void * pSat, int ** ppLits );
+    int      (* pFuncVarValue)   ( void * pSat, int iVar );
+    void     (* pFuncBookmark)   ( void * pSat );                                   // NULL if not supported
+    void     (* pFuncRollback)   ( void * pSat );                                   // NULL if not supported
+    void     (* pFuncSetStop)    ( void * pSat, int * pStop );
+    abctime  (* pFuncSetRuntimeLimit)( void * pSat, abctime Limit );
+    void     (* pFuncSetLearnt)  ( void * pSat, void * pMan, Bmc_SolverLearnt_f pFunc ); // NULL if not supported
+    int      (* pFuncVarNum)     ( void * pSat );
+    int      (* pFuncConfNum)    ( void * pSat );
+};
+
+// incremental SAT solver
+typedef struct Bmc_Solver_t_ Bmc_Solver_t;
+struct Bmc_Solver_t_
+{
+    const Bmc_SolverVt_t * pVt; // the solver procedures
+    void *      pSat;           // the solver
+    int         Type;           // the solver type
+    int         nConfLimit;     // conflict budget of one call (0 = no limit)
+    int *       pStop;          // external flag to terminate
+    int         fUnsat;         // the problem is UNSAT without assumptions
+    int         fUnsatMark;     // the same flag at the bookmark
+    void *      pLearntMan;     // the manager of learned clauses
+    Bmc_SolverLearnt_f pLearntFunc; // called for each learned clause
+};
 
 typedef struct Saig_ParBmc_t_ Saig_ParBmc_t;
 struct Saig_ParBmc_t_
@@ -95,6 +144,7 @@ struct Bmc_AndPar_t_
     int         fUseSynth;      // use synthesis
     int         fUseOldCnf;     // use old CNF construction
     int         fUseGlucose;    // use Glucose 3.0 as the default solver
+    int         SolverType;     // the SAT solver (Bmc_SolverType_t)
     int         fUseEliminate;  // use variable elimination
     int         fVerbose;       // verbose 
     int         fVeryVerbose;   // very verbose 
@@ -103,7 +153,20 @@ struct Bmc_AndPar_t_
     int         nFailOuts;      // the number of failed outputs
     int         nDropOuts;      // the number of dropped outputs
     
-    void (*pFuncOnFrameDone)(int, int, int); // callback on each frame status (frame, po, statuss)
+    void (*pFuncOnFrameDone)(int, int, int); // callback on each frame status (frame, po, statuss)
+};
+
+typedef struct Bmc_PfPar_t_ Bmc_PfPar_t;
+struct Bmc_PfPar_t_
+{
+    int         nProcs;         // the number of solvers in the portfolio
+    int         nConfLimit;     // conflict limit of each solver
+    int         nTimeOut;       // timeout in seconds
+    int         nShareSize;     // the largest size of a shared clause
+    int         nShareLbd;      // the largest LBD of a shared clause
+    int         fShare;         // enables clause sharing
+    int         fVerbose;       // verbose 
+    int         Solver;         // the solver that finished first
 };
   
 typedef struct Bmc_BCorePar_t_ Bmc_BCorePar_t;
@@ -156,6 +219,17 @@ struct Bmc_ParFf_t_
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
 
+// the literals are 2*var+compl; the solving results are 1 (SAT), -1 (UNSAT) and 0 (undecided)
+static inline char * Bmc_SolverName( Bmc_Solver_t * p )                             { return p->pVt->pName;                                  }
+static inline int    Bmc_SolverAddVar( Bmc_Solver_t * p )                           { return p->pVt->pFuncAddVar( p->pSat );                 }
+static inline int    Bmc_SolverAddClause( Bmc_Solver_t * p, int * pLits, int nLits ) { if ( !p->fUnsat && !p->pVt->pFuncAddClause(p->pSat, pLits, nLits) ) p->fUnsat = 1; return !p->fUnsat; }
+static inline int    Bmc_SolverFinal( Bmc_Solver_t * p, int ** ppLits )             { if ( p->fUnsat ) { *ppLits = NULL; return 0; } return p->pVt->pFuncFinal( p->pSat, ppLits ); }
+static inline int    Bmc_SolverVarValue( Bmc_Solver_t * p, int iVar )               { return p->pVt->pFuncVarValue( p->pSat, iVar );         }
+static inline int    Bmc_SolverVarNum( Bmc_Solver_t * p )                           { return p->pVt->pFuncVarNum( p->pSat );                 }
+static inline int    Bmc_SolverConflictNum( Bmc_Solver_t * p )                      { return p->pVt->pFuncConfNum( p->pSat );                }
+static inline int    Bmc_SolverCanShare( Bmc_Solver_t * p )                         { return p->pVt->pFuncSetLearnt != NULL;                 }
+static inline int    Bmc_SolverCanRollback( Bmc_Solver_t * p )                      { return p->pVt->pFuncBookmark != NULL;                  }
+
 ////////////////////////////////////////////////////////////////////////
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -187,6 +261,24 @@ extern int               Bmc_CexVerify( Gia_Man_t * p, Abc_Cex_t * pCex, Abc_Cex
 /*=== bmcICheck.c ==========================================================*/
 extern void              Bmc_PerformICheck( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fEmpty, int fVerbose );
 extern Vec_Int_t *       Bmc_PerformISearch( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fReverse, int fBackTopo, int fDump, int fVerbose );
+/*=== bmcPortfolio.c ==========================================================*/
+extern void              Bmc_PortfolioSetDefaultParams( Bmc_PfPar_t * pPars );
+extern int               Bmc_PortfolioSolveCnf( char * pFileName, Bmc_PfPar_t * pPars );
+extern int               Bmc_PortfolioSolveAig( Gia_Man_t * p, Bmc_PfPar_t * pPars );
+/*=== bmcSolver.c ==========================================================*/
+extern int               Bmc_SolverTypeFromName( char * pName );
+extern char *            Bmc_SolverTypeName( int Type );
+extern char *            Bmc_SolverTypeNames();
+extern Bmc_Solver_t *    Bmc_SolverStart( int Type );
+extern void              Bmc_SolverStop( Bmc_Solver_t * p );
+extern void              Bmc_SolverReset( Bmc_Solver_t * p );
+extern int               Bmc_SolverSolve( Bmc_Solver_t * p, int * pLits, int nLits );
+extern void              Bmc_SolverSetConflictBudget( Bmc_Solver_t * p, int nConfLimit );
+extern void              Bmc_SolverSetStop( Bmc_Solver_t * p, int * pStop );
+extern abctime           Bmc_SolverSetRuntimeLimit( Bmc_Solver_t * p, abctime Limit );
+extern void              Bmc_SolverSetLearnt( Bmc_Solver_t * p, void * pMan, Bmc_SolverLearnt_f pFunc );
+extern void              Bmc_SolverBookmark( Bmc_Solver_t * p );
+extern void              Bmc_SolverRollback( Bmc_Solver_t * p );
 /*=== bmcUnroll.c ==========================================================*/
 extern Unr_Man_t *       Unr_ManUnrollStart( Gia_Man_t * pGia, int fVerbose );
 extern Gia_Man_t *       Unr_ManUnrollFrame( Unr_Man_t * p, int f );
@@ -751,6 +751,7 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nConfLi
     {
         satoko_opts_t opts;
         satoko_default_opts(&opts);
+        satoko_inproc_opts(&opts);
         opts.conf_limit = nConfLimit;
         p->pSat2 = satoko_create();  
         satoko_configure(p->pSat2, &opts);
@@ -21,6 +21,7 @@
 #include "bmc.h"
 #include "sat/cnf/cnf.h"
 #include "sat/satoko/satoko.h"
+#include "misc/util/utilPool.h"
 
 
 //#define ABC_USE_EXT_SOLVERS 1
@@ -34,14 +35,14 @@
     #define l_Undef  0
     #define l_True   1
     #define l_False -1
-    #define bmc_sat_solver                     satoko_t
-    #define bmc_sat_solver_start(type)         satoko_create()
-    #define bmc_sat_solver_stop                satoko_destroy
-    #define bmc_sat_solver_addclause           satoko_add_clause
-    #define bmc_sat_solver_addvar(s)           satoko_add_variable(s, 0)
-    #define bmc_sat_solver_solve               satoko_solve_assumptions
-    #define bmc_sat_solver_read_cex_varvalue   satoko_read_cex_varvalue
-    #define bmc_sat_solver_setstop             satoko_set_stop
+    #define bmc_sat_solver                     Bmc_Solver_t
+    #define bmc_sat_solver_start(type)         Bmc_SolverStart(type)
+    #define bmc_sat_solver_stop                Bmc_SolverStop
+    #define bmc_sat_solver_addclause           Bmc_SolverAddClause
+    #define bmc_sat_solver_addvar(s)           Bmc_SolverAddVar(s)
+    #define bmc_sat_solver_solve               Bmc_SolverSolve
+    #define bmc_sat_solver_read_cex_varvalue   Bmc_SolverVarValue
+    #define bmc_sat_solver_setstop             Bmc_SolverSetStop
 #endif
 
 
@@ -368,6 +369,7 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     int i, Lit = Abc_Var2Lit( 0, 1 );
     satoko_opts_t opts;
     satoko_default_opts(&opts);
+    satoko_inproc_opts(&opts);
     opts.conf_limit = pPars->nConfLimit;
     assert( Gia_ManRegNum(pGia) > 0 );
     p->pPars   = pPars;
@@ -388,11 +390,17 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 	    opts.b_rst = 1.4 - i * 0.05;
         opts.garbage_max_ratio = (float) 0.3 + i * 0.05;
         // create SAT solvers
-        p->pSats[i] = bmc_sat_solver_start( i );  
 #ifdef ABC_USE_EXT_SOLVERS
+        p->pSats[i] = bmc_sat_solver_start( i );  
         p->pSats[i]->SolverType = i;
 #else
-        satoko_configure(p->pSats[i], &opts);
+        p->pSats[i] = bmc_sat_solver_start( pPars->SolverType );  
+        // Satoko keeps the conflict limit for the lifetime of the solver,
+        // while the other solvers apply it to each call
+        if ( pPars->SolverType == BMC_SOLVER_SATOKO )
+            satoko_configure( (satoko_t *)p->pSats[i]->pSat, &opts );
+        else
+            Bmc_SolverSetConflictBudget( p->pSats[i], pPars->nConfLimit );
 #endif
         bmc_sat_solver_addvar( p->pSats[i] );
         bmc_sat_solver_addclause( p->pSats[i], &Lit, 1 );  
@@ -583,10 +591,9 @@ void Bmcs_ManPrintFrame( Bmcs_Man_t * p, int f, int nClauses, int Solver, abctim
         return;
     Abc_Print( 1, "%4d %s : ", f,   fUnfinished ? "-" : "+" );
 #ifndef ABC_USE_EXT_SOLVERS
-    Abc_Print( 1, "Var =%8.0f.  ",  (double)satoko_varnum(p->pSats[0]) ); 
-    Abc_Print( 1, "Cla =%9.0f.  ",  (double)satoko_clausenum(p->pSats[0]) );  
-    Abc_Print( 1, "Learn =%9.0f.  ",(double)satoko_learntnum(p->pSats[0]) );  
-    Abc_Print( 1, "Conf =%9.0f.  ", (double)satoko_conflictnum(p->pSats[0]) );  
+    Abc_Print( 1, "Var =%8.0f.  ",  (double)Bmc_SolverVarNum(p->pSats[0]) ); 
+    Abc_Print( 1, "Cla =%9.0f.  ",  (double)nClauses );  
+    Abc_Print( 1, "Conf =%9.0f.  ", (double)Bmc_SolverConflictNum(p->pSats[0]) );  
 #else
     Abc_Print( 1, "Var =%8.0f.  ",  (double)p->nSatVars ); 
     Abc_Print( 1, "Cla =%9.0f.  ",  (double)nClauses );  
@@ -735,75 +742,40 @@ typedef struct Par_ThData_t_
     bmc_sat_solver *  pSat;
     int         iLit;
     int         iThread;
-    int         fWorking;
     int         status;
 } Par_ThData_t;
 
-void * Bmcs_ManWorkerThread( void * pArg )
+void Bmcs_ManWorkerTask( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->pSat == NULL )
-        {
-	        pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-
-        pThData->status = bmc_sat_solver_solve( pThData->pSat, &pThData->iLit, 1 );
-
-        //printf( "Thread %d finished with status %d\n", pThData->iThread, pThData->status );
-
-        pThData->fWorking = 0;
-    }
-	assert( 0 );
-	return NULL;
+    assert( pThData->pSat != NULL );
+    pThData->status = bmc_sat_solver_solve( pThData->pSat, &pThData->iLit, 1 );
+    //printf( "Thread %d finished with status %d\n", pThData->iThread, pThData->status );
 }
 
-int Bmcs_ManPerform_Solve( Bmcs_Man_t * p, int iLit, pthread_t * WorkerThread, Par_ThData_t * ThData, int nProcs, int * pSolver )
+int Bmcs_ManPerform_Solve( Bmcs_Man_t * p, int iLit, Util_Job_t * pJob, Par_ThData_t * ThData, int nProcs, int * pSolver )
 {
+    Par_ThData_t * pThData;
     int i, status = -1;
-    // set new problem
-    for ( i = 0; i < nProcs; i++ )
-    {
-        ThData[i].iLit = iLit;
-        assert( ThData[i].fWorking == 0 );
-    }
     // start solvers on a new problem
     for ( i = 0; i < nProcs; i++ )
-        ThData[i].fWorking = 1;
-    // check if any of the solvers finished
-    while ( i == nProcs )
     {
-        for ( i = 0; i < nProcs; i++ )
-        {
-            if ( ThData[i].fWorking )
-                continue;
-            // set stop request
-            p->fStopNow = 1;
-            // remember status
-            status = ThData[i].status;
-            //printf( "Solver %d returned status %d.\n", i, status );
-            *pSolver = i;
-            break;
-        }
-    }
-    // wait till threads finish
-    while ( i < nProcs )
-    {
-        for ( i = 0; i < nProcs; i++ )
-            if ( ThData[i].fWorking )
-                break;
+        ThData[i].iLit = iLit;
+        Util_JobSubmit( pJob, Bmcs_ManWorkerTask, ThData + i );
     }
+    // wait for the first solver to finish
+    pThData = (Par_ThData_t *)Util_JobWaitNext( pJob );
+    assert( pThData != NULL );
+    // set stop request
+    p->fStopNow = 1;
+    // remember status
+    status = pThData->status;
+    //printf( "Solver %d returned status %d.\n", pThData->iThread, status );
+    *pSolver = pThData->iThread;
+    // wait till other solvers finish
+    Util_JobWaitAll( pJob );
     for ( i = 0; i < nProcs; i++ )
-    {
         ThData[i].iLit = -1;
-        assert( ThData[i].fWorking == 0 );
-    }
     // reset stop request
     p->fStopNow = 0;
     return status;
@@ -812,20 +784,19 @@ int Bmcs_ManPerform_Solve( Bmcs_Man_t * p, int iLit, pthread_t * WorkerThread, P
 int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 {
     abctime clkStart = Abc_Clock();
-	pthread_t WorkerThread[PAR_THR_MAX];
     Par_ThData_t ThData[PAR_THR_MAX];
+    Util_Pool_t * pPool = Util_PoolStart( pPars->nProcs );
+    Util_Job_t * pJob = Util_JobStart( pPool );
     Bmcs_Man_t * p = Bmcs_ManStart( pGia, pPars );
     int f, k = 0, i = Gia_ManPoNum(pGia), status, RetValue = -1, nClauses = 0, Solver = 0;
     Abc_CexFreeP( &pGia->pCexSeq );
-    // start threads
+    // the solvers race each other, so each of them gets its own thread
     for ( i = 0; i < pPars->nProcs; i++ )
     {
         ThData[i].pSat     = p->pSats[i];
         ThData[i].iLit     = -1;
         ThData[i].iThread  =  i;
-        ThData[i].fWorking =  0;
         ThData[i].status   = -1;
-        status = pthread_create( WorkerThread + i, NULL, Bmcs_ManWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
     }
     // solve properties in each timeframe
     for ( f = 0; !pPars->nFramesMax || f < pPars->nFramesMax; f += pPars->nFramesAdd )
@@ -857,7 +828,7 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                 int iLit = Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
                 if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
                     break;
-                status = Bmcs_ManPerform_Solve( p, iLit, WorkerThread, ThData, pPars->nProcs, &Solver );
+                status = Bmcs_ManPerform_Solve( p, iLit, pJob, ThData, pPars->nProcs, &Solver );
                 p->timeSat += Abc_Clock() - clk;
                 if ( status == l_False ) // unsat
                 {
@@ -892,13 +863,8 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         if ( k < pPars->nFramesAdd )
             break;
     }
-    // stop threads
-    for ( i = 0; i < pPars->nProcs; i++ )
-    {
-        assert( !ThData[i].fWorking );
-        ThData[i].pSat = NULL;
-        ThData[i].fWorking = 1;
-    }
+    Util_JobStop( pJob );
+    Util_PoolStop( pPool );
     p->timeOth = Abc_Clock() - clkStart - p->timeUnf - p->timeCnf - p->timeSat;
     if ( RetValue == -1 && !pPars->fNotVerbose )
         printf( "No output failed in %d frames.  ", f + (k < pPars->nFramesAdd ? k+1 : 0) );
@@ -263,6 +263,7 @@ static inline void Gia_ObjMakePoConst0( Gia_Man_t * p, Gia_Obj_t * pObj )
     assert( Gia_ObjIsCo(pObj) );
     pObj->iDiff0 = Gia_ObjId( p, pObj );
     pObj->fCompl0 = 0;
+    Gia_ManSoaUpdateCo( p, pObj );
 }
 int Gia_ManCountNonConst0( Gia_Man_t * p )
 { 
@@ -829,8 +829,10 @@ Vec_Str_t * Bmc_CollapseOneOld2( Gia_Man_t * p, int nCubeLim, int nBTLimit, int
     if ( vSopOn )
         nCubesOn = Vec_StrCountEntry(vSopOn,'\n');
     Gia_ObjFlipFaninC0( Gia_ManPo(p, 0) );
+    Gia_ManSoaUpdateCo( p, Gia_ManPo(p, 0) );
     vSopOff = Bmc_CollapseOneInt2( p, Abc_MinInt(nCubeLim, nCubesOn), nBTLimit, fCanon, fReverse, fVerbose, 1 );
     Gia_ObjFlipFaninC0( Gia_ManPo(p, 0) );
+    Gia_ManSoaUpdateCo( p, Gia_ManPo(p, 0) );
     if ( vSopOff )
         nCubesOff = Vec_StrCountEntry(vSopOff,'\n');
     if ( vSopOn == NULL )
@@ -0,0 +1,576 @@
+/**CFile****************************************************************
+
+  FileName    [bmcPortfolio.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Parallel portfolio of SAT solvers sharing learned clauses.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: bmcPortfolio.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "sat/cnf/cnf.h"
+#include "sat/bsat/satSolver.h"
+#include "sat/satoko/satoko.h"
+#include "sat/glucose/AbcGlucose.h"
+#include "misc/util/utilPool.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define BMC_PF_PROC_MAX      64        // the max number of solvers
+#define BMC_PF_RING_LOG      16        // the log2 of the number of slots in the exchange buffer
+#define BMC_PF_ROUND_START 2000        // the conflict budget of the first round
+#define BMC_PF_ROUND_MAX 100000        // the largest conflict budget of one round
+
+// the exchange buffer of learned clauses
+//
+// the buffer is a ring of fixed-size slots, each holding the ID of the source
+// solver, the number of literals, and the literals of one clause; a writer
+// claims the next clause number by atomic increment and the slot by
+// compare-and-swap on its sequence number, which is odd while the slot is
+// written and is 2*(clause number)+2 after the clause is published; a reader
+// copies the slot and accepts the clause if the sequence number did not
+// change; the clauses that were overwritten or not published in time are
+// skipped, which is safe because sharing learned clauses is optional
+typedef struct Bmc_PfRing_t_ Bmc_PfRing_t;
+struct Bmc_PfRing_t_
+{
+    int              nSlotSize;     // the number of ints in one slot
+    word             nWritten;      // the number of claimed clause numbers
+    word *           pSeqs;         // the sequence numbers of the slots
+    int *            pData;         // the slots
+};
+
+typedef struct Bmc_PfMan_t_ Bmc_PfMan_t;
+
+// one solver of the portfolio
+typedef struct Bmc_PfThData_t_ Bmc_PfThData_t;
+struct Bmc_PfThData_t_
+{
+    Bmc_PfMan_t *    p;             // the portfolio
+    Bmc_Solver_t *   pSat;          // the solver (started by its first round)
+    int              iThread;       // the number of the solver
+    int              Type;          // the solver type
+    int              Variant;       // the configuration of the solver
+    int              status;        // the result of the last round
+    int              nBudget;       // the conflict budget of the next round
+    int              nRounds;       // the number of rounds
+    int              nExported;     // the number of clauses written into the buffer
+    int              nImported;     // the number of clauses read from the buffer
+    word             iRead;         // the next clause to be read from the buffer
+};
+
+struct Bmc_PfMan_t_
+{
+    Bmc_PfPar_t *    pPars;         // parameters
+    Cnf_Dat_t *      pCnf;          // the problem
+    abctime          TimeLimit;     // the runtime limit (wall-clock time)
+    int              fStop;         // raised when the problem is solved
+    int              nProcs;        // the number of solvers
+    int              nShareSize;    // the largest size of a shared clause
+    Bmc_PfRing_t     Ring;          // the exchange buffer
+    Bmc_PfThData_t   ThData[BMC_PF_PROC_MAX];
+};
+
+// the solver types used in turn by the portfolio
+static int s_PfTypes[3]     = { BMC_SOLVER_GLUCOSE, BMC_SOLVER_SATOKO, BMC_SOLVER_BSAT };
+// the restart parameters (force and block factors) used in turn by the configurations
+static double s_PfRestarts[4][2] = { {0.8, 1.4}, {0.7, 1.2}, {0.9, 1.6}, {0.75, 1.3} };
+
+// returns wall-clock time (Abc_Clock() measures the time of the calling thread)
+static inline abctime Bmc_PfClock()
+{
+#if (defined(LIN) || defined(LIN64)) && !(__APPLE__ & __MACH__) && !defined(__MINGW32__)
+    struct timespec ts;
+    if ( clock_gettime(CLOCK_MONOTONIC, &ts) < 0 ) 
+        return (abctime)-1;
+    return ((abctime)ts.tv_sec) * CLOCKS_PER_SEC + (((abctime)ts.tv_nsec) * CLOCKS_PER_SEC) / 1000000000;
+#else
+    return Abc_Clock();
+#endif
+}
+
+static inline int      Bmc_PfQueuePop( Vec_Int_t * p )                      { int Entry = Vec_IntEntry( p, 0 ); Vec_IntDrop( p, 0 ); return Entry;             }
+
+#if defined(__GNUC__)
+static inline int      Bmc_PfAtomicLoadInt( int * p )                       { return __atomic_load_n( p, __ATOMIC_RELAXED );                                  }
+static inline void     Bmc_PfAtomicStoreInt( int * p, int Value )           { __atomic_store_n( p, Value, __ATOMIC_RELAXED );                                 }
+static inline word     Bmc_PfAtomicLoadWord( word * p )                     { return __atomic_load_n( p, __ATOMIC_ACQUIRE );                                  }
+static inline void     Bmc_PfAtomicStoreWord( word * p, word Value )        { __atomic_store_n( p, Value, __ATOMIC_RELEASE );                                 }
+static inline word     Bmc_PfAtomicAddWord( word * p, word Value )          { return __atomic_fetch_add( p, Value, __ATOMIC_ACQ_REL );                        }
+static inline int      Bmc_PfAtomicCasWord( word * p, word * pOld, word New ) { return __atomic_compare_exchange_n( p, pOld, New, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ); }
+static inline void     Bmc_PfAtomicFence()                                  { __atomic_thread_fence( __ATOMIC_ACQUIRE );                                      }
+#else
+// without atomic operations the buffer can be used by one thread only
+static inline int      Bmc_PfAtomicLoadInt( int * p )                       { return *p;                                                                      }
+static inline void     Bmc_PfAtomicStoreInt( int * p, int Value )           { *p = Value;                                                                     }
+static inline word     Bmc_PfAtomicLoadWord( word * p )                     { return *p;                                                                      }
+static inline void     Bmc_PfAtomicStoreWord( word * p, word Value )        { *p = Value;                                                                     }
+static inline word     Bmc_PfAtomicAddWord( word * p, word Value )          { word Old = *p; *p += Value; return Old;                                         }
+static inline int      Bmc_PfAtomicCasWord( word * p, word * pOld, word New ) { if ( *p != *pOld ) { *pOld = *p; return 0; } *p = New; return 1;              }
+static inline void     Bmc_PfAtomicFence()                                  {                                                                                 }
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the default parameters.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_PortfolioSetDefaultParams( Bmc_PfPar_t * pPars )
+{
+    memset( pPars, 0, sizeof(Bmc_PfPar_t) );
+    pPars->nProcs     =  4;    // the number of solvers in the portfolio
+    pPars->nConfLimit =  0;    // conflict limit of each solver
+    pPars->nTimeOut   =  0;    // timeout in seconds
+    pPars->nShareSize =  8;    // the largest size of a shared clause
+    pPars->nShareLbd  =  4;    // the largest LBD of a shared clause
+    pPars->fShare     =  1;    // enables clause sharing
+    pPars->fVerbose   =  0;    // verbose
+    pPars->Solver     = -1;    // the solver that finished first
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes and reads clauses in the exchange buffer.]
+
+  Description [Writing returns 0 if the slot is taken by another writer.
+  Reading returns the number of literals or -1 if the clause is not
+  available.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Bmc_PfRingSlot( Bmc_PfRing_t * p, word iClause )
+{
+    return (int)(iClause & ((1 << BMC_PF_RING_LOG) - 1));
+}
+int Bmc_PfRingWrite( Bmc_PfRing_t * p, int iSource, int * pLits, int nLits )
+{
+    word iClause = Bmc_PfAtomicAddWord( &p->nWritten, 1 );
+    word * pSeq  = p->pSeqs + Bmc_PfRingSlot( p, iClause );
+    int * pSlot  = p->pData + Bmc_PfRingSlot( p, iClause ) * p->nSlotSize;
+    word Seq     = Bmc_PfAtomicLoadWord( pSeq );
+    int i;
+    assert( nLits <= p->nSlotSize - 2 );
+    // skip if the slot is being written or was claimed for a later clause
+    if ( (Seq & 1) || Seq > 2*iClause || !Bmc_PfAtomicCasWord(pSeq, &Seq, 2*iClause+1) )
+        return 0;
+    Bmc_PfAtomicStoreInt( pSlot, iSource );
+    Bmc_PfAtomicStoreInt( pSlot + 1, nLits );
+    for ( i = 0; i < nLits; i++ )
+        Bmc_PfAtomicStoreInt( pSlot + 2 + i, pLits[i] );
+    Bmc_PfAtomicStoreWord( pSeq, 2*iClause+2 );
+    return 1;
+}
+int Bmc_PfRingRead( Bmc_PfRing_t * p, word iClause, int * piSource, int * pLits )
+{
+    word * pSeq  = p->pSeqs + Bmc_PfRingSlot( p, iClause );
+    int * pSlot  = p->pData + Bmc_PfRingSlot( p, iClause ) * p->nSlotSize;
+    word Seq     = Bmc_PfAtomicLoadWord( pSeq );
+    int i, nLits;
+    if ( Seq != 2*iClause+2 )
+        return -1;
+    *piSource = Bmc_PfAtomicLoadInt( pSlot );
+    nLits     = Bmc_PfAtomicLoadInt( pSlot + 1 );
+    if ( nLits < 1 || nLits > p->nSlotSize - 2 )
+        return -1;
+    for ( i = 0; i < nLits; i++ )
+        pLits[i] = Bmc_PfAtomicLoadInt( pSlot + 2 + i );
+    // the clause is valid if the slot was not claimed by another writer meanwhile
+    Bmc_PfAtomicFence();
+    if ( Bmc_PfAtomicLoadWord(pSeq) != Seq )
+        return -1;
+    return nLits;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Exports the learned clause of one solver.]
+
+  Description [Called by the solver in the middle of the search.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_PfExport( void * pArg, int * pLits, int nLits, int Lbd )
+{
+    Bmc_PfThData_t * pThData = (Bmc_PfThData_t *)pArg;
+    Bmc_PfMan_t * p = pThData->p;
+    if ( nLits > p->nShareSize || Lbd > p->pPars->nShareLbd )
+        return;
+    pThData->nExported += Bmc_PfRingWrite( &p->Ring, pThData->iThread, pLits, nLits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Imports the clauses exported by other solvers.]
+
+  Description [Called between the rounds, when the solver is at the top
+  level. Returns 0 if the problem became UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PfImport( Bmc_PfThData_t * pThData )
+{
+    Bmc_PfRing_t * pRing = &pThData->p->Ring;
+    word nWritten = Bmc_PfAtomicLoadWord( &pRing->nWritten );
+    int pLits[256], iSource, nLits;
+    assert( pRing->nSlotSize - 2 <= 256 );
+    // skip the clauses that are already overwritten
+    if ( nWritten - pThData->iRead > ((word)1 << BMC_PF_RING_LOG) )
+        pThData->iRead = nWritten - ((word)1 << BMC_PF_RING_LOG);
+    for ( ; pThData->iRead < nWritten; pThData->iRead++ )
+    {
+        nLits = Bmc_PfRingRead( pRing, pThData->iRead, &iSource, pLits );
+        if ( nLits == -1 || iSource == pThData->iThread )
+            continue;
+        pThData->nImported++;
+        if ( !Bmc_SolverAddClause( pThData->pSat, pLits, nLits ) )
+            return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the solver and loads the problem.]
+
+  Description [The configurations differ by the solver type, the random
+  seed, the restart parameters, and the initial phase.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PfStartSolver( Bmc_PfThData_t * pThData )
+{
+    Cnf_Dat_t * pCnf = pThData->p->pCnf;
+    double * pRestart = s_PfRestarts[pThData->Variant % 4];
+    int i, Seed = 91648253 + 1013 * pThData->Variant;
+    pThData->pSat = Bmc_SolverStart( pThData->Type );
+    Bmc_SolverSetStop( pThData->pSat, &pThData->p->fStop );
+    if ( pThData->p->pPars->fShare && Bmc_SolverCanShare(pThData->pSat) )
+        Bmc_SolverSetLearnt( pThData->pSat, pThData, Bmc_PfExport );
+    // the first configuration of each solver uses the default settings
+    if ( pThData->Variant > 0 && pThData->Type == BMC_SOLVER_GLUCOSE )
+    {
+        bmcg_sat_solver_set_random( (bmcg_sat_solver *)pThData->pSat->pSat, Seed, pThData->Variant & 1 );
+        bmcg_sat_solver_set_restarts( (bmcg_sat_solver *)pThData->pSat->pSat, pRestart[0], pRestart[1] );
+    }
+    if ( pThData->Variant > 0 && pThData->Type == BMC_SOLVER_SATOKO )
+    {
+        satoko_opts_t * pOpts = satoko_options( (satoko_t *)pThData->pSat->pSat );
+        pOpts->f_rst     = pRestart[0];
+        pOpts->b_rst     = pRestart[1];
+        pOpts->var_decay = (pThData->Variant & 1) ? 0.9 : 0.95;
+    }
+    if ( pThData->Variant > 0 && pThData->Type == BMC_SOLVER_BSAT )
+        ((sat_solver *)pThData->pSat->pSat)->random_seed = Seed;
+    // load the problem
+    for ( i = 0; i < pCnf->nVars; i++ )
+        Bmc_SolverAddVar( pThData->pSat );
+    for ( i = 0; i < pCnf->nClauses; i++ )
+        if ( !Bmc_SolverAddClause( pThData->pSat, pCnf->pClauses[i], pCnf->pClauses[i+1] - pCnf->pClauses[i] ) )
+            return 0;
+    // the odd configurations of MiniSat start with the positive phase
+    if ( (pThData->Variant & 1) && pThData->Type == BMC_SOLVER_BSAT )
+        for ( i = 0; i < pCnf->nVars; i++ )
+            ((sat_solver *)pThData->pSat->pSat)->polarity[i] = 1;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one round of the solver.]
+
+  Description [The solver imports the shared clauses and runs until the
+  conflict budget of the round is exhausted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_PfWorkerTask( void * pArg )
+{
+    Bmc_PfThData_t * pThData = (Bmc_PfThData_t *)pArg;
+    pThData->status = 0;
+    if ( pThData->p->fStop )
+        return;
+    if ( pThData->pSat == NULL && !Bmc_PfStartSolver(pThData) )
+    {
+        pThData->status = -1;
+        return;
+    }
+    if ( pThData->p->pPars->fShare && !Bmc_PfImport(pThData) )
+    {
+        pThData->status = -1;
+        return;
+    }
+    // the solver measures the time of the calling thread
+    if ( pThData->p->TimeLimit )
+    {
+        abctime TimeLeft = pThData->p->TimeLimit - Bmc_PfClock();
+        if ( TimeLeft <= 0 )
+            return;
+        Bmc_SolverSetRuntimeLimit( pThData->pSat, Abc_Clock() + TimeLeft );
+    }
+    Bmc_SolverSetConflictBudget( pThData->pSat, pThData->nBudget );
+    pThData->status = Bmc_SolverSolve( pThData->pSat, NULL, 0 );
+    pThData->nBudget = Abc_MinInt( BMC_PF_ROUND_MAX, pThData->nBudget + pThData->nBudget / 2 );
+    pThData->nRounds++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the CNF using the portfolio.]
+
+  Description [Returns 1 (SAT), -1 (UNSAT) or 0 (undecided). If the
+  problem is SAT, the satisfying assignment of the CNF variables is
+  returned in vModel, if this vector is given. The solvers are run by
+  the shared thread pool one round at a time and take turns in the
+  round-robin order, so that the portfolio can have more solvers than
+  there are threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PortfolioSolve( Cnf_Dat_t * pCnf, Bmc_PfPar_t * pPars, Vec_Int_t * vModel )
+{
+    abctime clkStart = Bmc_PfClock();
+    Bmc_PfMan_t * p = ABC_CALLOC( Bmc_PfMan_t, 1 );
+    Util_Job_t * pJob = Util_JobStart( Util_PoolGlobal() );
+    Vec_Int_t * vQueue = Vec_IntAlloc( BMC_PF_PROC_MAX );
+    Bmc_PfThData_t * pThData;
+    int i, k, nThreads = Util_PoolSize( Util_PoolGlobal() ), status = 0;
+    p->pPars  = pPars;
+    p->pCnf   = pCnf;
+    p->nProcs = Abc_MinInt( Abc_MaxInt(pPars->nProcs, 1), BMC_PF_PROC_MAX );
+    p->TimeLimit = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Bmc_PfClock() : 0;
+    p->nShareSize = Abc_MinInt( Abc_MaxInt(pPars->nShareSize, 1), 254 );
+    p->Ring.nSlotSize = p->nShareSize + 2;
+    p->Ring.pSeqs = ABC_CALLOC( word, (1 << BMC_PF_RING_LOG) );
+    p->Ring.pData = ABC_CALLOC( int, (1 << BMC_PF_RING_LOG) * p->Ring.nSlotSize );
+    pPars->Solver = -1;
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        pThData = p->ThData + i;
+        pThData->p       = p;
+        pThData->iThread = i;
+        pThData->Type    = s_PfTypes[i % 3];
+        pThData->Variant = i / 3;
+        pThData->nBudget = BMC_PF_ROUND_START;
+        Vec_IntPush( vQueue, i );
+    }
+    // start as many rounds as there are threads
+    for ( i = 0; i < nThreads && Vec_IntSize(vQueue) > 0; i++ )
+        Util_JobSubmit( pJob, Bmc_PfWorkerTask, p->ThData + Bmc_PfQueuePop(vQueue) );
+    // continue the undecided solvers until one of them finishes
+    while ( (pThData = (Bmc_PfThData_t *)Util_JobWaitNext(pJob)) )
+    {
+        if ( pThData->status != 0 )
+        {
+            status = pThData->status;
+            pPars->Solver = pThData->iThread;
+            break;
+        }
+        if ( p->TimeLimit && Bmc_PfClock() > p->TimeLimit )
+            continue;
+        if ( !pPars->nConfLimit || Bmc_SolverConflictNum(pThData->pSat) < pPars->nConfLimit )
+            Vec_IntPush( vQueue, pThData->iThread );
+        if ( Vec_IntSize(vQueue) > 0 )
+            Util_JobSubmit( pJob, Bmc_PfWorkerTask, p->ThData + Bmc_PfQueuePop(vQueue) );
+    }
+    p->fStop = 1;
+    Util_JobStop( pJob );
+    Vec_IntFree( vQueue );
+    // collect the satisfying assignment
+    if ( status == 1 && vModel )
+    {
+        pThData = p->ThData + pPars->Solver;
+        Vec_IntClear( vModel );
+        for ( i = 0; i < pCnf->nVars; i++ )
+            Vec_IntPush( vModel, Bmc_SolverVarValue(pThData->pSat, i) );
+    }
+    if ( pPars->fVerbose )
+    {
+        for ( i = 0; i < p->nProcs; i++ )
+        {
+            pThData = p->ThData + i;
+            printf( "Solver %2d : %-8s config %2d  Rounds = %5d  Conf = %10d  Exported = %8d  Imported = %8d%s\n",
+                i, Bmc_SolverTypeName(pThData->Type), pThData->Variant, pThData->nRounds,
+                pThData->pSat ? Bmc_SolverConflictNum(pThData->pSat) : 0, pThData->nExported, pThData->nImported,
+                i == pPars->Solver ? "  (finished first)" : "" );
+        }
+        printf( "Shared %.0f clauses using exchange buffer with %d slots.  ", (double)p->Ring.nWritten, 1 << BMC_PF_RING_LOG );
+        Abc_PrintTime( 1, "Time", Bmc_PfClock() - clkStart );
+    }
+    for ( k = 0; k < p->nProcs; k++ )
+        if ( p->ThData[k].pSat )
+            Bmc_SolverStop( p->ThData[k].pSat );
+    ABC_FREE( p->Ring.pSeqs );
+    ABC_FREE( p->Ring.pData );
+    ABC_FREE( p );
+    return status;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the satisfying assignment.]
+
+  Description [Returns the number of the first unsatisfied clause or -1.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PortfolioCheckModel( Cnf_Dat_t * pCnf, Vec_Int_t * vModel )
+{
+    int i, * pLit;
+    for ( i = 0; i < pCnf->nClauses; i++ )
+    {
+        for ( pLit = pCnf->pClauses[i]; pLit < pCnf->pClauses[i+1]; pLit++ )
+            if ( Vec_IntEntry(vModel, Abc_Lit2Var(*pLit)) != Abc_LitIsCompl(*pLit) )
+                break;
+        if ( pLit == pCnf->pClauses[i+1] )
+            return i;
+    }
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the result.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_PortfolioPrintResult( Bmc_PfPar_t * pPars, int status, abctime clk )
+{
+    printf( "%s", status == 1 ? "SATISFIABLE" : status == -1 ? "UNSATISFIABLE" : "UNDECIDED" );
+    if ( pPars->Solver >= 0 )
+        printf( " (solver %d)", pPars->Solver );
+    printf( "  " );
+    Abc_PrintTime( 1, "Time", Bmc_PfClock() - clk );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the CNF file using the portfolio.]
+
+  Description [Returns 1 (SAT), -1 (UNSAT) or 0 (undecided).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PortfolioSolveCnf( char * pFileName, Bmc_PfPar_t * pPars )
+{
+    abctime clk = Bmc_PfClock();
+    Cnf_Dat_t * pCnf = Cnf_DataReadFromFile( pFileName );
+    Vec_Int_t * vModel;
+    int status;
+    if ( pCnf == NULL )
+        return 0;
+    if ( pPars->fVerbose )
+    {
+        printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d. ", pCnf->nVars, pCnf->nClauses, pCnf->nLiterals );
+        Abc_PrintTime( 1, "Time", Bmc_PfClock() - clk );
+    }
+    vModel = Vec_IntAlloc( pCnf->nVars );
+    status = Bmc_PortfolioSolve( pCnf, pPars, vModel );
+    if ( status == 1 && Bmc_PortfolioCheckModel(pCnf, vModel) >= 0 )
+        printf( "The satisfying assignment does not satisfy clause %d.\n", Bmc_PortfolioCheckModel(pCnf, vModel) );
+    Bmc_PortfolioPrintResult( pPars, status, clk );
+    Vec_IntFree( vModel );
+    Cnf_DataFree( pCnf );
+    return status;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the combinational miter using the portfolio.]
+
+  Description [Checks whether any of the outputs can be 1. Returns 1
+  (SAT), -1 (UNSAT) or 0 (undecided). If the problem is SAT, the
+  counter-example is stored in p->pCexComb.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PortfolioSolveAig( Gia_Man_t * p, Bmc_PfPar_t * pPars )
+{
+    abctime clk = Bmc_PfClock();
+    Cnf_Dat_t * pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( p, 8, 0, 1, 0, 0 );
+    Vec_Int_t * vModel = Vec_IntAlloc( pCnf->nVars );
+    Gia_Obj_t * pObj;
+    int i, status;
+    if ( pPars->fVerbose )
+    {
+        printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d. ", pCnf->nVars, pCnf->nClauses, pCnf->nLiterals );
+        Abc_PrintTime( 1, "Time", Bmc_PfClock() - clk );
+    }
+    status = Bmc_PortfolioSolve( pCnf, pPars, vModel );
+    if ( status == 1 )
+    {
+        Abc_CexFreeP( &p->pCexComb );
+        p->pCexComb = Abc_CexAlloc( 0, Gia_ManCiNum(p), 1 );
+        Gia_ManForEachCi( p, pObj, i )
+            if ( pCnf->pVarNums[Gia_ObjId(p, pObj)] >= 0 && Vec_IntEntry(vModel, pCnf->pVarNums[Gia_ObjId(p, pObj)]) )
+                Abc_InfoSetBit( p->pCexComb->pData, i );
+    }
+    Bmc_PortfolioPrintResult( pPars, status, clk );
+    Vec_IntFree( vModel );
+    Cnf_DataFree( pCnf );
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,305 @@
+/**CFile****************************************************************
+
+  FileName    [bmcSolver.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Common interface to the incremental SAT solvers.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: bmcSolver.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "sat/bsat/satSolver.h"
+#include "sat/satoko/satoko.h"
+#include "sat/glucose/AbcGlucose.h"
+#include "sat/xsat/xsat.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// each solver is wrapped to have the same signatures; the literals are
+// 2*var+compl and the results are 1 (SAT), -1 (UNSAT) and 0 (undecided)
+
+// MiniSat-based solver
+static void *  Bmc_BsatStart()                                                  { return sat_solver_new();                                                  }
+static void    Bmc_BsatStop( void * s )                                         { sat_solver_delete( (sat_solver *)s );                                     }
+static void    Bmc_BsatReset( void * s )                                        { sat_solver_restart( (sat_solver *)s );                                    }
+static int     Bmc_BsatAddVar( void * s )                                       { return sat_solver_addvar( (sat_solver *)s );                              }
+static int     Bmc_BsatAddClause( void * s, int * pLits, int nLits )            { return sat_solver_addclause( (sat_solver *)s, pLits, pLits + nLits );     }
+static int     Bmc_BsatSolve( void * s, int * pLits, int nLits, int nConfs )    { return sat_solver_solve( (sat_solver *)s, pLits, pLits + nLits, (ABC_INT64_T)nConfs, 0, 0, 0 ); }
+static int     Bmc_BsatFinal( void * s, int ** ppLits )                         { return sat_solver_final( (sat_solver *)s, ppLits );                       }
+static int     Bmc_BsatVarValue( void * s, int iVar )                           { return sat_solver_var_value( (sat_solver *)s, iVar );                     }
+static void    Bmc_BsatBookmark( void * s )                                     { sat_solver_bookmark( (sat_solver *)s );                                   }
+static void    Bmc_BsatRollback( void * s )                                     { sat_solver_rollback( (sat_solver *)s );                                   }
+static void    Bmc_BsatSetStop( void * s, int * pStop )                         { sat_solver_set_stop( (sat_solver *)s, pStop );                            }
+static abctime Bmc_BsatSetRuntimeLimit( void * s, abctime Limit )               { return sat_solver_set_runtime_limit( (sat_solver *)s, Limit );            }
+static void    Bmc_BsatSetLearnt( void * s, void * pMan, Bmc_SolverLearnt_f f ) { sat_solver_set_learnt_func( (sat_solver *)s, pMan, f );                   }
+static int     Bmc_BsatVarNum( void * s )                                       { return sat_solver_nvars( (sat_solver *)s );                               }
+static int     Bmc_BsatConfNum( void * s )                                      { return sat_solver_nconflicts( (sat_solver *)s );                          }
+
+// Satoko
+static void *  Bmc_SatokoStart()                                                { return satoko_create();                                                   }
+static void    Bmc_SatokoStop( void * s )                                       { satoko_destroy( (satoko_t *)s );                                          }
+static void    Bmc_SatokoReset( void * s )                                      { satoko_reset( (satoko_t *)s );                                            }
+static int     Bmc_SatokoAddVar( void * s )                                     { return satoko_add_variable( (satoko_t *)s, 0 );                           }
+static int     Bmc_SatokoAddClause( void * s, int * pLits, int nLits )          { return satoko_add_clause( (satoko_t *)s, pLits, nLits );                  }
+static int     Bmc_SatokoSolve( void * s, int * pLits, int nLits, int nConfs )  { return satoko_solve_assumptions_limit( (satoko_t *)s, pLits, nLits, nConfs ); }
+static int     Bmc_SatokoFinal( void * s, int ** ppLits )                       { return satoko_final_conflict( (satoko_t *)s, ppLits );                    }
+static int     Bmc_SatokoVarValue( void * s, int iVar )                         { return satoko_read_cex_varvalue( (satoko_t *)s, iVar );                   }
+static void    Bmc_SatokoBookmark( void * s )                                   { satoko_bookmark( (satoko_t *)s );                                         }
+static void    Bmc_SatokoRollback( void * s )                                   { satoko_rollback( (satoko_t *)s );                                         }
+static void    Bmc_SatokoSetStop( void * s, int * pStop )                       { satoko_set_stop( (satoko_t *)s, pStop );                                  }
+static abctime Bmc_SatokoSetRuntimeLimit( void * s, abctime Limit )             { return satoko_set_runtime_limit( (satoko_t *)s, Limit );                  }
+static void    Bmc_SatokoSetLearnt( void * s, void * pMan, Bmc_SolverLearnt_f f ) { satoko_set_learnt_func( (satoko_t *)s, pMan, f );                     }
+static int     Bmc_SatokoVarNum( void * s )                                     { return satoko_varnum( (satoko_t *)s );                                    }
+static int     Bmc_SatokoConfNum( void * s )                                    { return satoko_conflictnum( (satoko_t *)s );                               }
+
+// Glucose 3.0 (does not support rollback)
+static void *  Bmc_GlucoseStart()                                               { return bmcg_sat_solver_start();                                           }
+static void    Bmc_GlucoseStop( void * s )                                      { bmcg_sat_solver_stop( (bmcg_sat_solver *)s );                             }
+static void    Bmc_GlucoseReset( void * s )                                     { bmcg_sat_solver_reset( (bmcg_sat_solver *)s );                            }
+static int     Bmc_GlucoseAddVar( void * s )                                    { return bmcg_sat_solver_addvar( (bmcg_sat_solver *)s );                    }
+static int     Bmc_GlucoseAddClause( void * s, int * pLits, int nLits )         { return bmcg_sat_solver_addclause( (bmcg_sat_solver *)s, pLits, nLits );   }
+static int     Bmc_GlucoseSolve( void * s, int * pLits, int nLits, int nConfs ) { bmcg_sat_solver_set_conflict_budget( (bmcg_sat_solver *)s, nConfs ); return bmcg_sat_solver_solve( (bmcg_sat_solver *)s, pLits, nLits ); }
+static int     Bmc_GlucoseFinal( void * s, int ** ppLits )                      { return bmcg_sat_solver_final( (bmcg_sat_solver *)s, ppLits );             }
+static int     Bmc_GlucoseVarValue( void * s, int iVar )                        { return bmcg_sat_solver_read_cex_varvalue( (bmcg_sat_solver *)s, iVar );   }
+static void    Bmc_GlucoseSetStop( void * s, int * pStop )                      { bmcg_sat_solver_set_stop( (bmcg_sat_solver *)s, pStop );                  }
+static abctime Bmc_GlucoseSetRuntimeLimit( void * s, abctime Limit )            { return bmcg_sat_solver_set_runtime_limit( (bmcg_sat_solver *)s, Limit );  }
+static void    Bmc_GlucoseSetLearnt( void * s, void * pMan, Bmc_SolverLearnt_f f ) { bmcg_sat_solver_set_learnt_func( (bmcg_sat_solver *)s, pMan, f );    }
+static int     Bmc_GlucoseVarNum( void * s )                                    { return bmcg_sat_solver_varnum( (bmcg_sat_solver *)s );                    }
+static int     Bmc_GlucoseConfNum( void * s )                                   { return bmcg_sat_solver_conflictnum( (bmcg_sat_solver *)s );               }
+
+// xSAT (does not support reset, rollback, and reporting learned clauses)
+static void *  Bmc_XsatStart()                                                  { xSAT_Solver_t * s = xSAT_SolverCreate(); xSAT_SolverSetVerbose( s, 0 ); return s; }
+static void    Bmc_XsatStop( void * s )                                         { xSAT_SolverDestroy( (xSAT_Solver_t *)s );                                 }
+static int     Bmc_XsatAddVar( void * s )                                       { return xSAT_SolverAddVariable( (xSAT_Solver_t *)s, 1 );                   }
+static int     Bmc_XsatAddClause( void * s, int * pLits, int nLits )            { return xSAT_SolverAddClauseArray( (xSAT_Solver_t *)s, pLits, nLits );     }
+static int     Bmc_XsatSolve( void * s, int * pLits, int nLits, int nConfs )    { return xSAT_SolverSolveAssumptions( (xSAT_Solver_t *)s, pLits, nLits, nConfs ); }
+static int     Bmc_XsatFinal( void * s, int ** ppLits )                         { return xSAT_SolverFinal( (xSAT_Solver_t *)s, ppLits );                    }
+static int     Bmc_XsatVarValue( void * s, int iVar )                           { return xSAT_SolverReadVarValue( (xSAT_Solver_t *)s, iVar );               }
+static void    Bmc_XsatSetStop( void * s, int * pStop )                         { xSAT_SolverSetStop( (xSAT_Solver_t *)s, pStop );                          }
+static abctime Bmc_XsatSetRuntimeLimit( void * s, abctime Limit )               { return xSAT_SolverSetRuntimeLimit( (xSAT_Solver_t *)s, Limit );           }
+static int     Bmc_XsatVarNum( void * s )                                       { return xSAT_SolverVarNum( (xSAT_Solver_t *)s );                           }
+static int     Bmc_XsatConfNum( void * s )                                      { return xSAT_SolverConflictNum( (xSAT_Solver_t *)s );                      }
+
+// the table of solvers indexed by Bmc_SolverType_t
+static Bmc_SolverVt_t s_BmcSolvers[BMC_SOLVER_NONE] =
+{
+    { "bsat",    Bmc_BsatStart,    Bmc_BsatStop,    Bmc_BsatReset,    Bmc_BsatAddVar,    Bmc_BsatAddClause,    Bmc_BsatSolve,    Bmc_BsatFinal,    Bmc_BsatVarValue,
+      Bmc_BsatBookmark,   Bmc_BsatRollback,   Bmc_BsatSetStop,    Bmc_BsatSetRuntimeLimit,    Bmc_BsatSetLearnt,    Bmc_BsatVarNum,    Bmc_BsatConfNum    },
+    { "satoko",  Bmc_SatokoStart,  Bmc_SatokoStop,  Bmc_SatokoReset,  Bmc_SatokoAddVar,  Bmc_SatokoAddClause,  Bmc_SatokoSolve,  Bmc_SatokoFinal,  Bmc_SatokoVarValue,
+      Bmc_SatokoBookmark, Bmc_SatokoRollback, Bmc_SatokoSetStop,  Bmc_SatokoSetRuntimeLimit,  Bmc_SatokoSetLearnt,  Bmc_SatokoVarNum,  Bmc_SatokoConfNum  },
+    { "glucose", Bmc_GlucoseStart, Bmc_GlucoseStop, Bmc_GlucoseReset, Bmc_GlucoseAddVar, Bmc_GlucoseAddClause, Bmc_GlucoseSolve, Bmc_GlucoseFinal, Bmc_GlucoseVarValue,
+      NULL,               NULL,               Bmc_GlucoseSetStop, Bmc_GlucoseSetRuntimeLimit, Bmc_GlucoseSetLearnt, Bmc_GlucoseVarNum, Bmc_GlucoseConfNum },
+    { "xsat",    Bmc_XsatStart,    Bmc_XsatStop,    NULL,             Bmc_XsatAddVar,    Bmc_XsatAddClause,    Bmc_XsatSolve,    Bmc_XsatFinal,    Bmc_XsatVarValue,
+      NULL,               NULL,               Bmc_XsatSetStop,    Bmc_XsatSetRuntimeLimit,    NULL,                 Bmc_XsatVarNum,    Bmc_XsatConfNum    }
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the solver name used by "-S <solver>" into its type.]
+
+  Description [Returns BMC_SOLVER_NONE if the name is not known.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_SolverTypeFromName( char * pName )
+{
+    int i;
+    for ( i = 0; i < BMC_SOLVER_NONE; i++ )
+        if ( !strcmp(pName, s_BmcSolvers[i].pName) )
+            return i;
+    return BMC_SOLVER_NONE;
+}
+char * Bmc_SolverTypeName( int Type )
+{
+    assert( Type >= 0 && Type < BMC_SOLVER_NONE );
+    return s_BmcSolvers[Type].pName;
+}
+char * Bmc_SolverTypeNames()
+{
+    return "bsat, satoko, glucose, xsat";
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the solver.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_Solver_t * Bmc_SolverStart( int Type )
+{
+    Bmc_Solver_t * p;
+    assert( Type >= 0 && Type < BMC_SOLVER_NONE );
+    p = ABC_CALLOC( Bmc_Solver_t, 1 );
+    p->pVt  = s_BmcSolvers + Type;
+    p->Type = Type;
+    p->pSat = p->pVt->pFuncStart();
+    return p;
+}
+void Bmc_SolverStop( Bmc_Solver_t * p )
+{
+    p->pVt->pFuncStop( p->pSat );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes all variables and clauses.]
+
+  Description [The solvers without the reset procedure are recreated.
+  The conflict budget, the stop flag, and the learned clause callback
+  are preserved.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_SolverReset( Bmc_Solver_t * p )
+{
+    if ( p->pVt->pFuncReset )
+        p->pVt->pFuncReset( p->pSat );
+    else
+    {
+        p->pVt->pFuncStop( p->pSat );
+        p->pSat = p->pVt->pFuncStart();
+    }
+    if ( p->pStop )
+        p->pVt->pFuncSetStop( p->pSat, p->pStop );
+    if ( p->pLearntFunc )
+        p->pVt->pFuncSetLearnt( p->pSat, p->pLearntMan, p->pLearntFunc );
+    p->fUnsat = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem under assumptions.]
+
+  Description [Returns 1 (SAT), -1 (UNSAT) or 0 (undecided) if the
+  conflict budget is exhausted or the stop flag is raised.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_SolverSolve( Bmc_Solver_t * p, int * pLits, int nLits )
+{
+    int status, * pFinal;
+    if ( p->fUnsat )
+        return -1;
+    status = p->pVt->pFuncSolve( p->pSat, pLits, nLits, p->nConfLimit );
+    // UNSAT with the empty final conflict does not depend on the assumptions
+    if ( status == -1 && p->pVt->pFuncFinal( p->pSat, &pFinal ) == 0 )
+        p->fUnsat = 1;
+    return status;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Setting the limits.]
+
+  Description [The conflict budget applies to each call of the solver
+  (0 means no limit).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_SolverSetConflictBudget( Bmc_Solver_t * p, int nConfLimit )
+{
+    p->nConfLimit = nConfLimit;
+}
+void Bmc_SolverSetStop( Bmc_Solver_t * p, int * pStop )
+{
+    p->pStop = pStop;
+    p->pVt->pFuncSetStop( p->pSat, pStop );
+}
+abctime Bmc_SolverSetRuntimeLimit( Bmc_Solver_t * p, abctime Limit )
+{
+    return p->pVt->pFuncSetRuntimeLimit( p->pSat, Limit );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the procedure called for each learned clause.]
+
+  Description [The procedure is called from the search (possibly, in
+  another thread) with the literals of the learned clause, the asserting
+  literal first. The clause is implied by the clauses of the solver
+  regardless of the assumptions. Should be called only if
+  Bmc_SolverCanShare() is 1.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_SolverSetLearnt( Bmc_Solver_t * p, void * pMan, Bmc_SolverLearnt_f pFunc )
+{
+    assert( Bmc_SolverCanShare(p) );
+    p->pLearntMan  = pMan;
+    p->pLearntFunc = pFunc;
+    p->pVt->pFuncSetLearnt( p->pSat, pMan, pFunc );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bookmarking the state of the solver.]
+
+  Description [Rollback removes the variables and clauses added after
+  the bookmark. Should be called only if Bmc_SolverCanRollback() is 1.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_SolverBookmark( Bmc_Solver_t * p )
+{
+    assert( Bmc_SolverCanRollback(p) );
+    p->pVt->pFuncBookmark( p->pSat );
+    p->fUnsatMark = p->fUnsat;
+}
+void Bmc_SolverRollback( Bmc_Solver_t * p )
+{
+    assert( Bmc_SolverCanRollback(p) );
+    p->pVt->pFuncRollback( p->pSat );
+    p->fUnsat = p->fUnsatMark;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -132,6 +132,17 @@ int sat_solver_get_var_value(sat_solver* s, int v)
 static inline int      sat_solver_dl(sat_solver* s)                { return veci_size(&s->trail_lim); }
 static inline veci*    sat_solver_read_wlist(sat_solver* s, lit l) { return &s->wlists[l];            }
 
+// the watch lists mix two kinds of entries: a 2-literal clause is one odd entry
+// holding the other literal, while a longer clause is an even handle followed
+// by a blocker literal, which is checked before the clause is dereferenced
+static inline void     sat_solver_watch_push(sat_solver* s, lit l, cla h, lit blocker)
+{
+    veci* ws = sat_solver_read_wlist(s, l);
+    veci_push(ws, h);
+    veci_push(ws, blocker);
+}
+static inline int      sat_solver_watch_size(cla h)                { return clause_is_lit(h) ? 1 : 2;     }
+
 //=================================================================================================
 // Variable order functions:
 
@@ -569,8 +580,16 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
 
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),c);
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),c);
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(size > 2 ? h : clause_from_lit(begin[1])));
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(size > 2 ? h : clause_from_lit(begin[0])));
+    if ( size > 2 )
+    {
+        sat_solver_watch_push(s, lit_neg(begin[0]), h, begin[1]);
+        sat_solver_watch_push(s, lit_neg(begin[1]), h, begin[0]);
+    }
+    else
+    {
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(clause_from_lit(begin[1])));
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(clause_from_lit(begin[0])));
+    }
 
     return h;
 }
@@ -704,6 +723,9 @@ static void sat_solver_record(sat_solver* s, veci* cls)
     assert(veci_size(cls) > 0);
     if ( h == 0 )
         veci_push( &s->unit_lits, *begin );
+    // report the clause (the LBD is not computed and its upper bound is used)
+    if ( s->pLearntFunc )
+        s->pLearntFunc( s->pLearntMan, begin, veci_size(cls), veci_size(cls) );
 
     ///////////////////////////////////
     // add clause to internal storage
@@ -1059,9 +1081,20 @@ int sat_solver_propagate(sat_solver* s)
                     while (i < end)
                         *j++ = *i++;
                 }
+                else
+                    i++;
             }else{
 
-                clause* c = clause_read(s,*i);
+                clause* c;
+                lit Blocker = i[1];
+                // If the blocker is true, the clause is satisfied and need not be visited.
+                if (var_value(s, lit_var(Blocker)) == lit_sign(Blocker)){
+                    *j++ = *i++;
+                    *j++ = *i++;
+                    continue;
+                }
+
+                c = clause_read(s,*i);
                 lits = clause_begin(c);
 
                 // Make sure the false literal is data[1]:
@@ -1073,8 +1106,10 @@ int sat_solver_propagate(sat_solver* s)
                 assert(lits[1] == false_lit);
 
                 // If 0th watch is true, then clause is already satisfied.
-                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0]))
+                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0])){
                     *j++ = *i;
+                    *j++ = lits[0];
+                }
                 else{
                     // Look for new watch:
                     lit* stop = lits + clause_size(c);
@@ -1083,24 +1118,27 @@ int sat_solver_propagate(sat_solver* s)
                         if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
                             lits[1] = *k;
                             *k = false_lit;
-                            veci_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i);
+                            sat_solver_watch_push(s, lit_neg(lits[1]), *i, lits[0]);
                             goto next; }
                     }
 
                     *j++ = *i;
+                    *j++ = lits[0];
                     // Clause is unit under assignment:
                     if ( c->lrn )
                         c->lbd = sat_clause_compute_lbd(s, c);
                     if (!sat_solver_enqueue(s,lits[0], *i)){
-                        hConfl = *i++;
+                        hConfl = *i;
+                        i += 2;
                         // Copy the remaining watches:
                         while (i < end)
                             *j++ = *i++;
+                        continue;
                     }
                 }
+            next:
+                i += 2;
             }
-        next:
-            i++;
         }
 
         s->stats.inspects += j - veci_begin(ws);
@@ -1510,7 +1548,7 @@ void sat_solver_reducedb(sat_solver* s)
     int nLearnedOld = veci_size(&s->act_clas);
     int * act_clas = veci_begin(&s->act_clas);
     int * pPerm, * pArray, * pSortValues, nCutoffValue;
-    int i, k, j, Id, Counter, CounterStart, nSelected;
+    int i, k, j, Id, Counter, CounterStart, nSelected, nStep;
     clause * c;
 
     assert( s->nLearntMax > 0 );
@@ -1590,17 +1628,24 @@ void sat_solver_reducedb(sat_solver* s)
     for ( i = 0; i < s->size*2; i++ )
     {
         pArray = veci_begin(&s->wlists[i]);
-        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k += nStep )
         {
+            nStep = sat_solver_watch_size(pArray[k]); // read before pArray[k] is overwritten
             if ( clause_is_lit(pArray[k]) ) // 2-lit clause
                 pArray[j++] = pArray[k];
             else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[k+1];
+            }
             else 
             {
                 c = clause_read(s, pArray[k]);
                 if ( !c->mark ) // useful learned clause
+                {
                    pArray[j++] = clause_id(c); // updating handle here!!!
+                   pArray[j++] = pArray[k+1];
+                }
             }
         }
         veci_resize(&s->wlists[i],j);
@@ -1625,7 +1670,7 @@ void sat_solver_reducedb(sat_solver* s)
 void sat_solver_rollback( sat_solver* s )
 {
     Sat_Mem_t * pMem = &s->Mem;
-    int i, k, j;
+    int i, k, j, nStep;
     static int Count = 0;
     Count++;
     assert( s->iVarPivot >= 0 && s->iVarPivot <= s->size );
@@ -1653,16 +1698,20 @@ void sat_solver_rollback( sat_solver* s )
     // compact watches
     for ( i = 0; i < s->iVarPivot*2; i++ )
     {
-        cla* pArray = veci_begin(&s->wlists[i]);
-        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        cla* pArray = veci_begin(&s->wlists[i]);
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k += nStep )
         {
+            nStep = sat_solver_watch_size(pArray[k]); // read before pArray[k] is overwritten
             if ( clause_is_lit(pArray[k]) )
             {
                 if ( clause_read_lit(pArray[k]) < s->iVarPivot*2 )
                     pArray[j++] = pArray[k];
             }
-            else if ( Sat_MemClauseUsed(pMem, pArray[k]) )
+            else if ( Sat_MemClauseUsed(pMem, pArray[k]) )
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[k+1];
+            }
         }
         veci_resize(&s->wlists[i],j);
     }
@@ -1966,6 +2015,8 @@ int sat_solver_solve_internal(sat_solver* s)
             break;
         if ( s->pFuncStop && s->pFuncStop(s->RunId) )
             break;
+        if ( s->pStop && *s->pStop )
+            break;
     }
     if (s->verbosity >= 1)
         printf("==============================================================================\n");
@@ -205,6 +205,11 @@ struct sat_solver_t
     // termination callback
     int         RunId;          // SAT id in this run
     int(*pFuncStop)(int);       // callback to terminate
+    int *       pStop;          // external flag to terminate
+
+    // learned clause callback
+    void *      pLearntMan;     // external manager
+    void(*pLearntFunc)(void * p, int * pLits, int nLits, int Lbd); // called for each learned clause
 };
 
 static inline clause * clause_read( sat_solver * s, cla h )          
@@ -338,6 +343,15 @@ static void sat_solver_set_stop_func( sat_solver *s, int (*fnct)(int) )
 { 
     s->pFuncStop = fnct; 
 }
+static void sat_solver_set_stop( sat_solver *s, int * pStop ) 
+{ 
+    s->pStop = pStop; 
+}
+static void sat_solver_set_learnt_func( sat_solver *s, void * pMan, void (*fnct)(void *, int *, int, int) ) 
+{ 
+    s->pLearntMan  = pMan; 
+    s->pLearntFunc = fnct; 
+}
 
 static inline int sat_solver_add_const( sat_solver * pSat, int iVar, int fCompl )
 {
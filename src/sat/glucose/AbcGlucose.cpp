@@ -218,6 +218,26 @@ void bmcg_sat_solver_set_stop(bmcg_sat_solver* s, int * pstop)
     glucose_solver_setstop((Gluco::SimpSolver*)s, pstop);
 }
 
+void bmcg_sat_solver_set_learnt_func(bmcg_sat_solver* s, void * pman, void(*pfunc)(void*, int*, int, int))
+{
+    ((Gluco::SimpSolver*)s)->pLearntMan  = pman;
+    ((Gluco::SimpSolver*)s)->pLearntFunc = pfunc;
+}
+
+void bmcg_sat_solver_set_random(bmcg_sat_solver* s, int seed, int fRndPol)
+{
+    ((Gluco::SimpSolver*)s)->random_seed     = (double)seed;
+    ((Gluco::SimpSolver*)s)->random_var_freq = 0.01;
+    ((Gluco::SimpSolver*)s)->rnd_init_act    = true;
+    ((Gluco::SimpSolver*)s)->rnd_pol         = fRndPol != 0;
+}
+
+void bmcg_sat_solver_set_restarts(bmcg_sat_solver* s, double K, double R)
+{
+    ((Gluco::SimpSolver*)s)->K = K;
+    ((Gluco::SimpSolver*)s)->R = R;
+}
+
 abctime bmcg_sat_solver_set_runtime_limit(bmcg_sat_solver* s, abctime Limit)
 {
     abctime nRuntimeLimit = ((Gluco::SimpSolver*)s)->nRuntimeLimit;
@@ -480,6 +500,26 @@ void bmcg_sat_solver_set_stop(bmcg_sat_solver* s, int * pstop)
     glucose_solver_setstop((Gluco::Solver*)s, pstop);
 }
 
+void bmcg_sat_solver_set_learnt_func(bmcg_sat_solver* s, void * pman, void(*pfunc)(void*, int*, int, int))
+{
+    ((Gluco::Solver*)s)->pLearntMan  = pman;
+    ((Gluco::Solver*)s)->pLearntFunc = pfunc;
+}
+
+void bmcg_sat_solver_set_random(bmcg_sat_solver* s, int seed, int fRndPol)
+{
+    ((Gluco::Solver*)s)->random_seed     = (double)seed;
+    ((Gluco::Solver*)s)->random_var_freq = 0.01;
+    ((Gluco::Solver*)s)->rnd_init_act    = true;
+    ((Gluco::Solver*)s)->rnd_pol         = fRndPol != 0;
+}
+
+void bmcg_sat_solver_set_restarts(bmcg_sat_solver* s, double K, double R)
+{
+    ((Gluco::Solver*)s)->K = K;
+    ((Gluco::Solver*)s)->R = R;
+}
+
 abctime bmcg_sat_solver_set_runtime_limit(bmcg_sat_solver* s, abctime Limit)
 {
     abctime nRuntimeLimit = ((Gluco::Solver*)s)->nRuntimeLimit;
@@ -86,6 +86,9 @@ extern int               bmcg_sat_solver_elim_varnum(bmcg_sat_solver* s);
 extern int               bmcg_sat_solver_read_cex_varvalue( bmcg_sat_solver* s, int );
 extern void              bmcg_sat_solver_set_stop( bmcg_sat_solver* s, int * pstop );
 extern abctime           bmcg_sat_solver_set_runtime_limit( bmcg_sat_solver* s, abctime Limit );
+extern void              bmcg_sat_solver_set_learnt_func( bmcg_sat_solver* s, void * pman, void(*pfunc)(void*, int*, int, int) );
+extern void              bmcg_sat_solver_set_random( bmcg_sat_solver* s, int seed, int fRndPol );
+extern void              bmcg_sat_solver_set_restarts( bmcg_sat_solver* s, double K, double R );
 extern void              bmcg_sat_solver_set_conflict_budget( bmcg_sat_solver* s, int Limit );
 extern int               bmcg_sat_solver_varnum( bmcg_sat_solver* s );
 extern int               bmcg_sat_solver_clausenum( bmcg_sat_solver* s );
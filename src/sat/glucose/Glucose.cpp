@@ -99,6 +99,8 @@ Solver::Solver() :
     , terminate_search_early(false)
     , pstop(NULL)
     , nRuntimeLimit(0)
+    , pLearntMan(NULL)
+    , pLearntFunc(NULL)
 
     , verbosity      (0)
     , verbEveryConflicts(10000)
@@ -1076,6 +1078,9 @@ lbool Solver::search(int nof_conflicts)
  
             cancelUntil(backtrack_level);
 
+            if (pLearntFunc)
+                pLearntFunc(pLearntMan, (int *)(Lit *)learnt_clause, learnt_clause.size(), nblevels);
+
             if (certifiedUNSAT) {
               for (int i = 0; i < learnt_clause.size(); i++)
                 fprintf(certifiedOutput, "%i " , (var(learnt_clause[i]) + 1) *
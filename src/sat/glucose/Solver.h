@@ -63,6 +63,8 @@ public:
     uint64_t nRuntimeLimit;              // runtime limit
     vec<int> user_vec;
     vec<Lit> user_lits;
+    void * pLearntMan;                   // external manager of learned clauses
+    void(*pLearntFunc)(void * p, int*, int, int); // called for each learned clause (literals, their number, LBD)
 
     // Problem specification:
     //
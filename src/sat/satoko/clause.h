@@ -19,7 +19,9 @@ struct clause {
 	unsigned f_mark      : 1;
 	unsigned f_reallocd  : 1;
 	unsigned f_deletable : 1;
-	unsigned lbd : 28;
+	unsigned f_used      : 1; /* Took part in a conflict since the last reduction */
+	unsigned f_vivified  : 1;
+	unsigned lbd : 26;
 	unsigned size;
 	union {
 		unsigned lit;
@@ -0,0 +1,598 @@
+//===--- inproc.c -----------------------------------------------------------===
+//
+//                     satoko: Satisfiability solver
+//
+// This file is distributed under the BSD 2-Clause License.
+// See LICENSE for details.
+//
+//===------------------------------------------------------------------------===
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+#include "solver.h"
+#include "utils/mem.h"
+#include "utils/misc.h"
+
+#include "misc/util/abc_global.h"
+ABC_NAMESPACE_IMPL_START
+
+/**
+ *  Inprocessing runs at decision level 0 between restarts, once every
+ *  'inproc_conf' conflicts (the interval grows slowly with the number of
+ *  rounds). A round applies backward subsumption, vivification of the tier-2
+ *  learnt clauses and, if enabled, bounded variable elimination (BVE). Each
+ *  step has a budget proportional to the number of conflicts since the
+ *  previous round.
+ *
+ *  To remain compatible with satoko_rollback(), when a bookmark is active
+ *  only the clauses added after it are strengthened or deleted, and only the
+ *  variables created after it are eliminated. The clauses removed by BVE are
+ *  kept on a stack, which is used to extend the model and to restore a
+ *  variable when it reappears in a new clause or in an assumption.
+ */
+
+//===------------------------------------------------------------------------===
+// Inprocessing internal functions
+//===------------------------------------------------------------------------===
+static inline void inproc_clause_remove(solver_t *s, unsigned cref, int f_watched)
+{
+	struct clause *clause = clause_fetch(s, cref);
+
+	assert(clause->f_mark == 0);
+	if (f_watched)
+		clause_unwatch(s, cref);
+	if (clause->f_learnt)
+		s->stats.n_learnt_lits -= clause->size;
+	else
+		s->stats.n_original_lits -= clause->size;
+	clause->f_mark = 1;
+	cdb_remove(s->all_clauses, clause);
+}
+
+/* Replaces the literals of an (unwatched) clause by a subset of them */
+static inline void inproc_clause_shrink(solver_t *s, unsigned cref, vec_uint_t *lits)
+{
+	struct clause *clause = clause_fetch(s, cref);
+	unsigned size = vec_uint_size(lits);
+	unsigned n_removed = clause->size - size;
+
+	assert(size > 1 && size < clause->size);
+	if (clause->f_learnt) {
+		clause_act_t act = clause->data[clause->size].act;
+		memcpy(&(clause->data[0].lit), vec_uint_data(lits), sizeof(unsigned) * size);
+		clause->data[size].act = act;
+		if (clause->lbd > size)
+			clause->lbd = size;
+		s->stats.n_learnt_lits -= n_removed;
+	} else {
+		memcpy(&(clause->data[0].lit), vec_uint_data(lits), sizeof(unsigned) * size);
+		s->stats.n_original_lits -= n_removed;
+	}
+	clause->size = size;
+	s->all_clauses->wasted += n_removed;
+}
+
+/* Removes the deleted clauses from a clause vector (starting at a bookmark) */
+static inline void inproc_compact(solver_t *s, vec_uint_t *crefs, unsigned start)
+{
+	unsigned i, j = start, cref;
+
+	vec_uint_foreach_start(crefs, cref, i, start)
+		if (!clause_fetch(s, cref)->f_mark)
+			vec_uint_assign(crefs, j++, cref);
+	vec_uint_shrink(crefs, j);
+}
+
+static inline int inproc_add_unit(solver_t *s, unsigned lit)
+{
+	assert(solver_dlevel(s) == 0);
+	if (lit_value(s, lit) == SATOKO_LIT_TRUE)
+		return SATOKO_OK;
+	if (lit_value(s, lit) == SATOKO_LIT_FALSE)
+		return SATOKO_ERR;
+	solver_enqueue(s, lit, UNDEF);
+	return solver_propagate(s) == UNDEF ? SATOKO_OK : SATOKO_ERR;
+}
+
+/* Adds an original clause at level 0, returns its cref or UNDEF if it was
+ * satisfied or unit. Sets '*status' to SATOKO_ERR on a conflict. */
+static inline unsigned inproc_add_clause(solver_t *s, vec_uint_t *lits, int *status)
+{
+	unsigned i, j, lit, cref;
+
+	for (i = j = 0; i < vec_uint_size(lits); i++) {
+		lit = vec_uint_at(lits, i);
+		if (lit_value(s, lit) == SATOKO_LIT_TRUE)
+			return UNDEF;
+		if (lit_value(s, lit) != SATOKO_LIT_FALSE)
+			vec_uint_assign(lits, j++, lit);
+	}
+	vec_uint_shrink(lits, j);
+	if (j == 0) {
+		*status = SATOKO_ERR;
+		return UNDEF;
+	}
+	if (j == 1) {
+		*status = inproc_add_unit(s, vec_uint_at(lits, 0));
+		return UNDEF;
+	}
+	cref = solver_clause_create(s, lits, 0);
+	clause_watch(s, cref);
+	return cref;
+}
+
+static inline int inproc_lit_model(solver_t *s, unsigned lit)
+{
+	unsigned var = lit2var(lit);
+	char value = var_value(s, var);
+
+	if (value == SATOKO_VAR_UNASSING)
+		value = satoko_var_polarity(s, var);
+	return lit_polarity(lit) == value;
+}
+
+//===------------------------------------------------------------------------===
+// Backward subsumption
+//===------------------------------------------------------------------------===
+/**
+ *  Deletes the clauses added after the bookmark that contain another clause.
+ *  An original clause is only deleted when it is subsumed by another original
+ *  one. The occurrence lists are built for the candidates only, and every
+ *  clause looks for its supersets in the shortest list among its literals.
+ */
+static void inproc_subsume(solver_t *s, long budget)
+{
+	unsigned n_lits = 2 * vec_char_size(s->assigns);
+	unsigned *occ_beg = satoko_calloc(unsigned, n_lits + 1);
+	unsigned *lit_stamp = satoko_calloc(unsigned, n_lits);
+	unsigned *occs, stamp = 0;
+	unsigned i, j, k, cref;
+	vec_uint_t *cands = vec_uint_alloc(0);
+	vec_uint_t *lists[2];
+	long n_steps = 0;
+
+	lists[0] = s->originals;
+	lists[1] = s->learnts;
+	vec_uint_foreach_start(s->originals, cref, i, s->book_cl_orig)
+		vec_uint_push_back(cands, cref);
+	vec_uint_foreach_start(s->learnts, cref, i, s->book_cl_lrnt)
+		vec_uint_push_back(cands, cref);
+
+	/* Occurrence lists of the candidates */
+	vec_uint_foreach(cands, cref, i) {
+		struct clause *clause = clause_fetch(s, cref);
+		for (j = 0; j < clause->size; j++)
+			occ_beg[clause->data[j].lit + 1]++;
+	}
+	for (i = 0; i < n_lits; i++)
+		occ_beg[i + 1] += occ_beg[i];
+	occs = satoko_alloc(unsigned, occ_beg[n_lits] + 1);
+	vec_uint_foreach(cands, cref, i) {
+		struct clause *clause = clause_fetch(s, cref);
+		for (j = 0; j < clause->size; j++)
+			occs[occ_beg[clause->data[j].lit]++] = cref;
+	}
+	for (i = n_lits; i > 0; i--)
+		occ_beg[i] = occ_beg[i - 1];
+	occ_beg[0] = 0;
+
+	for (k = 0; k < 2 && n_steps < budget; k++) {
+		vec_uint_foreach(lists[k], cref, i) {
+			struct clause *clause = clause_fetch(s, cref);
+			unsigned best = UNDEF;
+
+			if (n_steps >= budget)
+				break;
+			if (clause->f_mark)
+				continue;
+			for (j = 0; j < clause->size; j++) {
+				unsigned lit = clause->data[j].lit;
+				if (best == UNDEF || occ_beg[lit + 1] - occ_beg[lit] < occ_beg[best + 1] - occ_beg[best])
+					best = lit;
+			}
+			if (occ_beg[best + 1] == occ_beg[best])
+				continue;
+			stamp++;
+			for (j = 0; j < clause->size; j++)
+				lit_stamp[clause->data[j].lit] = stamp;
+			for (j = occ_beg[best]; j < occ_beg[best + 1]; j++) {
+				struct clause *other = clause_fetch(s, occs[j]);
+				unsigned l, n_common = 0;
+
+				if (occs[j] == cref || other->f_mark || other->size < clause->size)
+					continue;
+				if (clause->f_learnt && !other->f_learnt)
+					continue;
+				for (l = 0; l < other->size; l++)
+					n_common += (lit_stamp[other->data[l].lit] == stamp);
+				n_steps += other->size;
+				if (n_common < clause->size)
+					continue;
+				if (clause->f_learnt && other->lbd < clause->lbd)
+					clause->lbd = other->lbd;
+				inproc_clause_remove(s, occs[j], 1);
+				s->stats.n_subsumed++;
+			}
+		}
+	}
+	vec_uint_free(cands);
+	satoko_free(occs);
+	satoko_free(occ_beg);
+	satoko_free(lit_stamp);
+}
+
+//===------------------------------------------------------------------------===
+// Vivification
+//===------------------------------------------------------------------------===
+/**
+ *  The clause is detached and the negations of its literals are propagated
+ *  one by one. A literal found false is redundant; a literal found true, or
+ *  a conflict, means the literals assigned so far already form the clause.
+ */
+static int inproc_vivify_clause(solver_t *s, unsigned cref, vec_uint_t *lits)
+{
+	struct clause *clause = clause_fetch(s, cref);
+	unsigned i, lit, size = clause->size;
+	int f_sat = 0;
+
+	clause_unwatch(s, cref);
+	vec_uint_clear(lits);
+	for (i = 0; i < size; i++) {
+		lit = clause->data[i].lit;
+		if (lit_value(s, lit) == SATOKO_LIT_TRUE) {
+			if (lit_dlevel(s, lit) == 0)
+				f_sat = 1;
+			else
+				vec_uint_push_back(lits, lit);
+			break;
+		}
+		if (lit_value(s, lit) == SATOKO_LIT_FALSE)
+			continue;
+		vec_uint_push_back(lits, lit);
+		vec_uint_push_back(s->trail_lim, vec_uint_size(s->trail));
+		solver_enqueue(s, lit_compl(lit), UNDEF);
+		if (solver_propagate(s) != UNDEF)
+			break;
+	}
+	solver_cancel_until(s, 0);
+
+	if (f_sat) {
+		inproc_clause_remove(s, cref, 0);
+		return SATOKO_OK;
+	}
+	if (vec_uint_size(lits) == size) {
+		clause_watch(s, cref);
+		return SATOKO_OK;
+	}
+	s->stats.n_vivified++;
+	s->stats.n_vivified_lits += size - vec_uint_size(lits);
+	if (vec_uint_size(lits) == 0)
+		return SATOKO_ERR;
+	if (vec_uint_size(lits) == 1) {
+		inproc_clause_remove(s, cref, 0);
+		return inproc_add_unit(s, vec_uint_at(lits, 0));
+	}
+	inproc_clause_shrink(s, cref, lits);
+	clause_watch(s, cref);
+	return SATOKO_OK;
+}
+
+static int inproc_vivify(solver_t *s, long budget)
+{
+	unsigned i, cref;
+	unsigned n_vars = vec_char_size(s->assigns);
+	long n_props_limit = s->stats.n_propagations + budget;
+	char *polarity = satoko_alloc(char, n_vars);
+	vec_uint_t *lits = vec_uint_alloc(0);
+	int status = SATOKO_OK;
+
+	/* Trial assignments should not disturb the saved phases */
+	memcpy(polarity, vec_char_data(s->polarity), sizeof(char) * n_vars);
+	vec_uint_foreach_start(s->learnts, cref, i, s->book_cl_lrnt) {
+		struct clause *clause = clause_fetch(s, cref);
+
+		if (s->stats.n_propagations >= n_props_limit)
+			break;
+		if (clause->f_mark || clause->f_vivified || clause->size <= 2 || clause->lbd > s->opts.lbd_tier2)
+			continue;
+		clause->f_vivified = 1;
+		status = inproc_vivify_clause(s, cref, lits);
+		if (status == SATOKO_ERR)
+			break;
+	}
+	memcpy(vec_char_data(s->polarity), polarity, sizeof(char) * n_vars);
+	vec_uint_free(lits);
+	satoko_free(polarity);
+	return status;
+}
+
+//===------------------------------------------------------------------------===
+// Bounded variable elimination
+//===------------------------------------------------------------------------===
+static inline void inproc_elim_push(solver_t *s, struct clause *clause, unsigned pivot)
+{
+	unsigned i;
+
+	vec_uint_push_back(s->elim_recs, vec_uint_size(s->elim_lits));
+	vec_uint_push_back(s->elim_lits, pivot);
+	for (i = 0; i < clause->size; i++)
+		if (clause->data[i].lit != pivot)
+			vec_uint_push_back(s->elim_lits, clause->data[i].lit);
+}
+
+static inline void inproc_occ_push(vec_uint_t **occs, unsigned lit, unsigned cref)
+{
+	if (occs[lit] == NULL)
+		occs[lit] = vec_uint_alloc(0);
+	vec_uint_push_back(occs[lit], cref);
+}
+
+/* Collects the original clauses containing the literal, or returns 0 if there
+ * are too many of them */
+static inline int inproc_occ_collect(solver_t *s, vec_uint_t *occ, vec_uint_t *res)
+{
+	unsigned i, cref;
+
+	vec_uint_clear(res);
+	if (occ == NULL)
+		return 1;
+	vec_uint_foreach(occ, cref, i) {
+		struct clause *clause = clause_fetch(s, cref);
+		if (clause->f_mark || clause->f_learnt)
+			continue;
+		if (vec_uint_size(res) == s->opts.bve_occ_limit)
+			return 0;
+		vec_uint_push_back(res, cref);
+	}
+	return 1;
+}
+
+/* Computes the resolvent on the pivot, returns 0 if it is trivially satisfied */
+static inline int inproc_resolve(solver_t *s, struct clause *c1, struct clause *c2, unsigned pivot,
+				 unsigned *lit_stamp, unsigned stamp, vec_uint_t *res)
+{
+	unsigned i, lit;
+
+	vec_uint_clear(res);
+	for (i = 0; i < c1->size; i++) {
+		lit = c1->data[i].lit;
+		if (lit == pivot || lit_value(s, lit) == SATOKO_LIT_FALSE)
+			continue;
+		if (lit_value(s, lit) == SATOKO_LIT_TRUE)
+			return 0;
+		lit_stamp[lit] = stamp;
+		vec_uint_push_back(res, lit);
+	}
+	for (i = 0; i < c2->size; i++) {
+		lit = c2->data[i].lit;
+		if (lit == lit_compl(pivot) || lit_value(s, lit) == SATOKO_LIT_FALSE)
+			continue;
+		if (lit_value(s, lit) == SATOKO_LIT_TRUE || lit_stamp[lit_compl(lit)] == stamp)
+			return 0;
+		if (lit_stamp[lit] != stamp)
+			vec_uint_push_back(res, lit);
+	}
+	return 1;
+}
+
+/**
+ *  A variable is eliminated if the number of non-tautological resolvents is
+ *  not larger than the number of its clauses. Frozen variables, variables in
+ *  the current assumptions and (when a bookmark is active) variables created
+ *  before the bookmark are skipped. Learnt clauses with the variable are
+ *  deleted.
+ */
+static int inproc_bve(solver_t *s, long budget)
+{
+	unsigned n_vars = vec_char_size(s->assigns);
+	vec_uint_t **occs = satoko_calloc(vec_uint_t *, 2 * n_vars);
+	unsigned *lit_stamp = satoko_calloc(unsigned, 2 * n_vars);
+	char *f_assump = satoko_calloc(char, n_vars);
+	vec_uint_t *pos = vec_uint_alloc(0);
+	vec_uint_t *neg = vec_uint_alloc(0);
+	vec_uint_t *lits = vec_uint_alloc(0);
+	vec_uint_t *resolvents = vec_uint_alloc(0);
+	unsigned i, j, k, var, cref, stamp = 0;
+	int status = SATOKO_OK;
+	long n_steps = 0;
+
+	vec_uint_foreach(s->assumptions, var, i)
+		f_assump[lit2var(var)] = 1;
+	vec_uint_foreach(s->originals, cref, i) {
+		struct clause *clause = clause_fetch(s, cref);
+		for (j = 0; j < clause->size; j++)
+			if (lit2var(clause->data[j].lit) >= s->book_vars)
+				inproc_occ_push(occs, clause->data[j].lit, cref);
+	}
+	vec_uint_foreach_start(s->learnts, cref, i, s->book_cl_lrnt) {
+		struct clause *clause = clause_fetch(s, cref);
+		for (j = 0; j < clause->size; j++)
+			if (lit2var(clause->data[j].lit) >= s->book_vars)
+				inproc_occ_push(occs, clause->data[j].lit, cref);
+	}
+
+	for (var = s->book_vars; var < n_vars && n_steps < budget && status == SATOKO_OK; var++) {
+		unsigned pivot = var2lit(var, 0);
+		unsigned n_res = 0;
+		int f_fail = 0;
+
+		if (var_value(s, var) != SATOKO_VAR_UNASSING || var_is_eliminated(s, var) ||
+		    vec_char_at(s->frozen, var) || f_assump[var])
+			continue;
+		if (!inproc_occ_collect(s, occs[pivot], pos) || !inproc_occ_collect(s, occs[lit_compl(pivot)], neg))
+			continue;
+		if (vec_uint_size(pos) + vec_uint_size(neg) == 0)
+			continue;
+
+		/* Count the resolvents */
+		vec_uint_clear(resolvents);
+		for (i = 0; i < vec_uint_size(pos) && !f_fail; i++) {
+			struct clause *c1 = clause_fetch(s, vec_uint_at(pos, i));
+			for (j = 0; j < vec_uint_size(neg); j++) {
+				struct clause *c2 = clause_fetch(s, vec_uint_at(neg, j));
+				n_steps += c1->size + c2->size;
+				if (!inproc_resolve(s, c1, c2, pivot, lit_stamp, ++stamp, lits))
+					continue;
+				if (++n_res > vec_uint_size(pos) + vec_uint_size(neg) ||
+				    vec_uint_size(lits) > s->opts.bve_clause_limit) {
+					f_fail = 1;
+					break;
+				}
+				vec_uint_push_back(resolvents, vec_uint_size(lits));
+				for (k = 0; k < vec_uint_size(lits); k++)
+					vec_uint_push_back(resolvents, vec_uint_at(lits, k));
+			}
+		}
+		if (f_fail)
+			continue;
+
+		/* Save and remove the clauses of the variable */
+		vec_uint_foreach(pos, cref, i) {
+			inproc_elim_push(s, clause_fetch(s, cref), pivot);
+			inproc_clause_remove(s, cref, 1);
+		}
+		vec_uint_foreach(neg, cref, i) {
+			inproc_elim_push(s, clause_fetch(s, cref), lit_compl(pivot));
+			inproc_clause_remove(s, cref, 1);
+		}
+		/* Default value, used when no saved clause forces it */
+		vec_uint_push_back(s->elim_recs, vec_uint_size(s->elim_lits));
+		vec_uint_push_back(s->elim_lits, var2lit(var, satoko_var_polarity(s, var)));
+		for (k = 0; k < 2; k++) {
+			if (occs[pivot ^ k] == NULL)
+				continue;
+			vec_uint_foreach(occs[pivot ^ k], cref, i)
+				if (!clause_fetch(s, cref)->f_mark)
+					inproc_clause_remove(s, cref, 1);
+		}
+		vec_char_assign(s->eliminated, var, 1);
+		s->stats.n_eliminated++;
+
+		/* Add the resolvents */
+		for (i = 0; i < vec_uint_size(resolvents) && status == SATOKO_OK; i += 1 + k) {
+			k = vec_uint_at(resolvents, i);
+			vec_uint_clear(lits);
+			for (j = 0; j < k; j++)
+				vec_uint_push_back(lits, vec_uint_at(resolvents, i + 1 + j));
+			cref = inproc_add_clause(s, lits, &status);
+			if (cref == UNDEF)
+				continue;
+			for (j = 0; j < vec_uint_size(lits); j++)
+				if (lit2var(vec_uint_at(lits, j)) >= s->book_vars)
+					inproc_occ_push(occs, vec_uint_at(lits, j), cref);
+		}
+	}
+
+	for (i = 0; i < 2 * n_vars; i++)
+		if (occs[i])
+			vec_uint_free(occs[i]);
+	satoko_free(occs);
+	satoko_free(lit_stamp);
+	satoko_free(f_assump);
+	vec_uint_free(pos);
+	vec_uint_free(neg);
+	vec_uint_free(lits);
+	vec_uint_free(resolvents);
+	return status;
+}
+
+//===------------------------------------------------------------------------===
+// Inprocessing external functions
+//===------------------------------------------------------------------------===
+int solver_inprocess(solver_t *s)
+{
+	long budget = (long)s->opts.inproc_effort * (s->stats.n_conflicts_all - s->n_confl_inproc);
+	long n_subsumed = s->stats.n_subsumed;
+	long n_vivified = s->stats.n_vivified;
+	long n_eliminated = s->stats.n_eliminated;
+	int status = SATOKO_OK;
+
+	assert(solver_dlevel(s) == 0);
+	s->n_confl_inproc = s->stats.n_conflicts_all;
+	s->n_inproc++;
+	s->stats.n_inproc++;
+	if (solver_propagate(s) != UNDEF)
+		return SATOKO_ERR;
+
+	if (s->opts.f_subsume)
+		inproc_subsume(s, 4 * budget);
+	if (status == SATOKO_OK && s->opts.f_vivify)
+		status = inproc_vivify(s, budget);
+	if (status == SATOKO_OK && s->opts.f_bve)
+		status = inproc_bve(s, budget);
+	inproc_compact(s, s->originals, s->book_cl_orig);
+	inproc_compact(s, s->learnts, s->book_cl_lrnt);
+
+	if (s->opts.verbose) {
+		printf("inprocess: subsumed %6ld, vivified %6ld, eliminated %6ld vars\n",
+		       s->stats.n_subsumed - n_subsumed, s->stats.n_vivified - n_vivified,
+		       s->stats.n_eliminated - n_eliminated);
+		fflush(stdout);
+	}
+	if (cdb_wasted(s->all_clauses) > cdb_size(s->all_clauses) * s->opts.garbage_max_ratio)
+		solver_garbage_collect(s);
+	return status;
+}
+
+/**
+ *  Assigns the eliminated variables by traversing the saved clauses in the
+ *  reverse order: the pivot is flipped whenever a clause is not satisfied.
+ */
+void solver_extend_model(solver_t *s)
+{
+	unsigned i, j, beg, end = vec_uint_size(s->elim_lits);
+
+	for (i = vec_uint_size(s->elim_recs); i --> 0; end = beg) {
+		unsigned pivot;
+
+		beg = vec_uint_at(s->elim_recs, i);
+		for (j = beg + 1; j < end; j++)
+			if (inproc_lit_model(s, vec_uint_at(s->elim_lits, j)))
+				break;
+		if (j < end)
+			continue;
+		pivot = vec_uint_at(s->elim_lits, beg);
+		vec_char_assign(s->polarity, lit2var(pivot), lit_polarity(pivot));
+	}
+}
+
+/**
+ *  Brings an eliminated variable back by adding its saved clauses to the
+ *  problem again (which may in turn restore other variables).
+ */
+void solver_var_restore(solver_t *s, unsigned var)
+{
+	unsigned i, j, k, beg, end, size;
+	unsigned n_recs = vec_uint_size(s->elim_recs);
+	vec_uint_t *saved = vec_uint_alloc(0);
+
+	assert(var_is_eliminated(s, var));
+	solver_cancel_until(s, 0);
+	for (i = j = k = 0; i < n_recs; i++) {
+		beg = vec_uint_at(s->elim_recs, i);
+		end = (i + 1 < n_recs) ? vec_uint_at(s->elim_recs, i + 1) : vec_uint_size(s->elim_lits);
+		if (lit2var(vec_uint_at(s->elim_lits, beg)) == var) {
+			vec_uint_push_back(saved, end - beg);
+			for (; beg < end; beg++)
+				vec_uint_push_back(saved, vec_uint_at(s->elim_lits, beg));
+			continue;
+		}
+		vec_uint_assign(s->elim_recs, j++, k);
+		for (; beg < end; beg++)
+			vec_uint_assign(s->elim_lits, k++, vec_uint_at(s->elim_lits, beg));
+	}
+	vec_uint_shrink(s->elim_recs, j);
+	vec_uint_shrink(s->elim_lits, k);
+	vec_char_assign(s->eliminated, var, 0);
+	if (!heap_in_heap(s->var_order, var))
+		heap_insert(s->var_order, var);
+	for (i = 0; i < vec_uint_size(saved); i += 1 + size) {
+		size = vec_uint_at(saved, i);
+		if (size > 1)
+			satoko_add_clause(s, (int *)vec_uint_data(saved) + i + 1, size);
+	}
+	vec_uint_free(saved);
+}
+
+ABC_NAMESPACE_IMPL_END
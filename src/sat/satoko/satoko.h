@@ -65,6 +65,16 @@ struct satoko_opts {
 	unsigned clause_max_sz_bin_resol;
 	unsigned clause_min_lbd_bin_resol;
 	float garbage_max_ratio;
+
+	/* Inprocessing */
+	unsigned inproc_conf;      /* N.of conflicts between inprocessing rounds (0 disables it) */
+	unsigned inproc_effort;    /* Propagations allowed per conflict since the previous round */
+	unsigned lbd_tier2;        /* Learnts up to this LBD are kept as long as they are used (0 disables it) */
+	unsigned bve_occ_limit;    /* Max n.of occurrences of each polarity of an eliminated variable */
+	unsigned bve_clause_limit; /* Max size of a resolvent added by variable elimination */
+	char f_subsume;
+	char f_vivify;
+	char f_bve;
 	char verbose;
 	char no_simplify;
 };
@@ -82,6 +92,12 @@ struct satoko_stats {
 
 	long n_original_lits;
 	long n_learnt_lits;
+
+	unsigned n_inproc;
+	long n_subsumed;
+	long n_vivified;
+	long n_vivified_lits;
+	long n_eliminated;
 };
 
 
@@ -91,6 +107,7 @@ extern void satoko_destroy(satoko_t *);
 extern void satoko_reset(satoko_t *);
 
 extern void satoko_default_opts(satoko_opts_t *);
+extern void satoko_inproc_opts(satoko_opts_t *);
 extern void satoko_configure(satoko_t *, satoko_opts_t *);
 extern int  satoko_parse_dimacs(char *, satoko_t **);
 extern void satoko_setnvars(satoko_t *, int);
@@ -105,6 +122,11 @@ extern int  satoko_solve_assumptions_limit(satoko_t *s, int * plits, int nlits,
 extern int  satoko_minimize_assumptions(satoko_t *s, int * plits, int nlits, int nconflim);
 extern void satoko_mark_cone(satoko_t *, int *, int);
 extern void satoko_unmark_cone(satoko_t *, int *, int);
+/* Variables used in future clauses or assumptions should be frozen before
+ * solving when variable elimination is enabled. Otherwise, an eliminated
+ * variable is restored (with its clauses) the next time it is used. */
+extern void satoko_var_set_frozen(satoko_t *, int, int);
+extern int  satoko_var_is_eliminated(satoko_t *, int);
 
 extern void satoko_rollback(satoko_t *);
 extern void satoko_bookmark(satoko_t *);
@@ -138,6 +160,7 @@ extern int satoko_conflictnum(satoko_t *);
 extern void satoko_set_stop(satoko_t *, int *);
 extern void satoko_set_stop_func(satoko_t *s, int (*fnct)(int));
 extern void satoko_set_runid(satoko_t *, int);
+extern void satoko_set_learnt_func(satoko_t *, void *, void (*fnct)(void *, int *, int, int));
 extern int satoko_read_cex_varvalue(satoko_t *, int);
 extern abctime satoko_set_runtime_limit(satoko_t *, abctime);
 extern char satoko_var_polarity(satoko_t *, unsigned);
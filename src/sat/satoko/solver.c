@@ -194,6 +194,8 @@ static inline unsigned solver_decide(solver_t *s)
 		next_var = heap_remove_min(s->var_order);
 		if (solver_has_marks(s) && !var_mark(s, next_var))
 			next_var = UNDEF;
+		else if (var_is_eliminated(s, next_var))
+			next_var = UNDEF;
 	}
 	return var2lit(next_var, satoko_var_polarity(s, next_var));
 }
@@ -275,8 +277,10 @@ static inline void solver_analyze(solver_t *s, unsigned cref, vec_uint_t *learnt
 			stk_swap(unsigned, lits[0], lits[1] );
 		}
 
-		if (clause->f_learnt)
+		if (clause->f_learnt) {
 			clause_act_bump(s, clause);
+			clause->f_used = 1;
+		}
 
 		if (clause->f_learnt && clause->lbd > 2) {
 			unsigned n_levels = clause_clac_lbd(s, lits, clause->size);
@@ -332,6 +336,12 @@ static inline int solver_rst(solver_t *s)
 	       (((long)b_queue_avg(s->bq_lbd) * s->opts.f_rst) > (s->sum_lbd / s->stats.n_conflicts));
 }
 
+static inline int solver_inproc_due(solver_t *s)
+{
+	return s->opts.inproc_conf && !solver_has_marks(s) &&
+	       s->stats.n_conflicts_all >= s->n_confl_inproc + (long)s->opts.inproc_conf * (1 + s->n_inproc / 2);
+}
+
 static inline int solver_block_rst(solver_t *s)
 {
 	return s->stats.n_conflicts > (int)s->opts.fst_block_rst &&
@@ -356,6 +366,8 @@ static inline void solver_handle_conflict(solver_t *s, unsigned confl_cref)
 		clause_watch(s, cref);
 	}
 	solver_enqueue(s, vec_uint_at(s->temp_lits, 0), cref);
+	if (s->pLearntFunc)
+		s->pLearntFunc(s->pLearntMan, (int *)vec_uint_data(s->temp_lits), vec_uint_size(s->temp_lits), lbd);
 	var_act_decay(s);
 	clause_act_decay(s);
 }
@@ -394,7 +406,7 @@ static inline void solver_analyze_final(solver_t *s, unsigned lit)
 	// solver_debug_check_unsat(s);
 }
 
-static inline void solver_garbage_collect(solver_t *s)
+void solver_garbage_collect(solver_t *s)
 {
 	unsigned i;
 	unsigned *array;
@@ -426,17 +438,26 @@ static inline void solver_garbage_collect(solver_t *s)
 	s->all_clauses = new_cdb;
 }
 
+/**
+ *  Learnt clauses are kept in three tiers: the core ones (LBD <= 2) are never
+ *  deleted, the tier-2 ones (LBD <= 'lbd_tier2', if not 0) survive a
+ *  reduction as long as they took part in a conflict since the previous one,
+ *  and the remaining (local) ones are sorted by LBD and activity and the worst half is deleted.
+ *  Clauses learnt before a bookmark are left untouched.
+ */
 static inline void solver_reduce_cdb(solver_t *s)
 {
 	unsigned i, limit;
-	unsigned n_learnts = vec_uint_size(s->learnts);
+	unsigned n_learnts = vec_uint_size(s->learnts) - s->book_cl_lrnt;
 	unsigned cref;
 	struct clause *clause;
 	struct clause **learnts_cls;
 
+	if (n_learnts == 0)
+		return;
 	learnts_cls = satoko_alloc(struct clause *, n_learnts);
 	vec_uint_foreach_start(s->learnts, cref, i, s->book_cl_lrnt)
-		learnts_cls[i] = clause_fetch(s, cref);
+		learnts_cls[i - s->book_cl_lrnt] = clause_fetch(s, cref);
 
 	limit = (unsigned)(n_learnts * s->opts.learnt_ratio);
 
@@ -448,12 +469,16 @@ static inline void solver_reduce_cdb(solver_t *s)
 	if (learnts_cls[n_learnts - 1]->lbd <= 6)
 		s->RC2 += s->opts.inc_special_reduce;
 
-	vec_uint_clear(s->learnts);
+	vec_uint_shrink(s->learnts, s->book_cl_lrnt);
 	for (i = 0; i < n_learnts; i++) {
 		clause = learnts_cls[i];
 		cref = cdb_cref(s->all_clauses, (unsigned *)clause);
 		assert(clause->f_mark == 0);
-		if (clause->f_deletable && clause->lbd > 2 && clause->size > 2 && lit_reason(s, clause->data[0].lit) != cref && (i < limit)) {
+		if (s->opts.lbd_tier2 && clause->f_used && clause->lbd <= s->opts.lbd_tier2) {
+			clause->f_used = 0;
+			limit++;
+			vec_uint_push_back(s->learnts, cref);
+		} else if (clause->f_deletable && clause->lbd > 2 && clause->size > 2 && lit_reason(s, clause->data[0].lit) != cref && (i < limit)) {
 			clause->f_mark = 1;
 			s->stats.n_learnt_lits -= clause->size;
 			clause_unwatch(s, cref);
@@ -496,6 +521,8 @@ unsigned solver_clause_create(solver_t *s, vec_uint_t *lits, unsigned f_learnt)
 	clause->f_mark = 0;
 	clause->f_reallocd = 0;
 	clause->f_deletable = f_learnt;
+	clause->f_used = 0;
+	clause->f_vivified = 0;
 	clause->size = vec_uint_size(lits);
 	memcpy(&(clause->data[0].lit), vec_uint_data(lits), sizeof(unsigned) * vec_uint_size(lits));
 
@@ -653,6 +680,10 @@ char solver_search(solver_t *s)
 			if (!s->opts.no_simplify && solver_dlevel(s) == 0)
 				satoko_simplify(s);
 
+			/* Inprocessing between restarts */
+			if (solver_dlevel(s) == 0 && solver_inproc_due(s) && solver_inprocess(s) == SATOKO_ERR)
+				return SATOKO_UNSAT;
+
 			/* Reduce the set of learnt clauses */
 			if (s->opts.learnt_ratio && vec_uint_size(s->learnts) > 100 &&
 			    s->stats.n_conflicts >= s->n_confl_bfr_reduce) {
@@ -99,6 +99,14 @@ struct solver_t_ {
 
 	/* Temporary data used for solving cones */
 	vec_char_t *marks;
+
+	/* Inprocessing */
+	vec_char_t *frozen;     /* Variables that must not be eliminated */
+	vec_char_t *eliminated; /* Variables removed by BVE */
+	vec_uint_t *elim_lits;  /* Clauses removed by BVE, the pivot literal first */
+	vec_uint_t *elim_recs;  /* Start of each clause in 'elim_lits' */
+	long n_confl_inproc;    /* N.of conflicts at the last inprocessing round */
+	unsigned n_inproc;      /* N.of inprocessing rounds */
     
 	/* Callbacks to stop the solver */
 	abctime nRuntimeLimit;
@@ -106,6 +114,10 @@ struct solver_t_ {
 	int     RunId;           
 	int   (*pFuncStop)(int);  
 
+	/* Callback reporting the learned clauses */
+	void   *pLearntMan;
+	void  (*pLearntFunc)(void *, int *, int, int);
+
 	struct satoko_stats stats;
 	struct satoko_opts opts;
 };
@@ -115,6 +127,12 @@ extern unsigned solver_clause_create(solver_t *, vec_uint_t *, unsigned);
 extern char solver_search(solver_t *);
 extern void solver_cancel_until(solver_t *, unsigned);
 extern unsigned solver_propagate(solver_t *);
+extern void solver_garbage_collect(solver_t *);
+
+/* Inprocessing */
+extern int  solver_inprocess(solver_t *);
+extern void solver_extend_model(solver_t *);
+extern void solver_var_restore(solver_t *, unsigned);
 
 /* Debuging */
 extern void solver_debug_check(solver_t *, int);
@@ -162,6 +180,10 @@ static inline void var_clean_mark(solver_t *s, unsigned var)
 {
 	vec_char_assign(s->marks, var, 0);
 }
+static inline int var_is_eliminated(solver_t *s, unsigned var)
+{
+	return (int)vec_char_at(s->eliminated, var);
+}
 //===------------------------------------------------------------------------===
 // Inline lit functions
 //===------------------------------------------------------------------------===
@@ -27,7 +27,7 @@ static inline void solver_rebuild_order(solver_t *s)
 	vec_uint_t *vars = vec_uint_alloc(vec_char_size(s->assigns));
 
 	for (var = 0; var < vec_char_size(s->assigns); var++)
-		if (var_value(s, var) == SATOKO_VAR_UNASSING)
+		if (var_value(s, var) == SATOKO_VAR_UNASSING && !var_is_eliminated(s, var))
 			vec_uint_push_back(vars, var);
 	heap_build(s->var_order, vars);
 	vec_uint_free(vars);
@@ -78,6 +78,12 @@ static inline void print_stats(solver_t *s)
 	printf("conflicts     : %10ld\n", s->stats.n_conflicts);
 	printf("decisions     : %10ld\n", s->stats.n_decisions);
 	printf("propagations  : %10ld\n", s->stats.n_propagations);
+	if (s->stats.n_inproc == 0)
+		return;
+	printf("inprocessing  : %10d\n", s->stats.n_inproc);
+	printf("  subsumed    : %10ld\n", s->stats.n_subsumed);
+	printf("  vivified    : %10ld (%ld lits)\n", s->stats.n_vivified, s->stats.n_vivified_lits);
+	printf("  eliminated  : %10ld\n", s->stats.n_eliminated);
 }
 
 //===------------------------------------------------------------------------===
@@ -124,6 +130,11 @@ solver_t * satoko_create()
 	s->last_dlevel = vec_uint_alloc(0);
 	/* Misc temporary */
 	s->stamps = vec_uint_alloc(0);
+	/* Inprocessing */
+	s->frozen = vec_char_alloc(0);
+	s->eliminated = vec_char_alloc(0);
+	s->elim_lits = vec_uint_alloc(0);
+	s->elim_recs = vec_uint_alloc(0);
 	return s;
 }
 
@@ -151,6 +162,10 @@ void satoko_destroy(solver_t *s)
 	vec_uint_free(s->stack);
 	vec_uint_free(s->last_dlevel);
 	vec_uint_free(s->stamps);
+	vec_char_free(s->frozen);
+	vec_char_free(s->eliminated);
+	vec_uint_free(s->elim_lits);
+	vec_uint_free(s->elim_recs);
 	if (s->marks)
 		vec_char_free(s->marks);
 	satoko_free(s);
@@ -186,6 +201,28 @@ void satoko_default_opts(satoko_opts_t *opts)
 	opts->clause_min_lbd_bin_resol = 6;
 
 	opts->garbage_max_ratio = (float) 0.3;
+	/* Inprocessing (off by default, see satoko_inproc_opts) */
+	opts->inproc_conf = 0;
+	opts->inproc_effort = 20;
+	opts->lbd_tier2 = 0;
+	opts->bve_occ_limit = 10;
+	opts->bve_clause_limit = 20;
+	opts->f_subsume = 1;
+	opts->f_vivify = 1;
+	opts->f_bve = 0;
+}
+
+/**
+ *  Turns on scheduled inprocessing (subsumption and vivification) and the
+ *  tier-2 learnt clauses. Variable elimination stays off since it requires
+ *  the user to freeze the variables of future clauses.
+ */
+void satoko_inproc_opts(satoko_opts_t *opts)
+{
+	opts->inproc_conf = 10000;
+	opts->lbd_tier2 = 6;
+	opts->f_subsume = 1;
+	opts->f_vivify = 1;
 }
 
 /**
@@ -244,6 +281,8 @@ int satoko_add_variable(solver_t *s, char sign)
 	vec_uint_push_back(s->reasons, UNDEF);
 	vec_uint_push_back(s->stamps, 0);
 	vec_char_push_back(s->seen, 0);
+	vec_char_push_back(s->frozen, 0);
+	vec_char_push_back(s->eliminated, 0);
 	heap_insert(s->var_order, var);
 	if (s->marks)
 		vec_char_push_back(s->marks, 0);
@@ -261,6 +300,10 @@ int satoko_add_clause(solver_t *s, int *lits, int size)
 	max_var = lit2var(lits[size - 1]);
 	while (max_var >= vec_act_size(s->activity))
 		satoko_add_variable(s, SATOKO_LIT_FALSE);
+	if (vec_uint_size(s->elim_recs))
+		for (i = 0; i < (unsigned)size; i++)
+			if (var_is_eliminated(s, lit2var(lits[i])))
+				solver_var_restore(s, lit2var(lits[i]));
 
 	vec_uint_clear(s->temp_lits);
 	j = 0;
@@ -291,6 +334,8 @@ void satoko_assump_push(solver_t *s, int lit)
 {
 	assert(lit2var(lit) < (unsigned)satoko_varnum(s));
 	// printf("[Satoko] Push assumption: %d\n", lit);
+	if (var_is_eliminated(s, lit2var(lit)))
+		solver_var_restore(s, lit2var(lit));
 	vec_uint_push_back(s->assumptions, lit);
 	vec_char_assign(s->polarity, lit2var(lit), lit_polarity(lit));
 }
@@ -333,6 +378,8 @@ int satoko_solve(solver_t *s)
 		print_stats(s);
 	
 	solver_cancel_until(s, vec_uint_size(s->assumptions));
+	if (status == SATOKO_SAT && vec_uint_size(s->elim_recs))
+		solver_extend_model(s);
 	return status;
 }
 
@@ -437,6 +484,11 @@ void satoko_bookmark(satoko_t *s)
 	// printf("[Satoko] Bookmark.\n");
 	assert(s->status == SATOKO_OK);
 	assert(solver_dlevel(s) == 0);
+	/* Clauses of the eliminated variables are restored before the bookmark */
+	while (vec_uint_size(s->elim_recs)) {
+		unsigned beg = vec_uint_at(s->elim_recs, vec_uint_size(s->elim_recs) - 1);
+		solver_var_restore(s, lit2var(vec_uint_at(s->elim_lits, beg)));
+	}
 	s->book_cl_orig = vec_uint_size(s->originals);
 	s->book_cl_lrnt = vec_uint_size(s->learnts);
 	s->book_vars = vec_char_size(s->assigns);
@@ -483,12 +535,18 @@ void satoko_reset(satoko_t *s)
 	vec_uint_clear(s->stack);
 	vec_uint_clear(s->last_dlevel);
 	vec_uint_clear(s->stamps);
+	vec_char_clear(s->frozen);
+	vec_char_clear(s->eliminated);
+	vec_uint_clear(s->elim_lits);
+	vec_uint_clear(s->elim_recs);
 	s->status = SATOKO_OK;
 	s->var_act_inc = VAR_ACT_INIT_INC;
 	s->clause_act_inc = CLAUSE_ACT_INIT_INC;
 	s->n_confl_bfr_reduce = s->opts.n_conf_fst_reduce;
 	s->RC1 = 1;
 	s->RC2 = s->opts.n_conf_fst_reduce;
+	s->n_confl_inproc = s->stats.n_conflicts_all;
+	s->n_inproc = 0;
 	s->book_cl_orig = 0;
 	s->book_cl_lrnt = 0;
 	s->book_cdb = 0;
@@ -514,9 +572,9 @@ void satoko_rollback(satoko_t *s)
 	cl_to_remove = satoko_alloc(struct clause *, n_originals + n_learnts);
 	/* Mark clauses */
 	vec_uint_foreach_start(s->originals, cref, i, s->book_cl_orig)
-		cl_to_remove[i] = clause_fetch(s, cref);
+		cl_to_remove[i - s->book_cl_orig] = clause_fetch(s, cref);
 	vec_uint_foreach_start(s->learnts, cref, i, s->book_cl_lrnt)
-		cl_to_remove[n_originals + i] = clause_fetch(s, cref);
+		cl_to_remove[n_originals + i - s->book_cl_lrnt] = clause_fetch(s, cref);
 	for (i = 0; i < n_originals + n_learnts; i++) {
 		clause_unwatch(s, cdb_cref(s->all_clauses, (unsigned *)cl_to_remove[i]));
 		cl_to_remove[i]->f_mark = 1;
@@ -524,13 +582,20 @@ void satoko_rollback(satoko_t *s)
 	satoko_free(cl_to_remove);
 	vec_uint_shrink(s->originals, s->book_cl_orig);
 	vec_uint_shrink(s->learnts, s->book_cl_lrnt);
+	/* Cancel level 0 assignments made after the bookmark */
+	for (i = s->book_trail; i < vec_uint_size(s->trail); i++) {
+		unsigned var = lit2var(vec_uint_at(s->trail, i));
+		vec_char_assign(s->assigns, var, SATOKO_VAR_UNASSING);
+		vec_uint_assign(s->reasons, var, UNDEF);
+	}
+	vec_uint_shrink(s->trail, s->book_trail);
+	s->i_qhead = s->book_trail;
 	/* Shrink variable related vectors */
-	for (i = s->book_vars; i < 2 * vec_char_size(s->assigns); i++) {
+	for (i = 2 * s->book_vars; i < 2 * vec_char_size(s->assigns); i++) {
 		vec_wl_at(s->watches, i)->size = 0;
 		vec_wl_at(s->watches, i)->n_bin = 0;
 	}
-	// s->i_qhead = s->book_qhead;
-	s->watches->size = s->book_vars;
+	s->watches->size = 2 * s->book_vars;
 	vec_act_shrink(s->activity, s->book_vars);
 	vec_uint_shrink(s->levels, s->book_vars);
 	vec_uint_shrink(s->reasons, s->book_vars);
@@ -538,10 +603,14 @@ void satoko_rollback(satoko_t *s)
 	vec_char_shrink(s->assigns, s->book_vars);
 	vec_char_shrink(s->seen, s->book_vars);
 	vec_char_shrink(s->polarity, s->book_vars);
+	vec_char_shrink(s->frozen, s->book_vars);
+	vec_char_shrink(s->eliminated, s->book_vars);
+	if (s->marks)
+		vec_char_shrink(s->marks, s->book_vars);
+	/* Only the variables created after the bookmark can be eliminated */
+	vec_uint_clear(s->elim_lits);
+	vec_uint_clear(s->elim_recs);
 	solver_rebuild_order(s);
-	/* Rewind solver and cancel level 0 assignments to the trail */
-	solver_cancel_until(s, 0);
-	vec_uint_shrink(s->trail, s->book_trail);
 	if (s->book_cdb)
 		s->all_clauses->size = s->book_cdb;
 	s->book_cl_orig = 0;
@@ -572,6 +641,19 @@ void satoko_unmark_cone(satoko_t *s, int *pvars, int n_vars)
 		var_clean_mark(s, pvars[i]);
 }
 
+void satoko_var_set_frozen(satoko_t *s, int var, int frozen)
+{
+	assert(var < satoko_varnum(s));
+	if (frozen && var_is_eliminated(s, var))
+		solver_var_restore(s, var);
+	vec_char_assign(s->frozen, var, (char)(frozen != 0));
+}
+
+int satoko_var_is_eliminated(satoko_t *s, int var)
+{
+	return var_is_eliminated(s, var);
+}
+
 void satoko_write_dimacs(satoko_t *s, char *fname, int wrt_lrnt, int zero_var)
 {
 	FILE *file;
@@ -649,6 +731,12 @@ void satoko_set_runid(satoko_t *s, int id)
 	s->RunId = id;
 }
 
+void satoko_set_learnt_func(satoko_t *s, void * pman, void (*fnct)(void *, int *, int, int))
+{
+	s->pLearntMan = pman;
+	s->pLearntFunc = fnct;
+}
+
 int satoko_read_cex_varvalue(satoko_t *s, int ivar)
 {
 	return satoko_var_polarity(s, ivar) == SATOKO_LIT_TRUE;
@@ -45,9 +45,20 @@ extern int xSAT_SolverParseDimacs( FILE *, xSAT_Solver_t ** );
 extern xSAT_Solver_t * xSAT_SolverCreate();
 extern void xSAT_SolverDestroy( xSAT_Solver_t * );
 
+extern int xSAT_SolverAddVariable( xSAT_Solver_t *, int );
 extern int xSAT_SolverAddClause( xSAT_Solver_t *, Vec_Int_t * );
+extern int xSAT_SolverAddClauseArray( xSAT_Solver_t *, int *, int );
 extern int xSAT_SolverSimplify( xSAT_Solver_t * );
 extern int xSAT_SolverSolve( xSAT_Solver_t * );
+extern int xSAT_SolverSolveAssumptions( xSAT_Solver_t *, int *, int, int );
+
+extern int xSAT_SolverFinal( xSAT_Solver_t *, int ** );
+extern int xSAT_SolverReadVarValue( xSAT_Solver_t *, int );
+extern int xSAT_SolverVarNum( xSAT_Solver_t * );
+extern int xSAT_SolverConflictNum( xSAT_Solver_t * );
+extern void xSAT_SolverSetStop( xSAT_Solver_t *, int * );
+extern abctime xSAT_SolverSetRuntimeLimit( xSAT_Solver_t *, abctime );
+extern void xSAT_SolverSetVerbose( xSAT_Solver_t *, int );
 
 extern void xSAT_SolverPrintStats( xSAT_Solver_t * );
 
@@ -651,6 +651,51 @@ static void xSAT_SolverAnalyze( xSAT_Solver_t* s, unsigned ConfCRef, Vec_Int_t *
     Vec_IntClear( s->vTagged );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives the final conflict in terms of the assumptions.]
+
+  Description [Lit is the negation of the assumption found to be false.
+  The resulting clause, stored in vFinal, contains Lit and the negations 
+  of the assumptions that imply it.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void xSAT_SolverAnalyzeFinal( xSAT_Solver_t * s, int Lit )
+{
+    int i, j;
+
+    Vec_IntClear( s->vFinal );
+    Vec_IntPush( s->vFinal, Lit );
+    if ( xSAT_SolverDecisionLevel( s ) == 0 )
+        return;
+
+    Vec_StrWriteEntry( s->vSeen, xSAT_Lit2Var( Lit ), 1 );
+    for ( i = Vec_IntSize( s->vTrail ) - 1; i >= Vec_IntEntry( s->vTrailLim, 0 ); i-- )
+    {
+        int Var = xSAT_Lit2Var( Vec_IntEntry( s->vTrail, i ) );
+
+        if ( !Vec_StrEntry( s->vSeen, Var ) )
+            continue;
+        if ( ( unsigned ) Vec_IntEntry( s->vReasons, Var ) == CRefUndef )
+            Vec_IntPush( s->vFinal, xSAT_NegLit( Vec_IntEntry( s->vTrail, i ) ) );
+        else
+        {
+            xSAT_Clause_t * pCla = xSAT_SolverReadClause( s, ( unsigned ) Vec_IntEntry( s->vReasons, Var ) );
+            int * Lits = &( pCla->pData[0].Lit );
+
+            for ( j = 0; j < pCla->nSize; j++ )
+                if ( xSAT_Lit2Var( Lits[j] ) != Var && Vec_IntEntry( s->vLevels, xSAT_Lit2Var( Lits[j] ) ) > 0 )
+                    Vec_StrWriteEntry( s->vSeen, xSAT_Lit2Var( Lits[j] ), 1 );
+        }
+        Vec_StrWriteEntry( s->vSeen, Var, 0 );
+    }
+    Vec_StrWriteEntry( s->vSeen, xSAT_Lit2Var( Lit ), 0 );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -885,8 +930,13 @@ char xSAT_SolverSearch( xSAT_Solver_t * s )
         }
         else
         {
-            /* No conflict */
-            int NextVar;
+            /* No conflict */
+            int NextVar, NextLit = LitUndef;
+            if ( xSAT_SolverReachedLimit( s ) )
+            {
+                xSAT_SolverCancelUntil( s, 0 );
+                return LBoolUndef;
+            }
             if ( xSAT_BQueueIsValid( s->bqLBD ) && ( ( ( iword )xSAT_BQueueAvg( s->bqLBD ) * s->Config.K ) > ( s->nSumLBD / s->Stats.nConflicts ) ) )
             {
                 xSAT_BQueueClean( s->bqLBD );
@@ -907,13 +957,37 @@ char xSAT_SolverSearch( xSAT_Solver_t * s )
                 s->nConfBeforeReduce = s->nRC1 * s->nRC2;
             }
 
+            // Assumptions are decided first, one per decision level:
+            while ( xSAT_SolverDecisionLevel( s ) < Vec_IntSize( s->vAssumptions ) )
+            {
+                int Lit = Vec_IntEntry( s->vAssumptions, xSAT_SolverDecisionLevel( s ) );
+                char Value = Vec_StrEntry( s->vAssigns, xSAT_Lit2Var( Lit ) );
+
+                if ( Value == xSAT_LitSign( Lit ) ) // already true: dummy decision level
+                    Vec_IntPush( s->vTrailLim, Vec_IntSize( s->vTrail ) );
+                else if ( Value == VarX )
+                {
+                    NextLit = Lit;
+                    break;
+                }
+                else
+                {
+                    xSAT_SolverAnalyzeFinal( s, xSAT_NegLit( Lit ) );
+                    return LBoolFalse;
+                }
+            }
+
             // New variable decision:
-            NextVar = xSAT_SolverDecide( s );
+            if ( NextLit == LitUndef )
+            {
+                NextVar = xSAT_SolverDecide( s );
 
-            if ( NextVar == VarUndef )
-                return LBoolTrue;
+                if ( NextVar == VarUndef )
+                    return LBoolTrue;
 
-            xSAT_SolverNewDecision( s, xSAT_Var2Lit( NextVar, ( int ) Vec_StrEntry( s->vPolarity, NextVar ) ) );
+                NextLit = xSAT_Var2Lit( NextVar, ( int ) Vec_StrEntry( s->vPolarity, NextVar ) );
+            }
+            xSAT_SolverNewDecision( s, NextLit );
         }
     }
 
@@ -166,6 +166,13 @@ struct xSAT_Solver_t_
     Vec_Int_t * vStamp;        /* Multipurpose stamp used to calculate LBD and
                                 * clauses minimization with binary resolution */
 
+    /* Incremental solving */
+    Vec_Int_t * vAssumptions;  /* Assumptions of the current call, decided first. */
+    Vec_Int_t * vFinal;        /* Final conflict clause in terms of the negated
+                                * assumptions, if the call returned UNSAT. */
+    Vec_Str_t * vModel;        /* Variable assignment, if the call returned SAT. */
+    int * pStop;               /* External flag to terminate the search. */
+
     xSAT_SolverOptions_t Config;
     xSAT_Stats_t Stats;
 };
@@ -212,6 +219,11 @@ static inline int xSAT_SolverIsClauseSatisfied( xSAT_Solver_t * s, xSAT_Clause_t
     return false;
 }
 
+static inline int xSAT_SolverReachedLimit( xSAT_Solver_t * s )
+{
+    return ( s->Config.nConfLimit && s->Stats.nConflicts >= s->Config.nConfLimit ) || ( s->pStop && *s->pStop );
+}
+
 static inline void xSAT_SolverPrintClauses( xSAT_Solver_t * s )
 {
     int i;
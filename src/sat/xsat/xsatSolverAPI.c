@@ -94,6 +94,9 @@ xSAT_Solver_t* xSAT_SolverCreate()
     s->vLearntClause = Vec_IntAlloc(0);
     s->vLastDLevel = Vec_IntAlloc(0);
 
+    s->vAssumptions = Vec_IntAlloc(0);
+    s->vFinal = Vec_IntAlloc(0);
+    s->vModel = Vec_StrAlloc(0);
 
     s->bqTrail = xSAT_BQueueNew( s->Config.nSizeTrailQueue );
     s->bqLBD = xSAT_BQueueNew( s->Config.nSizeLBDQueue );
@@ -136,6 +139,10 @@ void xSAT_SolverDestroy( xSAT_Solver_t * s )
     Vec_IntFree( s->vLearntClause );
     Vec_IntFree( s->vLastDLevel );
 
+    Vec_IntFree( s->vAssumptions );
+    Vec_IntFree( s->vFinal );
+    Vec_StrFree( s->vModel );
+
     Vec_IntFree( s->vActivity );
     Vec_StrFree( s->vPolarity );
     Vec_StrFree( s->vTags );
@@ -216,7 +223,7 @@ int xSAT_SolverSimplify( xSAT_Solver_t * s )
   SeeAlso     []
 
 ***********************************************************************/
-void xSAT_SolverAddVariable( xSAT_Solver_t* s, int Sign )
+int xSAT_SolverAddVariable( xSAT_Solver_t* s, int Sign )
 {
     int Var = Vec_IntSize( s->vActivity );
 
@@ -235,6 +242,7 @@ void xSAT_SolverAddVariable( xSAT_Solver_t* s, int Sign )
     Vec_StrPush( s->vSeen, 0 );
 
     xSAT_HeapInsert( s->hOrder, Var );
+    return Var;
 }
 
 /**Function*************************************************************
@@ -314,15 +322,118 @@ int xSAT_SolverSolve( xSAT_Solver_t* s )
         printf( "=========================================================================================================\n" );
     }
 
+    Vec_IntClear( s->vFinal );
     while ( status == LBoolUndef )
+    {
         status = xSAT_SolverSearch( s );
+        if ( status == LBoolUndef && ( xSAT_SolverReachedLimit( s ) || ( s->Config.nRuntimeLimit && Abc_Clock() > s->Config.nRuntimeLimit ) ) )
+            break;
+    }
 
     if ( s->Config.fVerbose )
         printf( "=========================================================================================================\n" );
 
+    if ( status == LBoolTrue )
+    {
+        Vec_StrFill( s->vModel, Vec_StrSize( s->vAssigns ), VarX );
+        memcpy( Vec_StrArray( s->vModel ), Vec_StrArray( s->vAssigns ), (size_t)Vec_StrSize( s->vAssigns ) );
+    }
     xSAT_SolverCancelUntil( s, 0 );
     return status;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem under assumptions.]
+
+  Description [The assumptions are decided first, in the given order.
+  If nConfLimit is not 0, the call stops after this many conflicts and
+  returns LBoolUndef. The variable values are available after LBoolTrue
+  using xSAT_SolverReadVarValue(); after LBoolFalse, xSAT_SolverFinal()
+  returns the final conflict expressed in the negated assumptions.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int xSAT_SolverSolveAssumptions( xSAT_Solver_t * s, int * pLits, int nLits, int nConfLimit )
+{
+    int i, status;
+    for ( i = 0; i < nLits; i++ )
+        while ( xSAT_Lit2Var( pLits[i] ) >= Vec_IntSize( s->vActivity ) )
+            xSAT_SolverAddVariable( s, 1 );
+    Vec_IntClear( s->vAssumptions );
+    Vec_IntPushArray( s->vAssumptions, pLits, nLits );
+    s->Config.nConfLimit = nConfLimit ? s->Stats.nConflicts + nConfLimit : 0;
+    status = xSAT_SolverSolve( s );
+    s->Config.nConfLimit = 0;
+    Vec_IntClear( s->vAssumptions );
+    return status;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds a clause given as an array of literals.]
+
+  Description [Similar to satoko_add_clause(), the literals are sorted
+  in place. Returns false if the problem became UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int xSAT_SolverAddClauseArray( xSAT_Solver_t * s, int * pLits, int nLits )
+{
+    Vec_Int_t vLits = { nLits, nLits, pLits };
+    if ( nLits == 0 )
+        return false;
+    return xSAT_SolverAddClause( s, &vLits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Access to the results and the limits of the solver.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int xSAT_SolverFinal( xSAT_Solver_t * s, int ** ppLits )
+{
+    *ppLits = Vec_IntArray( s->vFinal );
+    return Vec_IntSize( s->vFinal );
+}
+int xSAT_SolverReadVarValue( xSAT_Solver_t * s, int Var )
+{
+    return Var < Vec_StrSize( s->vModel ) && Vec_StrEntry( s->vModel, Var ) == Var1;
+}
+int xSAT_SolverVarNum( xSAT_Solver_t * s )
+{
+    return Vec_IntSize( s->vActivity );
+}
+int xSAT_SolverConflictNum( xSAT_Solver_t * s )
+{
+    return (int)s->Stats.nConflicts;
+}
+void xSAT_SolverSetStop( xSAT_Solver_t * s, int * pStop )
+{
+    s->pStop = pStop;
+}
+abctime xSAT_SolverSetRuntimeLimit( xSAT_Solver_t * s, abctime Limit )
+{
+    abctime nRuntimeLimit = s->Config.nRuntimeLimit;
+    s->Config.nRuntimeLimit = Limit;
+    return nRuntimeLimit;
+}
+void xSAT_SolverSetVerbose( xSAT_Solver_t * s, int fVerbose )
+{
+    s->Config.fVerbose = (char)fVerbose;
+}
 
 /**Function*************************************************************
 